@@ -0,0 +1,241 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  async_perf.cpp -- Asynchronous update performance example.
+
+                    A number of host threads inject updates into primitive
+                    channels with async_request_update(), as a co-simulation
+                    bridge would do. Each thread owns one channel and counts
+                    its injections in an atomic variable, the update() method
+                    of the channel picks up the count inside the simulation.
+
+                    The example reports the injection throughput of the host
+                    threads, the number of update() calls performed by the
+                    kernel (requests of a channel are merged until the kernel
+                    accepts them) and the latency from the oldest pending
+                    injection of a channel to its update() call.
+
+                    With "throttle", a thread waits until the kernel has
+                    accepted its previous request, see
+                    sc_prim_channel::async_update_requested().
+
+                    Usage:
+
+                      async_perf [threads [injections [throttle]]]
+
+                    The defaults are 4 threads and 1000000 injections per
+                    thread. To obtain a scaling curve run e.g.
+
+                      for t in 1 2 4 8; do ./async_perf $t; done
+
+                    The wall clock time varies from run to run, therefore
+                    there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock host_clock;
+
+static sc_dt::int64 host_now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           host_clock::now().time_since_epoch() ).count();
+}
+
+class injector : public sc_prim_channel
+{
+  public:
+    explicit injector(const char* name)
+      : sc_prim_channel(name)
+      , posted(0), oldest(0), done(false)
+      , seen(0), updates(0), finished(false)
+      , latency_sum(0), latency_max(0), latency_n(0)
+    {
+      async_attach_suspending();
+    }
+
+    // host thread side
+
+    void inject()
+    {
+      sc_dt::int64 none = 0;
+      oldest.compare_exchange_strong(none, host_now());
+      posted.fetch_add(1, std::memory_order_release);
+      async_request_update();
+    }
+
+    void finish()
+    {
+      done.store(true, std::memory_order_release);
+      async_request_update();
+    }
+
+    // simulation side
+
+    const sc_event& default_event() const { return ev; }
+
+    void detach() { async_detach_suspending(); }
+
+    std::atomic<sc_dt::int64> posted;  // injections of the host thread.
+    std::atomic<sc_dt::int64> oldest;  // time of oldest pending injection.
+    std::atomic<bool>         done;    // host thread has finished.
+
+    sc_dt::int64 seen;          // injections picked up by update().
+    sc_dt::int64 updates;       // number of update() calls.
+    bool         finished;
+    double       latency_sum;   // in ns.
+    sc_dt::int64 latency_max;   // in ns.
+    sc_dt::int64 latency_n;
+
+  protected:
+    virtual void update()
+    {
+      sc_dt::int64 t0 = oldest.exchange(0);
+      if (t0 != 0)
+      {
+        sc_dt::int64 latency = host_now() - t0;
+        latency_sum += double(latency);
+        latency_max = std::max(latency_max, latency);
+        ++latency_n;
+      }
+      finished = done.load(std::memory_order_acquire);
+      seen = posted.load(std::memory_order_acquire);
+      ++updates;
+      ev.notify(SC_ZERO_TIME);
+    }
+
+  private:
+    sc_event ev;
+};
+
+class monitor : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(monitor);
+
+    monitor(sc_module_name name, sc_vector<injector>& inj_)
+      : sc_module(name), inj(inj_)
+    {
+      SC_METHOD(main);
+      for (size_t i = 0; i < inj.size(); ++i)
+        sensitive << inj[i].default_event();
+      dont_initialize();
+    }
+
+    void main()
+    {
+      for (size_t i = 0; i < inj.size(); ++i)
+        if (!inj[i].finished)
+          return;
+      // let the simulation end by starvation
+      for (size_t i = 0; i < inj.size(); ++i)
+        inj[i].detach();
+    }
+
+  private:
+    sc_vector<injector>& inj;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  int  threads    = argc > 1 ? atoi(argv[1]) : 4;
+  long injections = argc > 2 ? atol(argv[2]) : 1000000;
+  bool throttle   = argc > 3 && std::strcmp(argv[3], "throttle") == 0;
+
+  if (threads < 1)    threads = 1;
+  if (injections < 1) injections = 1;
+
+  sc_vector<injector> inj("Injector", threads);
+  monitor             mon("Monitor1", inj);
+
+  std::vector<double> inject_time(threads);
+  std::vector<std::thread> hosts;
+  host_clock::time_point start = host_clock::now();
+  for (int t = 0; t < threads; ++t)
+  {
+    hosts.push_back(std::thread([&, t]() {
+      injector& ch = inj[t];
+      host_clock::time_point t0 = host_clock::now();
+      for (long i = 0; i < injections; ++i)
+      {
+        if (throttle)
+          while (ch.async_update_requested())
+            std::this_thread::yield();
+        ch.inject();
+      }
+      inject_time[t] =
+        std::chrono::duration<double>(host_clock::now() - t0).count();
+      ch.finish();
+    }));
+  }
+
+  sc_start();
+  std::chrono::duration<double> elapsed = host_clock::now() - start;
+
+  for (size_t t = 0; t < hosts.size(); ++t)
+    hosts[t].join();
+
+  int          errors = 0;
+  sc_dt::int64 updates = 0, latency_max = 0, latency_n = 0;
+  double       latency_sum = 0, slowest = 0;
+  for (int t = 0; t < threads; ++t)
+  {
+    if (inj[t].seen != injections)
+      ++errors;
+    updates     += inj[t].updates;
+    latency_sum += inj[t].latency_sum;
+    latency_n   += inj[t].latency_n;
+    latency_max  = std::max(latency_max, inj[t].latency_max);
+    slowest      = std::max(slowest, inject_time[t]);
+  }
+
+  double total = double(injections) * threads;
+  cout << "Host threads: " << threads << (throttle ? " (throttled)" : "")
+       << endl;
+  cout << "Injections: " << total << endl;
+  cout << "Kernel update() calls: " << updates << endl;
+  cout << "Injection throughput: " << total / slowest / 1e6
+       << " M/s" << endl;
+  cout << "Mean latency: " << latency_sum / double(latency_n) / 1e3
+       << " us" << endl;
+  cout << "Max latency: " << double(latency_max) / 1e3 << " us" << endl;
+  cout << "Lost injections: " << errors << endl;
+  cout << "Wall clock time: " << elapsed.count() << " s" << endl;
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,235 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  bigint_copy_perf.cpp -- Fixed width integer copy performance example.
+
+                          Times copying, assigning and destroying
+                          sc_biguint<W> and sc_bigint<W> values, which keep
+                          their digits inside the object, and the same with
+                          sc_unsigned and sc_signed values of the same width,
+                          which allocate them on the heap (vec_new_count()).
+
+                          For widths from 1 bit to more than 64 digits the
+                          copies, assignments between signed and unsigned
+                          values, copies made by containers, and the sums,
+                          differences and products of two fixed width values
+                          are checked against the sc_unsigned and sc_signed
+                          results.
+
+                          Usage:
+
+                            bigint_copy_perf [iterations]
+
+                          The default is 100000 iterations per width.
+
+                          The wall clock time varies from run to run,
+                          therefore there is no golden reference output for
+                          this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+typedef std::chrono::steady_clock host_clock;
+
+static double seconds_since(host_clock::time_point start)
+{
+  std::chrono::duration<double> d = host_clock::now() - start;
+  return d.count();
+}
+
+// fill v with pseudo random bits
+static void randomize(sc_unsigned& v)
+{
+  v = 0;
+  for (int i = 0; i < v.length(); ++i)
+    v[i] = (std::rand() >> 7) & 1;
+}
+
+static void randomize(sc_signed& v)
+{
+  v = 0;
+  for (int i = 0; i < v.length(); ++i)
+    v[i] = (std::rand() >> 7) & 1;
+}
+
+static int errors = 0;
+
+#define CHECK(cond) \
+  do { if (!(cond)) { \
+    cout << "  check failed: " #cond " (width " << W << ")" << endl; \
+    ++errors; } } while (0)
+
+template <int W>
+static void check_values()
+{
+  sc_unsigned u1(W), u2(W);
+  sc_signed   s1(W), s2(W);
+  randomize(u1);
+  randomize(u2);
+  randomize(s1);
+  randomize(s2);
+
+  // construction from the variable width values
+  sc_biguint<W> a1 = u1;
+  sc_biguint<W> a2(u2);
+  sc_bigint<W>  b1 = s1;
+  sc_bigint<W>  b2(s2);
+  CHECK(a1 == u1 && a2 == u2 && b1 == s1 && b2 == s2);
+
+  // copies are independent of the original
+  {
+    sc_biguint<W> c(a1);
+    sc_bigint<W>  d(b1);
+    CHECK(c == a1 && d == b1);
+    c[0] = !c[0];
+    d[W - 1] = !d[W - 1];
+    CHECK(a1 == u1 && b1 == s1 && c != a1 && d != b1);
+  }
+
+  // assignment, also between signed and unsigned values
+  {
+    sc_biguint<W> c;
+    sc_bigint<W>  d;
+    c = a2;
+    d = b2;
+    CHECK(c == u2 && d == s2);
+
+    const sc_biguint<W>& self = c;
+    c = self;
+    CHECK(c == u2);
+
+    sc_unsigned ut(W);
+    sc_signed   st(W);
+    ut = s1;
+    st = u1;
+    c = b1;
+    d = a1;
+    CHECK(c == ut && d == st);
+  }
+
+  // copies made by containers
+  {
+    std::vector<sc_biguint<W> > v(8, a1);
+    v.push_back(a2);
+    v.resize(20);
+    std::vector<sc_biguint<W> > copy = v;
+    v.clear();
+    bool same = true;
+    for (std::size_t i = 0; i < copy.size(); ++i)
+      same = same && copy[i] == (i < 8 ? u1 : i == 8 ? u2 : sc_unsigned(W));
+    CHECK(copy.size() == 20 && same);
+
+    std::vector<sc_bigint<W> > w(4, b1);
+    w.insert(w.begin(), b2);
+    CHECK(w.size() == 5 && w[0] == s2 && w[1] == s1 && w[4] == s1);
+  }
+
+  // operations of two fixed width values
+  {
+    sc_unsigned sum  = a1 + a2;
+    sc_unsigned prod = a1 * a2;
+    sc_signed   ssum = b1 + b2;
+    sc_signed   diff = b1 - b2;
+    sc_signed   sprod = b1 * b2;
+    CHECK(sum == u1 + u2 && prod == u1 * u2);
+    CHECK(ssum == s1 + s2 && diff == s1 - s2 && sprod == s1 * s2);
+  }
+}
+
+template <int W>
+static void run(int iterations)
+{
+  check_values<W>();
+
+  sc_unsigned u(W);
+  randomize(u);
+  sc_biguint<W> a = u;
+  int sink = 0;
+
+  // copy, assign and destroy
+  sc_dt::uint64 allocs = sc_dt::vec_new_count();
+  host_clock::time_point start = host_clock::now();
+  for (int n = 0; n < iterations; ++n)
+  {
+    sc_biguint<W> c(a);
+    sc_biguint<W> d;
+    d = c;
+    sink += d[n % W];
+  }
+  double t_fixed = seconds_since(start);
+  double a_fixed = double(sc_dt::vec_new_count() - allocs) / iterations;
+
+  allocs = sc_dt::vec_new_count();
+  start = host_clock::now();
+  for (int n = 0; n < iterations; ++n)
+  {
+    sc_unsigned c(u);
+    sc_unsigned d(W);
+    d = c;
+    sink -= d[n % W];
+  }
+  double t_var = seconds_since(start);
+  double a_var = double(sc_dt::vec_new_count() - allocs) / iterations;
+
+  // the fixed width values do not allocate
+  CHECK(a_fixed == 0 && sink == 0);
+
+  cout << "Width " << W << ": sc_biguint<" << W << "> "
+       << t_fixed * 1e9 / iterations << " ns, " << a_fixed
+       << " allocations; sc_unsigned " << t_var * 1e9 / iterations
+       << " ns, " << a_var << " allocations" << endl;
+}
+
+int sc_main (int argc , char *argv[])
+{
+  int iterations = argc > 1 ? atoi(argv[1]) : 100000;
+  if (iterations < 1) iterations = 1;
+
+  // products of up to 64 digits (BITS_PER_DIGIT bits each) are formed on
+  // the stack, wider products on the heap
+  run<1>(iterations);
+  run<30>(iterations);
+  run<64>(iterations);
+  run<65>(iterations);
+  run<256>(iterations);
+  run<960>(iterations);
+  run<1920>(iterations);
+  run<2000>(iterations);
+  run<4096>(iterations);
+
+  cout << "Errors: " << errors << endl;
+  return errors ? 1 : 0;
+}
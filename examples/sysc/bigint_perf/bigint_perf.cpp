@@ -0,0 +1,174 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  bigint_perf.cpp -- Arbitrary precision integer performance example.
+
+                     Times multiplication, division, remainder and a
+                     modular exponentiation of sc_unsigned values of
+                     several widths. Every quotient and remainder is
+                     checked against the dividend (q * b + r == a, r < b).
+
+                     Usage:
+
+                       bigint_perf [iterations [width ...]]
+
+                     The defaults are 200 iterations and the widths 256,
+                     1024 and 4096 bits. The arithmetic kernels are
+                     selected when building the library, so to compare
+                     them run this example against one library built with
+                     and one built without ENABLE_WIDE_BIGINT_KERNELS
+                     (see INSTALL.md).
+
+                     The wall clock time varies from run to run, therefore
+                     there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+typedef std::chrono::steady_clock host_clock;
+
+static double seconds_since(host_clock::time_point start)
+{
+  std::chrono::duration<double> d = host_clock::now() - start;
+  return d.count();
+}
+
+// fill the lower 'bits' bits of v with pseudo random bits, the rest with 0
+static void randomize(sc_unsigned& v, int bits)
+{
+  v = 0;
+  for (int i = 0; i < bits; ++i)
+    v[i] = (std::rand() >> 7) & 1;
+  v[bits - 1] = 1;
+}
+
+static void report(const char* op, int count, double secs)
+{
+  cout << "  " << op << ": " << secs * 1e6 / count << " us" << endl;
+}
+
+static int run(int width, int iterations)
+{
+  const int count = 16;
+  std::vector<sc_unsigned> a(count, sc_unsigned(2 * width));
+  std::vector<sc_unsigned> b(count, sc_unsigned(width));
+  for (int i = 0; i < count; ++i)
+  {
+    randomize(a[i], 2 * width);
+    randomize(b[i], width - 1 - i % 7);
+  }
+
+  sc_unsigned p(2 * width), q(2 * width), r(width), check(2 * width);
+  int errors = 0;
+
+  cout << "Width: " << width << " bits" << endl;
+
+  // multiplication: width x width -> 2 * width
+  host_clock::time_point start = host_clock::now();
+  for (int n = 0; n < iterations; ++n)
+    for (int i = 0; i < count; ++i)
+      p = b[i] * b[(i + 1) % count];
+  report("mul", iterations * count, seconds_since(start));
+
+  // division and remainder: 2 * width / width
+  start = host_clock::now();
+  for (int n = 0; n < iterations; ++n)
+    for (int i = 0; i < count; ++i)
+      q = a[i] / b[i];
+  report("div", iterations * count, seconds_since(start));
+
+  start = host_clock::now();
+  for (int n = 0; n < iterations; ++n)
+    for (int i = 0; i < count; ++i)
+      r = a[i] % b[i];
+  report("rem", iterations * count, seconds_since(start));
+
+  for (int i = 0; i < count; ++i)
+  {
+    q = a[i] / b[i];
+    r = a[i] % b[i];
+    check = q * b[i] + r;
+    if (check != a[i] || r >= b[i])
+      ++errors;
+  }
+
+  // modular exponentiation by square and multiply
+  sc_unsigned base(width), exp(width), mod(width), acc(width);
+  randomize(mod, width);
+  randomize(exp, width);
+  base = a[0] % mod;
+  acc = 1;
+  start = host_clock::now();
+  for (int i = width - 1; i >= 0; --i)
+  {
+    p = acc * acc;
+    acc = p % mod;
+    if (exp[i])
+    {
+      p = acc * base;
+      acc = p % mod;
+    }
+  }
+  double secs = seconds_since(start);
+  cout << "  modexp: " << secs * 1e3 << " ms" << endl;
+  if (acc >= mod)
+    ++errors;
+
+  cout << "  errors: " << errors << endl;
+  return errors;
+}
+
+int sc_main (int argc , char *argv[])
+{
+  int iterations = argc > 1 ? atoi(argv[1]) : 200;
+  if (iterations < 1) iterations = 1;
+
+  std::vector<int> widths;
+  for (int i = 2; i < argc; ++i)
+    if (atoi(argv[i]) > 8)
+      widths.push_back(atoi(argv[i]));
+  if (widths.empty())
+  {
+    widths.push_back(256);
+    widths.push_back(1024);
+    widths.push_back(4096);
+  }
+
+  int errors = 0;
+  for (size_t i = 0; i < widths.size(); ++i)
+    errors += run(widths[i], iterations);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  binding_perf.cpp -- Port binding resolution performance example.
+
+                      A large number of leaf modules sit at the bottom of
+                      chains of hierarchical modules. Every level binds the
+                      single ports and the multiport of its child to its
+                      own ports, so the bindings have to be resolved from
+                      the signals at the top down to the leaves at the end
+                      of elaboration. The host time of the elaboration
+                      stages is taken from sc_get_elaboration_stats().
+
+                      Usage:
+
+                        binding_perf [leaves [depth [width]]]
+
+                      The defaults are 10000 leaves, 4 levels per chain
+                      and 4 single ports plus a multiport bound to 4
+                      signals per level. To check the scaling run e.g.
+
+                        ./binding_perf 10000
+                        ./binding_perf 50000
+
+                      The wall clock time varies from run to run, therefore
+                      there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <vector>
+
+typedef sc_port<sc_signal_in_if<int>, 0, SC_ZERO_OR_MORE_BOUND> bus_port;
+
+class level : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(level);
+
+    level(sc_module_name name, int depth, int width)
+      : sc_module(name), in(width), child(0), sum(0)
+    {
+      for (int k = 0; k < width; ++k)
+        in[k] = new sc_in<int>(sc_gen_unique_name("in"));
+      if (depth > 1)
+      {
+        child = new level("child", depth - 1, width);
+        for (int k = 0; k < width; ++k)
+          (*child->in[k])(*in[k]);
+        child->bus(bus);
+      }
+      else
+      {
+        SC_METHOD(eval);
+        for (int k = 0; k < width; ++k)
+          sensitive << *in[k];
+        sensitive << bus;
+        dont_initialize();
+      }
+    }
+
+    ~level()
+    {
+      delete child;
+      for (size_t k = 0; k < in.size(); ++k)
+        delete in[k];
+    }
+
+    std::vector<sc_in<int>*> in;
+    bus_port                 bus;
+    level*                   child;
+    int                      sum;
+
+  private:
+    void eval()
+    {
+      sum = 0;
+      for (size_t k = 0; k < in.size(); ++k)
+        sum += in[k]->read();
+      for (int k = 0; k < bus.size(); ++k)
+        sum += bus[k]->read();
+    }
+};
+
+int sc_main (int argc , char *argv[])
+{
+  int leaves = argc > 1 ? atoi(argv[1]) : 10000;
+  int depth  = argc > 2 ? atoi(argv[2]) : 4;
+  int width  = argc > 3 ? atoi(argv[3]) : 4;
+
+  if (leaves < 1) leaves = 1;
+  if (depth < 1)  depth = 1;
+  if (width < 1)  width = 1;
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  std::vector<sc_signal<int>*> sig;
+  for (int k = 0; k < width; ++k)
+    sig.push_back(new sc_signal<int>(sc_gen_unique_name("sig"), k));
+
+  std::vector<level*> chains;
+  for (int i = 0; i < leaves; ++i)
+  {
+    level* l = new level(sc_gen_unique_name("chain"), depth, width);
+    for (int k = 0; k < width; ++k)
+    {
+      (*l->in[k])(*sig[k]);
+      l->bus(*sig[k]);
+    }
+    chains.push_back(l);
+  }
+
+  host_clock::time_point constructed = host_clock::now();
+  sc_start(SC_ZERO_TIME);
+  host_clock::time_point elaborated = host_clock::now();
+
+  for (size_t i = 0; i < chains.size(); ++i)
+    delete chains[i];
+  for (size_t k = 0; k < sig.size(); ++k)
+    delete sig[k];
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> cons = constructed - start;
+  std::chrono::duration<double> elab = elaborated - constructed;
+  std::chrono::duration<double> dest = end - elaborated;
+  sc_elaboration_stats stats = sc_get_elaboration_stats();
+
+  cout << "Leaves: " << leaves << ", depth: " << depth
+       << ", width: " << width << endl;
+  cout << "Ports: " << stats.ports << ", bound interfaces: "
+       << stats.bound_interfaces << endl;
+  cout << "Construction time: " << cons.count() << " s" << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "  before_end_of_elaboration: "
+       << stats.before_end_of_elaboration << " s" << endl;
+  cout << "  port binding: " << stats.port_binding << " s" << endl;
+  cout << "  end_of_elaboration: " << stats.end_of_elaboration << " s" << endl;
+  cout << "  start_of_simulation: " << stats.start_of_simulation << " s"
+       << endl;
+  cout << "Destruction time: " << dest.count() << " s" << endl;
+  return 0;
+}
@@ -0,0 +1,263 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  clock_perf.cpp -- Clock engine performance example.
+
+                    A number of sc_clock instances with different periods
+                    drive a method process each, statically sensitive to
+                    the rising edges, so the run time is dominated by
+                    scheduling the clock edges (see sc_set_clock_engine).
+
+                    In addition, clocks with different duty cycles, start
+                    times and first edges are checked: the times, values
+                    and delta cycles of their changes and rising edges are
+                    compared with the expected edge times, and with a
+                    reference clock driven by a method process in the same
+                    way as by the edge processes of sc_clock.
+
+                    Usage:
+
+                      clock_perf [engine|processes [clocks [cycles]]]
+
+                    The defaults are the clock engine, 100 clocks and
+                    10000 periods of the slowest clock. To compare run
+
+                      ./clock_perf engine
+                      ./clock_perf processes
+
+                    The wall clock time varies from run to run, therefore
+                    there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+// Counts the rising edges of a clock.
+
+class edge_counter : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(edge_counter);
+
+    edge_counter(sc_module_name name, const sc_time& period)
+      : sc_module(name), edges(0), clk("clk", period)
+    {
+      SC_METHOD(count);
+      sensitive << clk.posedge_event();
+      dont_initialize();
+    }
+
+    void count() { ++edges; }
+
+    long     edges;
+
+  private:
+    sc_clock clk;
+};
+
+// Checks the changes and rising edges of a clock against the expected
+// edge times and against a reference clock, which is toggled by a method
+// process woken by a timed event like the edge processes of sc_clock.
+
+class clock_check : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(clock_check);
+
+    clock_check(sc_module_name name, const sc_time& period, double duty,
+                const sc_time& start, bool posedge_first)
+      : sc_module(name), errors(0), changes(0),
+        clk("clk", period, duty, start, posedge_first),
+        ref("ref", !posedge_first),
+        high(period * duty), low(period - period * duty),
+        next_time(start), next_value(posedge_first)
+    {
+      if (clk.period() != period || clk.duty_cycle() != duty
+          || clk.start_time() != start
+          || clk.posedge_first() != posedge_first
+          || clk.read() != !posedge_first)
+        ++errors;
+
+      SC_METHOD(toggle);
+      sensitive << ref_edge;
+      dont_initialize();
+      ref_edge.notify(start);
+
+      SC_METHOD(watch_clk);
+      sensitive << clk;
+      dont_initialize();
+
+      SC_METHOD(watch_ref);
+      sensitive << ref;
+      dont_initialize();
+
+      SC_METHOD(watch_posedge);
+      sensitive << clk.posedge_event();
+      dont_initialize();
+    }
+
+    void toggle()
+    {
+      bool value = !ref.read();
+      ref.write(value);
+      ref_edge.notify(value ? high : low);
+    }
+
+    void watch_clk()
+    {
+      if (sc_time_stamp() != next_time || clk.read() != next_value
+          || !clk.event() || clk.posedge() != next_value)
+      {
+        cout << name() << ": " << clk.read() << " at " << sc_time_stamp()
+             << ", expected " << next_value << " at " << next_time << endl;
+        ++errors;
+      }
+      clk_deltas.push_back(sc_delta_count());
+      next_time += next_value ? high : low;
+      next_value = !next_value;
+      ++changes;
+    }
+
+    void watch_ref()
+    {
+      ref_deltas.push_back(sc_delta_count());
+    }
+
+    void watch_posedge()
+    {
+      if (!clk.read())
+        ++errors;
+      posedge_deltas.push_back(sc_delta_count());
+    }
+
+    bool check()
+    {
+      // the clock and the reference change in the same delta cycles
+      std::size_t n = std::min(clk_deltas.size(), ref_deltas.size());
+      if (clk_deltas.size() > ref_deltas.size() + 1
+          || ref_deltas.size() > clk_deltas.size() + 1)
+        ++errors;
+      for (std::size_t i = 0; i < n; ++i)
+        if (clk_deltas[i] != ref_deltas[i])
+        {
+          cout << name() << ": change " << i << " in delta "
+               << clk_deltas[i] << ", reference in delta " << ref_deltas[i]
+               << endl;
+          ++errors;
+          break;
+        }
+
+      // the rising edges are notified together with the changes
+      std::size_t first = clk.posedge_first() ? 0 : 1;
+      for (std::size_t i = 0; i < posedge_deltas.size(); ++i)
+        if (first + 2 * i >= clk_deltas.size()
+            || posedge_deltas[i] != clk_deltas[first + 2 * i])
+        {
+          ++errors;
+          break;
+        }
+      return errors == 0 && changes > 0;
+    }
+
+    int   errors;
+    long  changes;
+
+  private:
+    sc_clock          clk;
+    sc_signal<bool>   ref;
+    sc_event          ref_edge;
+    sc_time           high;
+    sc_time           low;
+    sc_time           next_time;
+    bool              next_value;
+    std::vector<sc_dt::uint64> clk_deltas;
+    std::vector<sc_dt::uint64> ref_deltas;
+    std::vector<sc_dt::uint64> posedge_deltas;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  bool processes = argc > 1 && std::strcmp(argv[1], "processes") == 0;
+  int  clocks    = argc > 2 ? atoi(argv[2]) : 100;
+  int  cycles    = argc > 3 ? atoi(argv[3]) : 10000;
+
+  if (clocks < 1) clocks = 1;
+  if (cycles < 1) cycles = 1;
+
+  sc_set_clock_engine(!processes);
+
+  typedef std::chrono::steady_clock host_clock;
+
+  // periods from 10 ns to 10 ns + clocks ps
+  sc_vector<edge_counter> counters("Counter");
+  counters.init(clocks, [](const char* name, std::size_t i) {
+    return new edge_counter(name, sc_time(10000 + double(i), SC_PS));
+  });
+
+  clock_check check_a("CheckA", sc_time(10, SC_NS), 0.5, SC_ZERO_TIME, true);
+  clock_check check_b("CheckB", sc_time(10, SC_NS), 0.3, sc_time(2, SC_NS),
+                      true);
+  clock_check check_c("CheckC", sc_time(7, SC_NS), 0.25, sc_time(3, SC_NS),
+                      false);
+  clock_check check_d("CheckD", sc_time(4, SC_NS), 0.75, SC_ZERO_TIME,
+                      false);
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start(sc_time(10000 + clocks, SC_PS) * cycles);
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> sim = end - elaborated;
+
+  long edges = 0;
+  for (std::size_t i = 0; i < counters.size(); ++i)
+    edges += counters[i].edges;
+
+  bool ok = check_a.check() && check_b.check() && check_c.check()
+         && check_d.check();
+  if (edges < long(clocks) * (cycles - 1))
+    ok = false;
+
+  cout << "Clocks: " << clocks << " (" << (processes ? "processes" : "engine")
+       << "), rising edges: " << edges << endl;
+  cout << "Clock checks: "
+       << check_a.changes + check_b.changes + check_c.changes
+          + check_d.changes
+       << " changes, errors: " << !ok << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per edge: " << sim.count() * 1e9 / double(2 * edges)
+       << " ns" << endl;
+  return ok ? 0 : 1;
+}
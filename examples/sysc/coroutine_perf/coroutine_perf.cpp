@@ -0,0 +1,174 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  coroutine_perf.cpp -- Lightweight process performance example.
+
+                        A large number of processes wait alternately for a
+                        shared tick event and for a short delay, count their
+                        activations and then stay idle until the end of the
+                        simulation. The processes are either stackless
+                        coroutine processes (SC_COROUTINE, needs C++20) or
+                        thread processes with a small stack.
+
+                        Usage:
+
+                          coroutine_perf [coroutine|thread [processes
+                                         [cycles]]]
+
+                        The defaults are 1000000 coroutine processes, or
+                        10000 thread processes when built without coroutine
+                        support, and 10 cycles. To compare run e.g.
+
+                          ./coroutine_perf coroutine 10000
+                          ./coroutine_perf thread 10000
+
+                        The wall clock time varies from run to run, therefore
+                        there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <chrono>
+#include <cstring>
+
+class swarm : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(swarm);
+
+    swarm(sc_module_name name, bool coroutines, int processes, int cycles_)
+      : sc_module(name), activations(0), running(processes), cycles(cycles_)
+    {
+      SC_THREAD(driver);
+
+      sc_spawn_options opt;
+      opt.set_stack_size(16 * 1024);
+      for (int i = 0; i < processes; ++i)
+      {
+#ifdef SC_HAS_COROUTINES_
+        if (coroutines)
+        {
+          sc_spawn_coroutine([this, i]() { return co_worker(i); });
+          continue;
+        }
+#endif
+        sc_spawn(sc_bind(&swarm::th_worker, this, i), 0, &opt);
+      }
+    }
+
+    sc_dt::uint64 activations;
+
+  private:
+    void driver()
+    {
+      while (running > 0)
+      {
+        wait(1, SC_NS);
+        tick.notify();
+      }
+    }
+
+#ifdef SC_HAS_COROUTINES_
+    sc_coroutine co_worker(int i)
+    {
+      for (int c = 0; c < cycles; ++c)
+      {
+        if ((i + c) % 2)
+          co_await sc_co_wait(tick);
+        else
+          co_await sc_co_wait(1 + i % 4, SC_NS);
+        ++activations;
+      }
+      --running;
+      co_await sc_co_wait(idle); // don't measure process termination
+    }
+#endif
+
+    void th_worker(int i)
+    {
+      for (int c = 0; c < cycles; ++c)
+      {
+        if ((i + c) % 2)
+          wait(tick);
+        else
+          wait(1 + i % 4, SC_NS);
+        ++activations;
+      }
+      --running;
+      wait(idle); // don't measure process termination
+    }
+
+    sc_event tick;
+    sc_event idle;
+    int      running;
+    int      cycles;
+};
+
+int sc_main (int argc , char *argv[])
+{
+#ifdef SC_HAS_COROUTINES_
+  bool coroutines = argc <= 1 || std::strcmp(argv[1], "thread") != 0;
+#else
+  bool coroutines = false;
+  if (argc > 1 && std::strcmp(argv[1], "coroutine") == 0)
+    cout << "Coroutine processes require C++20, using threads" << endl;
+#endif
+  int processes = argc > 2 ? atoi(argv[2]) : (coroutines ? 1000000 : 10000);
+  int cycles    = argc > 3 ? atoi(argv[3]) : 10;
+
+  if (processes < 1) processes = 1;
+  if (cycles < 1)    cycles = 1;
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  swarm top("Swarm1", coroutines, processes, cycles);
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start();
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+  sc_dt::uint64 expected = sc_dt::uint64(processes) * cycles;
+
+  cout << "Processes: " << processes
+       << (coroutines ? " coroutines" : " threads") << endl;
+  cout << "Activations: " << top.activations
+       << ", errors: " << (top.activations != expected) << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per activation: "
+       << sim.count() * 1e9 / double(top.activations) << " ns" << endl;
+  return top.activations == expected ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  event_queue_perf.cpp -- Event queue performance example.
+
+                          An interrupt source posts a burst of notifications
+                          to an sc_event_queue in every time step, spread
+                          over a few distinct delays, and a method process
+                          counts the triggers of the queue. Notifications
+                          for the same time are delivered in consecutive
+                          delta cycles.
+
+                          In addition, a thread waits for an event with a
+                          delta cycle timeout while another thread notifies
+                          the event and an sc_event_queue for the next delta
+                          cycle, so the event cancels the pending timeout
+                          while the queue notifies its next delta cycle.
+                          The thread must resume once per round.
+
+                          Usage:
+
+                            event_queue_perf [single|bulk [burst [steps]]]
+
+                          The defaults are single notifications, a burst of
+                          1000 notifications and 1000 time steps. In bulk
+                          mode each burst is posted with a single call of
+                          notify(const sc_time*, int). To compare run e.g.
+
+                            ./event_queue_perf single
+                            ./event_queue_perf bulk
+
+                          The wall clock time varies from run to run,
+                          therefore there is no golden reference output for
+                          this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+static const int DELAYS = 8; // distinct delays of a burst in ns
+
+class interrupts : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(interrupts);
+
+    interrupts(sc_module_name name, bool bulk_, int burst, int steps_)
+      : sc_module(name), triggers(0), bulk(bulk_), steps(steps_)
+    {
+      for (int i = 0; i < burst; ++i)
+        delays.push_back(sc_time((i * 5) % DELAYS, SC_NS));
+
+      SC_THREAD(source);
+      SC_METHOD(sink);
+      sensitive << queue;
+      dont_initialize();
+    }
+
+    sc_dt::uint64 triggers;
+
+  private:
+    void source()
+    {
+      for (int i = 0; i < steps; ++i)
+      {
+        if (bulk)
+          queue.notify(&delays[0], int(delays.size()));
+        else
+          for (size_t j = 0; j < delays.size(); ++j)
+            queue.notify(delays[j]);
+        wait(DELAYS, SC_NS);
+      }
+    }
+
+    void sink()
+    {
+      ++triggers;
+    }
+
+    bool                bulk;
+    int                 steps;
+    std::vector<sc_time> delays;
+    sc_event_queue      queue;
+};
+
+class timeout_cancel : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(timeout_cancel);
+
+    timeout_cancel(sc_module_name name, int rounds_)
+      : sc_module(name), woken(0), timeouts(0), triggers(0), rounds(rounds_)
+    {
+      SC_THREAD(waiter);
+      SC_THREAD(notifier);
+      SC_METHOD(sink);
+      sensitive << queue;
+      dont_initialize();
+    }
+
+    bool check() const
+      { return woken + timeouts == rounds && triggers == 2 * rounds; }
+
+    int woken;
+    int timeouts;
+    int triggers;
+
+  private:
+    void waiter()
+    {
+      for (int i = 0; i < rounds; ++i)
+      {
+        wait(SC_ZERO_TIME, ev);
+        if (timed_out())
+          ++timeouts;
+        else
+          ++woken;
+        wait(1, SC_NS);
+      }
+    }
+
+    void notifier()
+    {
+      for (int i = 0; i < rounds; ++i)
+      {
+        ev.notify(SC_ZERO_TIME);
+        queue.notify(SC_ZERO_TIME);
+        queue.notify(SC_ZERO_TIME);
+        wait(1, SC_NS);
+      }
+    }
+
+    void sink()
+    {
+      ++triggers;
+    }
+
+    int            rounds;
+    sc_event       ev;
+    sc_event_queue queue;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  bool bulk  = argc > 1 && std::strcmp(argv[1], "bulk") == 0;
+  int  burst = argc > 2 ? atoi(argv[2]) : 1000;
+  int  steps = argc > 3 ? atoi(argv[3]) : 1000;
+
+  if (burst < 1) burst = 1;
+  if (steps < 1) steps = 1;
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  interrupts top("Interrupts1", bulk, burst, steps);
+  timeout_cancel cancel("TimeoutCancel", 10);
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start();
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+  sc_dt::uint64 expected = sc_dt::uint64(burst) * steps;
+  bool ok = top.triggers == expected && cancel.check();
+
+  cout << "Burst: " << burst << ", time steps: " << steps
+       << (bulk ? ", bulk" : ", single") << " notification" << endl;
+  cout << "Triggers: " << top.triggers << ", woken: " << cancel.woken
+       << ", timeouts: " << cancel.timeouts
+       << ", errors: " << !ok << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per notification: "
+       << sim.count() * 1e9 / double(expected) << " ns" << endl;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,193 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  fifo_perf.cpp -- FIFO streaming performance example.
+
+                   A producer streams samples through an sc_fifo to a
+                   consumer, either one sample per call, in blocks
+                   (write( const T*, int ) and read( T*, int )) or in
+                   place through the zero-copy windows of the channel
+                   (write_window()/commit_write() and
+                   read_window()/commit_read()).
+
+                   Usage:
+
+                     fifo_perf [single|block|window [samples [block]]]
+
+                   The defaults are block transfers, 10000000 samples and
+                   blocks of 64 samples through a FIFO of 256 entries. To
+                   compare run e.g.
+
+                     ./fifo_perf single
+                     ./fifo_perf block
+                     ./fifo_perf window
+
+                   The wall clock time varies from run to run, therefore
+                   there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+enum transfer_mode { SINGLE, BLOCK, WINDOW };
+
+SC_MODULE(stream)
+{
+  sc_fifo<int> fifo;
+
+  SC_HAS_PROCESS(stream);
+
+  stream(sc_module_name name, transfer_mode mode_, int samples_, int block_)
+    : sc_module(name), fifo("fifo", 256), mode(mode_)
+    , samples(samples_), block(block_), sum(0)
+  {
+    SC_THREAD(producer);
+    SC_THREAD(consumer);
+  }
+
+  transfer_mode  mode;
+  int            samples;
+  int            block;
+  sc_dt::uint64  sum;
+
+  void producer()
+  {
+    std::vector<int> buf(block);
+    int i = 0;
+    while (i < samples)
+    {
+      int n = std::min(block, samples - i);
+      switch (mode)
+      {
+        case SINGLE:
+          for (int k = 0; k < n; ++k)
+            fifo.write(i + k);
+          break;
+        case BLOCK:
+          for (int k = 0; k < n; ++k)
+            buf[k] = i + k;
+          fifo.write(&buf[0], n);
+          break;
+        case WINDOW:
+        {
+          int* p;
+          int m;
+          while ((m = fifo.write_window(p)) == 0)
+            wait(fifo.data_read_event());
+          n = std::min(n, m);
+          for (int k = 0; k < n; ++k)
+            p[k] = i + k;
+          fifo.commit_write(n);
+          break;
+        }
+      }
+      i += n;
+    }
+  }
+
+  void consumer()
+  {
+    std::vector<int> buf(block);
+    int i = 0;
+    while (i < samples)
+    {
+      int n = std::min(block, samples - i);
+      switch (mode)
+      {
+        case SINGLE:
+          for (int k = 0; k < n; ++k)
+            sum += fifo.read();
+          break;
+        case BLOCK:
+          fifo.read(&buf[0], n);
+          for (int k = 0; k < n; ++k)
+            sum += buf[k];
+          break;
+        case WINDOW:
+        {
+          int* p;
+          int m;
+          while ((m = fifo.read_window(p)) == 0)
+            wait(fifo.data_written_event());
+          n = std::min(n, m);
+          for (int k = 0; k < n; ++k)
+            sum += p[k];
+          fifo.commit_read(n);
+          break;
+        }
+      }
+      i += n;
+    }
+  }
+};
+
+int sc_main (int argc , char *argv[])
+{
+  transfer_mode mode = BLOCK;
+  if (argc > 1 && std::strcmp(argv[1], "single") == 0)
+    mode = SINGLE;
+  else if (argc > 1 && std::strcmp(argv[1], "window") == 0)
+    mode = WINDOW;
+  int samples = argc > 2 ? atoi(argv[2]) : 10000000;
+  int block   = argc > 3 ? atoi(argv[3]) : 64;
+
+  if (samples < 1) samples = 1;
+  if (block < 1)   block = 1;
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  stream top("Stream1", mode, samples, block);
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start();
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+  sc_dt::uint64 expected = sc_dt::uint64(samples) * (samples - 1) / 2;
+  static const char* names[] = { "single", "block", "window" };
+
+  cout << "Samples: " << samples << ", block: " << block
+       << ", " << names[mode] << " transfers" << endl;
+  cout << "Checksum: " << top.sum
+       << ", errors: " << (top.sum != expected) << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per sample: "
+       << sim.count() * 1e9 / double(samples) << " ns" << endl;
+  return top.sum == expected ? 0 : 1;
+}
@@ -0,0 +1,345 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  fxnative_perf.cpp -- Fixed-point types with native storage example.
+
+                       Checks that sc_fixed_native and sc_ufixed_native
+                       give the same values as sc_fixed and sc_ufixed for
+                       all quantization and overflow modes, for several
+                       formats and random operands. Then times a 16 tap
+                       FIR filter written with sc_fixed, sc_fixed_fast and
+                       sc_fixed_native, and checks that the three filters
+                       produce the same output.
+
+                       Usage:
+
+                         fxnative_perf [samples [checks]]
+
+                       The defaults are 20000 filter samples and 200
+                       random operands per format and mode.
+
+                       The wall clock time varies from run to run,
+                       therefore there is no golden reference output for
+                       this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_FX
+#include <systemc.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+typedef std::chrono::steady_clock host_clock;
+
+static double seconds_since(host_clock::time_point start)
+{
+  std::chrono::duration<double> d = host_clock::now() - start;
+  return d.count();
+}
+
+// xorshift64, so that every run checks the same operands
+static sc_dt::uint64 random_state = 0x9e3779b97f4a7c15ULL;
+
+static sc_dt::uint64 random64()
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 7;
+  random_state ^= random_state << 17;
+  return random_state;
+}
+
+// a random value of T, with all bits of the word used
+template <class T>
+static T random_value()
+{
+  typedef typename T::raw_type raw_type;
+  const int w = T().wl();
+  sc_dt::uint64 bits = random64();
+  if (w < 64)
+  {
+    sc_dt::uint64 mask = (~0ULL) >> (64 - w);
+    bits &= mask;
+    if (std::is_signed<raw_type>::value && (bits >> (w - 1)) != 0)
+      bits |= ~mask;
+  }
+  return T::from_raw(static_cast<raw_type>(bits));
+}
+
+// a random double with up to 53 significant bits and a random scale
+static double random_double()
+{
+  double m = static_cast<double>(random64() >> (11 + random64() % 40));
+  int e = static_cast<int>(random64() % 64) - 48;
+  return std::ldexp((random64() & 1) ? -m : m, e);
+}
+
+// the sc_fixed or sc_ufixed type of a native type
+template <int W, int I, bool S, sc_q_mode Q, sc_o_mode O, int N>
+struct reference_type
+{
+  typedef sc_fixed<W,I,Q,O,N> type;
+};
+
+template <int W, int I, sc_q_mode Q, sc_o_mode O, int N>
+struct reference_type<W,I,false,Q,O,N>
+{
+  typedef sc_ufixed<W,I,Q,O,N> type;
+};
+
+// operand formats, the exact results of their operators fit into 64 bits
+typedef sc_fixed_native<20,6>   operand_a;
+typedef sc_ufixed_native<16,10> operand_b;
+typedef sc_fixed_native<12,-3>  operand_c;
+
+static int errors = 0;
+
+template <class T, class R>
+static void compare(const char* what, const T& x, const R& y)
+{
+  if (x.value() == y.value() && x.to_int64() == y.to_int64() &&
+      x.to_double() == y.to_double())
+    return;
+  if (++errors <= 10)
+    cout << "  mismatch in " << what << " for <" << x.wl() << ","
+         << x.iwl() << "," << x.q_mode() << "," << x.o_mode() << ","
+         << x.n_bits() << ">: " << x.to_string() << " != "
+         << y.to_string() << endl;
+}
+
+// the compound arithmetic operators, for formats whose sums and products
+// with the operands stay within 64 bits
+template <class T, class R>
+static void check_compound(T x, R y, const operand_a& a,
+                           const operand_c& c, std::true_type)
+{
+  x += c;
+  y += c.value();
+  compare("+=", x, y);
+  x *= a;
+  y *= a.value();
+  compare("*=", x, y);
+  x -= a;
+  y -= a.value();
+  compare("-=", x, y);
+}
+
+template <class T, class R>
+static void check_compound(T, R, const operand_a&, const operand_c&,
+                           std::false_type)
+{}
+
+template <int W, int I, bool S, sc_q_mode Q, sc_o_mode O, int N>
+static void check(int count)
+{
+  typedef sc_fxnative<W,I,S,Q,O,N> T;
+  typedef typename reference_type<W,I,S,Q,O,N>::type R;
+
+  for (int i = 0; i < count; ++i)
+  {
+    operand_a a = random_value<operand_a>();
+    operand_b b = random_value<operand_b>();
+    operand_c c = random_value<operand_c>();
+    sc_fxval va = a.value(), vb = b.value(), vc = c.value();
+
+    T x = a;
+    R y = va;
+    compare("cast", x, y);
+
+    x = a * b;
+    y = va * vb;
+    compare("*", x, y);
+
+    x = a + b;
+    y = va + vb;
+    compare("+", x, y);
+
+    x = a - c;
+    y = va - vc;
+    compare("-", x, y);
+
+    x = -b;
+    y = -vb;
+    compare("unary -", x, y);
+
+    double d = random_double();
+    x = d;
+    y = d;
+    compare("double", x, y);
+
+    int k = static_cast<int>(random64());
+    x = k;
+    y = k;
+    compare("int", x, y);
+
+    int n = static_cast<int>(random64() % 24);
+    x = b;
+    y = vb;
+    x <<= n;
+    y <<= n;
+    compare("<<=", x, y);
+    x = a;
+    y = va;
+    x >>= n;
+    y >>= n;
+    compare(">>=", x, y);
+
+    x = a;
+    y = va;
+    check_compound(x, y, a, c, std::integral_constant<bool, (W <= 40)>());
+  }
+}
+
+template <int W, int I, bool S, sc_q_mode Q>
+static void check_overflow_modes(int count)
+{
+  check<W,I,S,Q,SC_SAT,0>(count);
+  check<W,I,S,Q,SC_SAT_ZERO,0>(count);
+  check<W,I,S,Q,SC_SAT_SYM,0>(count);
+  check<W,I,S,Q,SC_WRAP,0>(count);
+  check<W,I,S,Q,SC_WRAP,1>(count);
+  check<W,I,S,Q,SC_WRAP,3>(count);
+  if (S) // SC_WRAP_SM is not defined for unsigned types
+  {
+    check<W,I,S,Q,SC_WRAP_SM,0>(count);
+    check<W,I,S,Q,SC_WRAP_SM,1>(count);
+    check<W,I,S,Q,SC_WRAP_SM,3>(count);
+  }
+}
+
+template <int W, int I, bool S>
+static void check_modes(int count)
+{
+  check_overflow_modes<W,I,S,SC_RND>(count);
+  check_overflow_modes<W,I,S,SC_RND_ZERO>(count);
+  check_overflow_modes<W,I,S,SC_RND_MIN_INF>(count);
+  check_overflow_modes<W,I,S,SC_RND_INF>(count);
+  check_overflow_modes<W,I,S,SC_RND_CONV>(count);
+  check_overflow_modes<W,I,S,SC_TRN>(count);
+  check_overflow_modes<W,I,S,SC_TRN_ZERO>(count);
+}
+
+static void check_relational(int count)
+{
+  for (int i = 0; i < count; ++i)
+  {
+    operand_a a = random_value<operand_a>();
+    operand_b b = random_value<operand_b>();
+    sc_fxval va = a.value(), vb = b.value();
+    if ((a < b) != (va < vb) || (a <= b) != (va <= vb) ||
+        (a > b) != (va > vb) || (a >= b) != (va >= vb) ||
+        (a == b) != (va == vb) || (a != b) != (va != vb) ||
+        (a == a) != true)
+      ++errors;
+  }
+}
+
+// a 16 tap FIR filter over the samples, with the accumulator and the
+// output formats of a typical DSP datapath
+template <class coef_type, class acc_type, class out_type>
+static double fir(const std::vector<double>& coefs,
+                  const std::vector<double>& samples,
+                  std::vector<double>& out)
+{
+  const int taps = static_cast<int>(coefs.size());
+  std::vector<coef_type> c(coefs.begin(), coefs.end());
+  std::vector<coef_type> x(taps);
+  std::vector<coef_type> in(samples.begin(), samples.end());
+
+  out.resize(samples.size());
+  host_clock::time_point start = host_clock::now();
+  for (size_t n = 0; n < in.size(); ++n)
+  {
+    for (int k = taps - 1; k > 0; --k)
+      x[k] = x[k - 1];
+    x[0] = in[n];
+    acc_type acc = 0;
+    for (int k = 0; k < taps; ++k)
+      acc += c[k] * x[k];
+    out_type y = acc;
+    out[n] = y.to_double();
+  }
+  return seconds_since(start);
+}
+
+int sc_main (int argc , char *argv[])
+{
+  int samples = argc > 1 ? atoi(argv[1]) : 20000;
+  int checks = argc > 2 ? atoi(argv[2]) : 200;
+  if (samples < 1) samples = 1;
+  if (checks < 1) checks = 1;
+
+  check_modes<8,4,true>(checks);
+  check_modes<8,4,false>(checks);
+  check_modes<5,0,true>(checks);
+  check_modes<12,-2,true>(checks);
+  check_modes<16,16,false>(checks);
+  check_modes<24,30,true>(checks);
+  check_modes<40,12,true>(checks);
+  check_modes<63,20,true>(checks);
+  check_modes<64,33,false>(checks);
+  check_modes<64,10,true>(checks);
+  check_relational(checks);
+  cout << "Equivalence errors: " << errors << endl;
+
+  std::vector<double> coefs(16), in(samples);
+  for (size_t k = 0; k < coefs.size(); ++k)
+    coefs[k] = random_value<sc_fixed_native<16,1> >().to_double();
+  for (int n = 0; n < samples; ++n)
+    in[n] = random_value<sc_fixed_native<16,1> >().to_double();
+
+  std::vector<double> ref, fast, native;
+  double t_ref = fir<sc_fixed<16,1>, sc_fixed<40,8>,
+                     sc_fixed<16,1,SC_RND,SC_SAT> >(coefs, in, ref);
+  double t_fast = fir<sc_fixed_fast<16,1>, sc_fixed_fast<40,8>,
+                      sc_fixed_fast<16,1,SC_RND,SC_SAT> >(coefs, in, fast);
+  double t_native = fir<sc_fixed_native<16,1>, sc_fixed_native<40,8>,
+                        sc_fixed_native<16,1,SC_RND,SC_SAT> >(coefs, in,
+                                                              native);
+
+  int fir_errors = 0;
+  for (int n = 0; n < samples; ++n)
+    if (fast[n] != ref[n] || native[n] != ref[n])
+      ++fir_errors;
+
+  double macs = 16.0 * samples;
+  cout << "FIR, 16 taps, " << samples << " samples:" << endl;
+  cout << "  sc_fixed:        " << t_ref * 1e9 / macs << " ns/tap" << endl;
+  cout << "  sc_fixed_fast:   " << t_fast * 1e9 / macs << " ns/tap" << endl;
+  cout << "  sc_fixed_native: " << t_native * 1e9 / macs << " ns/tap"
+       << endl;
+  cout << "  output errors: " << fir_errors << endl;
+
+  return (errors || fir_errors) ? 1 : 0;
+}
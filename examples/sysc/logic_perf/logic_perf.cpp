@@ -0,0 +1,152 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  logic_perf.cpp -- Logic and bit vector operation performance example.
+
+                    Times the bitwise operations (and, or, xor, not), the
+                    reductions, shifts and rotates and is_01() on sc_lv_base
+                    and sc_bv_base vectors of widths from 64 to 65536 bits.
+                    The results are checked against identities of the
+                    operations, e.g. x & x == x or x ^ x == 0.
+
+                    Usage:
+
+                      logic_perf [iterations]
+
+                    The number of iterations (default 1000) is scaled down
+                    with the width, so that every width processes about the
+                    same number of bits.
+
+                    The wall clock time varies from run to run, therefore
+                    there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cstdlib>
+
+typedef std::chrono::steady_clock host_clock;
+
+static double ns_per_op(host_clock::time_point start, int count)
+{
+  std::chrono::duration<double> d = host_clock::now() - start;
+  return d.count() * 1e9 / count;
+}
+
+// print the time per operation, timing 'count' calls of 'op'
+#define TIME(name, count, op)                                            \
+  do {                                                                   \
+    host_clock::time_point start = host_clock::now();                    \
+    for (int n_ = 0; n_ < (count); ++n_) { op; }                         \
+    cout << "  " << name << ": " << ns_per_op(start, count) << " ns" << endl; \
+  } while (false)
+
+// random 0/1 bits; a four valued vector gets an X in its msb, so that
+// is_01() has to look at all words
+template <class V>
+static void randomize(V& v, bool four_valued)
+{
+  for (int i = 0; i < v.length(); ++i)
+    v[i] = sc_logic(std::rand() % 2);
+  if (four_valued)
+    v[v.length() - 1] = SC_LOGIC_X;
+}
+
+// the results of the reductions are stored here, so that they are computed
+static volatile int sink;
+
+// flip bit 1 of word n of v, so that the compiler cannot move the
+// reductions of an unchanged v (or of its unchanged words) out of the
+// timing loops
+template <class V>
+inline void touch(V& v, int n)
+{
+  int i = n % v.size();
+  v.set_word(i, v.get_word(i) ^ 2);
+}
+
+template <class V>
+static int run(const char* kind, int width, int iterations, bool four_valued)
+{
+  V x(width), y(width), z(width);
+  randomize(x, four_valued);
+  randomize(y, four_valued);
+  int errors = 0;
+
+  cout << kind << " width " << width << ":" << endl;
+  TIME("and", iterations, z = x; z &= y);
+  TIME("or", iterations, z = x; z |= y);
+  TIME("xor", iterations, z = x; z ^= y);
+  TIME("not", iterations, z = x; z.b_not());
+  TIME("and_reduce", iterations, touch(x, n_); sink = x.and_reduce());
+  TIME("or_reduce", iterations, touch(x, n_); sink = x.or_reduce());
+  TIME("xor_reduce", iterations, touch(x, n_); sink = x.xor_reduce());
+  TIME("is_01", iterations, touch(x, n_); sink = x.is_01());
+  TIME("shift", iterations, z = x; z <<= 13; z >>= 7);
+  TIME("rotate", iterations, z = x; z.lrotate(width / 3 + 1));
+
+  // checks: rotating left and right by the same amount and an and with
+  // itself restore x; x ^ x is all zeros for two-valued x
+  z = x;
+  z.lrotate(5);
+  z.rrotate(5);
+  if (z != x)
+    ++errors;
+  z = x;
+  z &= x;
+  if (z != x)
+    ++errors;
+  if (!four_valued) {
+    z = x;
+    z ^= x;
+    if (z.or_reduce() != 0)
+      ++errors;
+  }
+  cout << "  errors: " << errors << endl;
+  return errors;
+}
+
+int sc_main (int argc , char *argv[])
+{
+  int iterations = argc > 1 ? atoi(argv[1]) : 1000;
+  if (iterations < 1) iterations = 1;
+
+  int errors = 0;
+  for (int width = 64; width <= 65536; width *= 4)
+  {
+    int n = iterations * 64 / width > 10 ? iterations * 64 / width : 10;
+    errors += run<sc_lv_base>("sc_lv_base", width, n * 10, true);
+    errors += run<sc_bv_base>("sc_bv_base", width, n * 10, false);
+  }
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,182 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  mutex_perf.cpp -- Mutex and semaphore contention example.
+
+                    A large number of threads repeatedly acquire a shared
+                    sc_mutex, or a sc_semaphore with a few units, hold it
+                    for a nanosecond and release it again. The context
+                    switches are taken from the scheduler profile (see
+                    sc_set_profiling()), which is recorded for the run, so
+                    the wasted resumptions of waiters that lose the race for
+                    the resource show up per acquire.
+
+                    Usage:
+
+                      mutex_perf [mutex|semaphore [competing|fifo
+                                 [threads [acquires]]]]
+
+                    The defaults are a mutex with competing waiters, 1000
+                    threads and 10 acquires per thread. To compare run e.g.
+
+                      ./mutex_perf mutex competing
+                      ./mutex_perf mutex fifo
+                      ./mutex_perf semaphore fifo
+
+                    The wall clock time varies from run to run, therefore
+                    there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+static const int UNITS = 4; // units of the semaphore
+
+class contention : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(contention);
+
+    contention(sc_module_name name, bool semaphore_,
+               sc_fairness_policy policy, int threads, int acquires_)
+      : sc_module(name), acquired(0), max_holders(0)
+      , semaphore(semaphore_), acquires(acquires_), holders(0)
+      , mutex("mutex", policy), units("units", UNITS, policy)
+    {
+      for (int i = 0; i < threads; ++i)
+        sc_spawn(sc_bind(&contention::worker, this));
+    }
+
+    sc_dt::uint64 acquired;
+    int           max_holders;
+
+  private:
+    void worker()
+    {
+      for (int i = 0; i < acquires; ++i)
+      {
+        if (semaphore)
+          units.wait();
+        else
+          mutex.lock();
+        ++acquired;
+        if (++holders > max_holders)
+          max_holders = holders;
+        wait(1, SC_NS);
+        --holders;
+        if (semaphore)
+          units.post();
+        else
+          mutex.unlock();
+      }
+    }
+
+    bool         semaphore;
+    int          acquires;
+    int          holders;
+    sc_mutex     mutex;
+    sc_semaphore units;
+};
+
+// total activations of the processes, read from the written profile
+
+static sc_dt::uint64 profiled_activations()
+{
+  const char* basename = "mutex_perf_profile";
+  sc_dt::uint64 activations = 0;
+  if (sc_write_profile(basename))
+  {
+    std::ifstream is((std::string(basename) + ".json").c_str());
+    std::string   line;
+    while (std::getline(is, line))
+      if (line.compare(0, 14, "\"activations\":") == 0)
+      {
+        activations = strtoull(line.c_str() + 14, 0, 10);
+        break;
+      }
+    const char* suffixes[] =
+      { ".json", ".csv", ".deltas.csv", ".timesteps.csv" };
+    for (int i = 0; i < 4; ++i)
+      std::remove((std::string(basename) + suffixes[i]).c_str());
+  }
+  return activations;
+}
+
+int sc_main (int argc , char *argv[])
+{
+  bool semaphore = argc > 1 && std::strcmp(argv[1], "semaphore") == 0;
+  bool fifo      = argc > 2 && std::strcmp(argv[2], "fifo") == 0;
+  int  threads   = argc > 3 ? atoi(argv[3]) : 1000;
+  int  acquires  = argc > 4 ? atoi(argv[4]) : 10;
+
+  if (threads < 1)  threads = 1;
+  if (acquires < 1) acquires = 1;
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  contention top("Contention1", semaphore,
+                 fifo ? SC_FIFO_WAITERS : SC_COMPETING_WAITERS,
+                 threads, acquires);
+
+  sc_set_profiling(true);
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start();
+  host_clock::time_point end = host_clock::now();
+  sc_set_profiling(false);
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+  sc_dt::uint64 expected = sc_dt::uint64(threads) * acquires;
+  sc_dt::uint64 switches = profiled_activations();
+  int           limit    = semaphore ? UNITS : 1;
+  bool          errors   = top.acquired != expected || top.max_holders > limit;
+
+  cout << "Threads: " << threads << ", acquires per thread: " << acquires
+       << (semaphore ? ", semaphore" : ", mutex")
+       << (fifo ? ", fifo" : ", competing") << " waiters" << endl;
+  cout << "Acquires: " << top.acquired << ", errors: " << errors << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per acquire: "
+       << sim.count() * 1e9 / double(expected) << " ns" << endl;
+  if (switches)
+    cout << "Context switches per acquire: "
+         << double(switches) / double(expected) << endl;
+  return errors ? 1 : 0;
+}
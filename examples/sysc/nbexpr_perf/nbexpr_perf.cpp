@@ -0,0 +1,267 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  nbexpr_perf.cpp -- Exact sc_bigint/sc_biguint operators example.
+
+                     Checks that +, - and * on sc_bigint<W> and
+                     sc_biguint<W> operands give the same values as the
+                     sc_signed and sc_unsigned operators, for several
+                     widths and random operands, and that the results
+                     are ordinary values (methods, bit and part selects,
+                     stream output, results bound to references and kept
+                     in auto variables). Then evaluates a*b + c*d - e on
+                     sc_biguint<256> operands both ways and reports the
+                     time and the number of digit vectors allocated on
+                     the heap (vec_new_count()) per evaluation.
+
+                     Usage:
+
+                       nbexpr_perf [iterations [checks]]
+
+                     The defaults are 100000 iterations and 200 random
+                     operands per width.
+
+                     The wall clock time varies from run to run,
+                     therefore there is no golden reference output for
+                     this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+
+typedef std::chrono::steady_clock host_clock;
+
+static double seconds_since(host_clock::time_point start)
+{
+  std::chrono::duration<double> d = host_clock::now() - start;
+  return d.count();
+}
+
+// fill v with pseudo random bits, with a random number of leading zeros
+static void randomize(sc_signed& v)
+{
+  int bits = v.length() - std::rand() % (v.length() / 4 + 1);
+  v = 0;
+  for (int i = 0; i < bits; ++i)
+    v[i] = (std::rand() >> 7) & 1;
+}
+
+static void randomize(sc_unsigned& v)
+{
+  int bits = v.length() - std::rand() % (v.length() / 4 + 1);
+  v = 0;
+  for (int i = 0; i < bits; ++i)
+    v[i] = (std::rand() >> 7) & 1;
+}
+
+static int errors = 0;
+
+static void check(const char* what, int width,
+                  const sc_signed& x, const sc_signed& ref)
+{
+  if (x == ref)
+    return;
+  if (++errors <= 10)
+    cout << "  mismatch in " << what << " for width " << width << ": "
+         << x << " != " << ref << endl;
+}
+
+// the results use the sc_bigint/sc_biguint operands, the reference values
+// the sc_signed/sc_unsigned operators on the same operands
+template <int W>
+static void check_width(int count)
+{
+  sc_biguint<W> a, b, c;
+  sc_bigint<W> s, t;
+  for (int i = 0; i < count; ++i)
+  {
+    randomize(a);
+    randomize(b);
+    randomize(c);
+    randomize(s);
+    randomize(t);
+    const sc_unsigned& ua = a;
+    const sc_unsigned& ub = b;
+    const sc_unsigned& uc = c;
+    const sc_signed& ss = s;
+    const sc_signed& st = t;
+
+    sc_bigint<2 * W + 4> x = a * b + c * a - b;
+    check("a*b + c*a - b", W, x, ua * ub + uc * ua - ub);
+
+    x = s * t - a * s + c;
+    check("s*t - a*s + c", W, x, ss * st - ua * ss + uc);
+
+    x = (a - s) * (t + c);
+    check("(a - s)*(t + c)", W, x, (ua - ss) * (st + uc));
+
+    x = a * b;
+    check("a*b", W, x, ua * ub);
+
+    // wrap-around to the width of the variable, signed and unsigned
+    sc_biguint<W> y = a * b - c;
+    check("wrapped a*b - c", W, sc_bigint<W + 1>(y),
+          sc_bigint<W + 1>(sc_biguint<W>(ua * ub - uc)));
+    sc_bigint<W> z = s * s - a;
+    check("wrapped s*s - a", W, z, sc_bigint<W>(ss * ss - ua));
+
+    // the destination is also an operand
+    sc_bigint<W> r = s;
+    r = r * t + r;
+    check("r = r*t + r", W, r, sc_bigint<W>(ss * st + ss));
+
+    // mixed with sc_unsigned and int, through the conversion
+    sc_signed m = (a * b) + uc - 3;
+    check("(a*b) + c - 3", W, m, ua * ub + uc - 3);
+  }
+}
+
+// the results used like the results of the sc_signed/sc_unsigned operators
+static void check_values()
+{
+  sc_biguint<40> a = 0x123456789ULL, b = 0xfedcba987ULL;
+  sc_bigint<40> c = -0x55aa55aaLL, d = 0x0f0f0f0fLL;
+  const sc_unsigned& ua = a;
+  const sc_unsigned& ub = b;
+  const sc_signed& sc = c;
+  const sc_signed& sd = d;
+
+  if ((a * b).to_string(SC_HEX) != (ua * ub).to_string(SC_HEX) ||
+      (a + b).to_int() != (ua + ub).to_int() ||
+      (a + b).to_uint64() != (ua + ub).to_uint64() ||
+      (c * d).to_double() != (sc * sd).to_double() ||
+      (a + b)[8] != (ua + ub)[8] ||
+      (a + b).bit(33).to_bool() != (ua + ub).bit(33).to_bool() ||
+      (c - d).range(3, 0) != (sc - sd).range(3, 0) ||
+      (c - d)(20, 4).to_uint() != (sc - sd)(20, 4).to_uint() ||
+      (a - b).sign() != (ua - ub).sign() ||
+      (a - a).iszero() != true ||
+      (c * d).xor_reduce() != (sc * sd).xor_reduce())
+    ++errors;
+
+  // comparisons and operations with other types
+  if ((a + b) != (ua + ub) || !(c * d < 0) || (a + b) + 1 != ua + ub + 1 ||
+      -(c + d) != -(sc + sd) || ((a * b) >> 3) != ((ua * ub) >> 3) ||
+      ((c + d) & 0xff) != ((sc + sd) & 0xff))
+    ++errors;
+
+  sc_unsigned u = a + b;
+  sc_signed v = c - a;
+  if (u != ua + ub || v != sc - ua)
+    ++errors;
+
+  // the results are values, evaluated when the operators are called
+  auto x = a + sc_biguint<8>(1);
+  auto y = x * c;
+  if (x != ua + 1 || y != (ua + 1) * sc)
+    ++errors;
+
+  sc_biguint<8> p = 25, q = 28;
+  const sc_unsigned& rp = p * q;
+  const sc_signed& rd = p - q;
+  auto prod = p * q;
+  p = 0;
+  if (rp != 700 || rd != -3 || prod != 700 || p * q != 0)
+    ++errors;
+
+  prod += 1;
+  x = prod * d;
+  if (prod != 701 || x.to_uint64() != 701 * 0x0f0f0f0fULL)
+    ++errors;
+
+  std::ostringstream out, ref;
+  out << (a * b) << " " << (c - d);
+  ref << (ua * ub) << " " << (sc - sd);
+  if (out.str() != ref.str())
+    ++errors;
+}
+
+int sc_main (int argc , char *argv[])
+{
+  int iterations = argc > 1 ? atoi(argv[1]) : 100000;
+  int checks = argc > 2 ? atoi(argv[2]) : 200;
+  if (iterations < 1) iterations = 1;
+  if (checks < 1) checks = 1;
+
+  check_width<1>(checks);
+  check_width<7>(checks);
+  check_width<29>(checks);
+  check_width<30>(checks);
+  check_width<31>(checks);
+  check_width<64>(checks);
+  check_width<100>(checks);
+  check_width<256>(checks);
+  check_width<1000>(checks);
+  check_values();
+  cout << "Equivalence errors: " << errors << endl;
+
+  sc_biguint<256> a, b, c, d, e;
+  randomize(a);
+  randomize(b);
+  randomize(c);
+  randomize(d);
+  randomize(e);
+  const sc_unsigned& ua = a;
+  const sc_unsigned& ub = b;
+  const sc_unsigned& uc = c;
+  const sc_unsigned& ud = d;
+  const sc_unsigned& ue = e;
+
+  sc_bigint<520> r;
+  sc_dt::uint64 allocs = sc_dt::vec_new_count();
+  host_clock::time_point start = host_clock::now();
+  for (int n = 0; n < iterations; ++n)
+    r = ua * ub + uc * ud - ue;
+  double t_ref = seconds_since(start);
+  double a_ref = double(sc_dt::vec_new_count() - allocs) / iterations;
+  sc_bigint<520> ref = r;
+
+  allocs = sc_dt::vec_new_count();
+  start = host_clock::now();
+  for (int n = 0; n < iterations; ++n)
+    r = a * b + c * d - e;
+  double t_expr = seconds_since(start);
+  double a_expr = double(sc_dt::vec_new_count() - allocs) / iterations;
+  if (r != ref)
+    ++errors;
+
+  cout << "a*b + c*d - e on sc_biguint<256>:" << endl;
+  cout << "  sc_unsigned operators: " << t_ref * 1e9 / iterations
+       << " ns, " << a_ref << " allocations" << endl;
+  cout << "  sc_biguint operators:  " << t_expr * 1e9 / iterations
+       << " ns, " << a_expr << " allocations" << endl;
+
+  return errors ? 1 : 0;
+}
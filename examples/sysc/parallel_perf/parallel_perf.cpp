@@ -0,0 +1,228 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  parallel_perf.cpp -- Parallel evaluation performance example.
+
+                       The system being modeled is a ring of processing
+                       elements. Each element is an SC_METHOD triggered by
+                       the rising edge of a common clock. It combines the
+                       output of its predecessor with its private state,
+                       performs a configurable amount of computation and
+                       writes the result to its output signal.
+
+                       All elements are declared as isolated, so the kernel
+                       may execute them concurrently when parallel
+                       evaluation is enabled. At the end of the simulation
+                       the outputs are compared against a plain C++ model of
+                       the ring to show that the result does not depend on
+                       the number of host threads.
+
+                       Every element also has an isolated SC_METHOD
+                       without static sensitivity that uses next_trigger()
+                       with events, event lists and timeouts to run every
+                       5 ns, and checks the time of each activation.
+
+                       Usage:
+
+                         parallel_perf [threads [elements [cycles [work]]]]
+
+                       The defaults are 4 threads, 64 elements, 1000 cycles
+                       and 2000 units of work per activation. To obtain a
+                       scaling curve run the example repeatedly, e.g.
+
+                         for t in 1 2 4 8; do ./parallel_perf $t 256; done
+
+                       The wall clock time varies from run to run, therefore
+                       there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <vector>
+
+static sc_dt::uint64 compute( sc_dt::uint64 state, sc_dt::uint64 in, int work )
+{
+  sc_dt::uint64 x = state ^ ( in + 0x9e3779b97f4a7c15ULL );
+  for ( int i = 0; i < work; ++i )
+  {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+  }
+  return x;
+}
+
+class element : public sc_module
+{
+  public:
+    sc_in<bool>            clk;
+    sc_in<sc_dt::uint64>   in;
+    sc_out<sc_dt::uint64>  out;
+
+    SC_HAS_PROCESS(element);
+
+    element(sc_module_name name, sc_dt::uint64 seed, int work_)
+      : sc_module(name), state(seed), activations(0), ticks(0),
+        tick_errors(0), work(work_)
+    {
+      SC_METHOD(main);
+      sensitive << clk.pos();
+      dont_initialize();
+      set_isolated();
+
+      SC_METHOD(tick);
+      set_isolated();
+    }
+
+    void main()
+    {
+      state = compute( state, in.read(), work );
+      out.write( state );
+      ++activations;
+    }
+
+    // activation n happens at n * 5 ns, on the edges of the clock
+    void tick()
+    {
+      if (sc_time_stamp() != sc_time(5.0 * ticks, SC_NS))
+        ++tick_errors;
+      switch (ticks++ % 4)
+      {
+        case 0: // rising edge
+          next_trigger(clk->negedge_event());
+          break;
+        case 1: // falling edge
+          next_trigger(sc_time(5, SC_NS));
+          break;
+        case 2: // rising edge
+          next_trigger(sc_time(7, SC_NS), clk->negedge_event() | never);
+          break;
+        case 3: // falling edge
+          next_trigger(sc_time(5, SC_NS), never);
+          break;
+      }
+    }
+
+    sc_dt::uint64 state;
+    int           activations;
+    int           ticks;
+    int           tick_errors;
+
+  private:
+    int           work;
+    sc_event      never;
+};
+
+class ring : public sc_module
+{
+  public:
+    sc_in<bool> clk;
+
+    ring(sc_module_name name, int elements, int work)
+      : sc_module(name)
+      , pe("pe", elements, pe_creator(work))
+      , links("link", elements)
+    {
+      for ( int i = 0; i < elements; ++i )
+      {
+        pe[i].clk(clk);
+        pe[i].in(links[(i + elements - 1) % elements]);
+        pe[i].out(links[i]);
+      }
+    }
+
+    struct pe_creator
+    {
+      explicit pe_creator(int w) : work(w) {}
+      element* operator()(const char* name, size_t i)
+        { return new element(name, i + 1, work); }
+      int work;
+    };
+
+    sc_vector<element>                       pe;
+    sc_vector< sc_signal<sc_dt::uint64> >    links;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  int threads  = argc > 1 ? atoi(argv[1]) : 4;
+  int elements = argc > 2 ? atoi(argv[2]) : 64;
+  int cycles   = argc > 3 ? atoi(argv[3]) : 1000;
+  int work     = argc > 4 ? atoi(argv[4]) : 2000;
+
+  if (threads < 1)  threads = 1;
+  if (elements < 2) elements = 2;
+  if (cycles < 1)   cycles = 1;
+
+  sc_set_parallel_evaluation(threads);
+
+  sc_clock clk("clk", 10, SC_NS);
+  ring     ring1("Ring1", elements, work);
+  ring1.clk(clk);
+
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+  sc_start(sc_time(10.0 * cycles - 5.0, SC_NS));
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  // reference model of the ring
+
+  std::vector<sc_dt::uint64> state(elements), out(elements, 0), next(elements);
+  for (int i = 0; i < elements; ++i)
+    state[i] = i + 1;
+  for (int c = 0; c < ring1.pe[0].activations; ++c)
+  {
+    for (int i = 0; i < elements; ++i)
+      next[i] = state[i] = compute(state[i], out[(i + elements - 1) % elements], work);
+    out.swap(next);
+  }
+
+  int errors = 0;
+  for (int i = 0; i < elements; ++i)
+  {
+    if (ring1.pe[i].activations != cycles || ring1.links[i].read() != out[i])
+      ++errors;
+    // the simulation ends before the last falling edge
+    if (ring1.pe[i].ticks != 2 * cycles - 1 || ring1.pe[i].tick_errors != 0)
+      ++errors;
+  }
+
+  cout << "Host threads: " << sc_get_parallel_evaluation() << endl;
+  cout << "Processing elements: " << elements << endl;
+  cout << "Clock cycles: " << cycles << endl;
+  cout << "Work per activation: " << work << endl;
+  cout << "Mismatches against reference model: " << errors << endl;
+  cout << "Wall clock time: " << elapsed.count() << " s" << endl;
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,210 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  profile_perf.cpp -- Scheduler profiler example.
+
+                      A producer thread writes a fifo on every rising clock
+                      edge, a consumer thread reads it, and a method counts
+                      the clock edges. The model is simulated once without
+                      and once with the scheduler profiler enabled (see
+                      sc_set_profiling), and the host time of both halves
+                      is reported.
+
+                      The recorded profile is written (see sc_write_profile)
+                      and the activations of the method and the threads in
+                      the process table are compared with the numbers of
+                      activations counted during the profiled half.
+
+                      Usage:
+
+                        profile_perf [cycles [basename]]
+
+                      The default is 100000 clock cycles per half. The
+                      profile is written to profile_perf.* and removed
+                      afterwards, unless a basename is given.
+
+                      The wall clock time varies from run to run, therefore
+                      there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+class top : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(top);
+
+    top(sc_module_name name)
+      : sc_module(name), edges(0), produced(0), consumed(0), errors(0),
+        clk("clk", 10, SC_NS), fifo("fifo", 4)
+    {
+      SC_METHOD(tick);
+      sensitive << clk.posedge_event();
+      dont_initialize();
+
+      SC_THREAD(producer);
+      sensitive << clk.posedge_event();
+
+      SC_THREAD(consumer);
+    }
+
+    void tick() { ++edges; }
+
+    void producer()
+    {
+      for (;;)
+      {
+        wait();
+        fifo.write(produced++);
+      }
+    }
+
+    void consumer()
+    {
+      for (;;)
+      {
+        if (fifo.read() != consumed)
+          ++errors;
+        ++consumed;
+      }
+    }
+
+    long         edges;
+    long         produced;
+    long         consumed;
+    int          errors;
+
+  private:
+    sc_clock     clk;
+    sc_fifo<int> fifo;
+};
+
+// activations of a process in the process table of the profile, or -1
+
+static long profiled_activations(const std::string& file_name,
+                                 const std::string& process)
+{
+  std::ifstream is(file_name.c_str());
+  std::string   prefix = "\"" + process + "\",";
+  std::string   line;
+  while (std::getline(is, line))
+  {
+    if (line.compare(0, prefix.size(), prefix) != 0)
+      continue;
+    // name,kind,activations,...
+    std::string::size_type kind = line.find(',', prefix.size());
+    if (kind == std::string::npos)
+      return -1;
+    return atol(line.c_str() + kind + 1);
+  }
+  return -1;
+}
+
+static int count_lines(const std::string& file_name)
+{
+  std::ifstream is(file_name.c_str());
+  std::string   line;
+  int           lines = 0;
+  while (std::getline(is, line))
+    ++lines;
+  return lines;
+}
+
+int sc_main (int argc , char *argv[])
+{
+  int         cycles   = argc > 1 ? atoi(argv[1]) : 100000;
+  bool        keep     = argc > 2;
+  std::string basename = keep ? argv[2] : "profile_perf";
+
+  if (cycles < 1) cycles = 1;
+
+  top t("Top");
+  sc_time half = sc_time(10, SC_NS) * double(cycles);
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+  sc_start(half);
+  host_clock::time_point profiled = host_clock::now();
+
+  long edges = t.edges, produced = t.produced, consumed = t.consumed;
+
+  sc_set_profiling(true);
+  bool enabled = sc_get_profiling();
+  sc_start(half);
+  sc_set_profiling(false);
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> plain = profiled - start;
+  std::chrono::duration<double> with  = end - profiled;
+
+  int errors = t.errors;
+  if (!enabled || sc_get_profiling())
+    ++errors;
+
+  // the method and the producer thread are activated on every edge, the
+  // consumer thread whenever it has waited for a value
+  if (!sc_write_profile(basename.c_str()))
+    ++errors;
+  std::string csv = basename + ".csv";
+  long ticks     = profiled_activations(csv, "Top.tick");
+  long producers = profiled_activations(csv, "Top.producer");
+  long consumers = profiled_activations(csv, "Top.consumer");
+  if (ticks != t.edges - edges
+      || producers != t.produced - produced
+      || consumers < t.consumed - consumed)
+    ++errors;
+  if (count_lines(basename + ".deltas.csv") < 2
+      || count_lines(basename + ".timesteps.csv") < 2
+      || count_lines(basename + ".json") < 1)
+    ++errors;
+
+  if (!keep)
+  {
+    std::remove((basename + ".json").c_str());
+    std::remove((basename + ".csv").c_str());
+    std::remove((basename + ".deltas.csv").c_str());
+    std::remove((basename + ".timesteps.csv").c_str());
+  }
+
+  cout << "Clock cycles: " << cycles << " x 2" << endl;
+  cout << "Profiled activations: " << ticks << " (tick), " << producers
+       << " (producer), " << consumers << " (consumer)" << endl;
+  cout << "Errors: " << errors << endl;
+  cout << "Time without profiling: " << plain.count() << " s" << endl;
+  cout << "Time with profiling: " << with.count() << " s" << endl;
+  return errors ? 1 : 0;
+}
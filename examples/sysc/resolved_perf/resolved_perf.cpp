@@ -0,0 +1,160 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  resolved_perf.cpp -- Resolved signal performance example.
+
+                       A number of drivers write a wide sc_signal_rv bus and
+                       an sc_signal_resolved line on every rising clock
+                       edge. Each driver owns a share of the bus bits and
+                       leaves the others at Z; now and then two drivers
+                       collide, which resolves to X. On every 100th falling
+                       edge the bus value is compared with the bit by bit
+                       resolution of sc_lv_resolve.
+
+                       Usage:
+
+                         resolved_perf [drivers [cycles]]
+
+                       The defaults are 16 drivers and 100000 clock cycles.
+
+                       The wall clock time varies from run to run, therefore
+                       there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <chrono>
+#include <vector>
+
+static const int WIDTH    = 128; // bus width
+static const int PATTERNS = 8;   // values per driver, used in turn
+
+typedef sc_lv<WIDTH> bus_type;
+
+class bus : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(bus);
+
+    bus(sc_module_name name, int drivers_)
+      : sc_module(name), clk("clk", 10, SC_NS), data("data"), line("line")
+      , drivers(drivers_), cycle(0), errors(0), current(drivers_)
+    {
+      unsigned seed = 1;
+      for (int i = 0; i < drivers; ++i)
+      {
+        for (int p = 0; p < PATTERNS; ++p)
+        {
+          bus_type v(SC_LOGIC_Z);
+          for (int b = i; b < WIDTH; b += drivers)
+            v[b] = sc_logic(int((seed = seed * 1103515245 + 12345) >> 16) & 1);
+          if (p == i % PATTERNS)               // collide with the next driver
+            v[(i + 1) % drivers % WIDTH] = SC_LOGIC_1;
+          patterns.push_back(v);
+        }
+        current[i] = &patterns[i * PATTERNS];
+
+        sc_spawn_options opt;
+        opt.spawn_method();
+        opt.set_sensitivity(&clk.posedge_event());
+        opt.dont_initialize();
+        sc_spawn(sc_bind(&bus::driver, this, i), 0, &opt);
+      }
+
+      SC_METHOD(checker);
+      sensitive << clk.negedge_event();
+      dont_initialize();
+    }
+
+    sc_clock                   clk;
+    sc_signal_rv<WIDTH>        data;
+    sc_signal_resolved         line;
+    int                        drivers;
+    int                        cycle;
+    int                        errors;
+
+  private:
+    void driver(int i)
+    {
+      current[i] = &patterns[i * PATTERNS + cycle % PATTERNS];
+      data.write(*current[i]);
+      line.write(i == cycle % drivers ? SC_LOGIC_1 : SC_LOGIC_Z);
+    }
+
+    void checker()
+    {
+      if (cycle % 100 == 0)
+      {
+        bus_type expected;
+        sc_lv_resolve<WIDTH>::resolve(expected, current);
+        if (data.read() != expected)
+          ++errors;
+        if (line.read() != SC_LOGIC_1)
+          ++errors;
+      }
+      ++cycle;
+    }
+
+    std::vector<bus_type>  patterns;
+    std::vector<bus_type*> current;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  int drivers = argc > 1 ? atoi(argv[1]) : 16;
+  int cycles  = argc > 2 ? atoi(argv[2]) : 100000;
+
+  if (drivers < 1) drivers = 1;
+  if (cycles < 1)  cycles = 1;
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  bus top("Bus1", drivers);
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start(cycles * 10, SC_NS);
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+
+  cout << "Drivers: " << drivers << ", width: " << WIDTH
+       << ", cycles: " << top.cycle << endl;
+  cout << "Errors: " << top.errors << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per cycle: " << sim.count() * 1e9 / double(top.cycle)
+       << " ns" << endl;
+  return top.errors == 0 ? 0 : 1;
+}
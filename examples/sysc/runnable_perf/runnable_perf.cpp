@@ -0,0 +1,221 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  runnable_perf.cpp -- Run queue performance example.
+
+                       A large number of trivial method processes are
+                       statically sensitive to a shared event, which a
+                       driver notifies in every delta cycle, so the run
+                       time is dominated by queueing and dispatching the
+                       methods.
+
+                       In addition, a few methods and threads statically
+                       sensitive to one or several of a set of events, and
+                       to a signal, are woken by delta, immediate and
+                       signal notifications in different orders, and the
+                       order in which they are executed in each delta
+                       cycle is compared with the order of the scheduler
+                       before the delta events were triggered as a batch.
+
+                       Usage:
+
+                         runnable_perf [methods [deltas]]
+
+                       The defaults are 100000 methods and 100 delta cycles.
+                       To check the scaling run e.g.
+
+                         ./runnable_perf 10000 1000
+                         ./runnable_perf 1000000 10
+
+                       The wall clock time varies from run to run, therefore
+                       there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <chrono>
+#include <string>
+
+class crowd : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(crowd);
+
+    crowd(sc_module_name name, int methods, int deltas_)
+      : sc_module(name), activations(0), deltas(deltas_)
+    {
+      SC_METHOD(driver);
+
+      sc_spawn_options opt;
+      opt.spawn_method();
+      opt.set_sensitivity(&tick);
+      opt.dont_initialize();
+      for (int i = 0; i < methods; ++i)
+        sc_spawn(sc_bind(&crowd::worker, this), 0, &opt);
+    }
+
+    sc_dt::uint64 activations;
+
+  private:
+    void driver()
+    {
+      if (deltas-- > 0)
+      {
+        tick.notify(SC_ZERO_TIME);
+        next_trigger(SC_ZERO_TIME);
+      }
+    }
+
+    void worker()
+    {
+      ++activations;
+    }
+
+    sc_event tick;
+    int      deltas;
+};
+
+// Processes named 'a' to 'h' append their names to a log when they are
+// executed, and '|' when a new delta cycle has started.
+
+class order_check : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(order_check);
+
+    order_check(sc_module_name name)
+      : sc_module(name), last_delta(0)
+    {
+      SC_THREAD(driver);
+
+      SC_METHOD(a); sensitive << e0;                dont_initialize();
+      SC_METHOD(b); sensitive << e1;                dont_initialize();
+      SC_METHOD(c); sensitive << e0 << e1;          dont_initialize();
+      SC_THREAD(d); sensitive << e2;
+      SC_METHOD(e); sensitive << e0 << e2 << e3;    dont_initialize();
+      SC_THREAD(f); sensitive << e3 << e1;
+      SC_METHOD(g); sensitive << sig;               dont_initialize();
+      SC_METHOD(h); sensitive << e2;                dont_initialize();
+    }
+
+    std::string log;
+
+  private:
+    void driver()
+    {
+      wait(SC_ZERO_TIME);
+      e0.notify(SC_ZERO_TIME);
+      e2.notify(SC_ZERO_TIME);
+      wait(SC_ZERO_TIME);
+      e1.notify(SC_ZERO_TIME);
+      e0.notify(SC_ZERO_TIME);
+      e3.notify(SC_ZERO_TIME);
+      sig.write(1);
+      wait(SC_ZERO_TIME);
+      e3.notify(SC_ZERO_TIME);
+      e2.notify(SC_ZERO_TIME);
+      e1.notify(SC_ZERO_TIME);
+      e0.notify(SC_ZERO_TIME);
+      wait(SC_ZERO_TIME);
+      e1.notify(SC_ZERO_TIME);
+      e3.notify();
+      wait(SC_ZERO_TIME);
+      sig.write(2);
+      e2.notify(SC_ZERO_TIME);
+      e0.notify(SC_ZERO_TIME);
+      wait(1, SC_NS);
+      e1.notify(SC_ZERO_TIME);
+      e2.notify(SC_ZERO_TIME);
+    }
+
+    void record(char name)
+    {
+      if (sc_delta_count() != last_delta)
+      {
+        log += '|';
+        last_delta = sc_delta_count();
+      }
+      log += name;
+    }
+
+    void a() { record('a'); }
+    void b() { record('b'); }
+    void c() { record('c'); }
+    void d() { for (;;) { wait(); record('d'); } }
+    void e() { record('e'); }
+    void f() { for (;;) { wait(); record('f'); } }
+    void g() { record('g'); }
+    void h() { record('h'); }
+
+    sc_event        e0, e1, e2, e3;
+    sc_signal<int>  sig;
+    sc_dt::uint64   last_delta;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  int methods = argc > 1 ? atoi(argv[1]) : 100000;
+  int deltas  = argc > 2 ? atoi(argv[2]) : 100;
+
+  if (methods < 1) methods = 1;
+  if (deltas < 1)  deltas = 1;
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  crowd top("Crowd1", methods, deltas);
+  order_check order("Order");
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start();
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+  sc_dt::uint64 expected = sc_dt::uint64(methods) * deltas;
+  // recorded with the scheduler before the delta events were triggered as
+  // a batch
+  static const char expected_order[] =
+    "|hecad|gecabf|ecabhfde|cbf|gecahd|hecbdf";
+  bool ok = top.activations == expected && order.log == expected_order;
+
+  cout << "Methods: " << methods << ", delta cycles: " << deltas << endl;
+  cout << "Activations: " << top.activations
+       << ", errors: " << !ok << endl;
+  cout << "Execution order: " << order.log << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per activation: "
+       << sim.count() * 1e9 / double(top.activations) << " ns" << endl;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,290 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  shm_fifo_perf.cpp -- Shared memory fifo performance example.
+
+                       The simulation forks into two host processes, each
+                       running its own SystemC kernel: a producer writes
+                       bursts of tokens into a sc_shm_fifo_writer, a
+                       consumer reads and checks them from the matching
+                       sc_shm_fifo_reader. Both access the shared ring
+                       buffer through its zero-copy windows. The local
+                       times of the kernels are either free-running or
+                       kept within a quantum of each other. For reference,
+                       the same producer and consumer can also be connected
+                       by a sc_fifo within a single simulation.
+
+                       Usage:
+
+                         shm_fifo_perf [free|lockstep|local [tokens
+                                       [capacity [burst]]]]
+
+                       The defaults are free-running kernels, 1000000
+                       tokens, a capacity of 1024 tokens and bursts of 64
+                       tokens, one burst per nanosecond. To compare run
+                       e.g.
+
+                         ./shm_fifo_perf free
+                         ./shm_fifo_perf lockstep
+                         ./shm_fifo_perf local
+
+                       The wall clock time varies from run to run, therefore
+                       there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+#if !defined(WIN32) && !defined(_WIN32)
+# include <sys/types.h>
+# include <sys/wait.h>
+# include <unistd.h>
+# define SHM_FIFO_PERF_FORK
+#endif
+
+struct token
+{
+  sc_dt::uint64 seq;
+  sc_dt::uint64 data;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const token& t)
+{
+  return os << t.seq << ':' << t.data;
+}
+
+inline sc_dt::uint64 payload(sc_dt::uint64 seq)
+{
+  return seq * 0x9e3779b97f4a7c15ULL;
+}
+
+// after the last token the writer end is closed, so that the reader knows
+// that no more tokens follow
+inline void finish(sc_fifo<token>&) {}
+inline void finish(sc_shm_fifo_writer<token>& fifo) { fifo.close(); }
+
+template <class FIFO>
+class producer : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(producer);
+
+    producer(sc_module_name name, FIFO& fifo_, int tokens_, int burst_)
+      : sc_module(name), fifo(fifo_), tokens(tokens_), burst(burst_)
+    {
+      SC_THREAD(main);
+    }
+
+  private:
+    void main()
+    {
+      sc_dt::uint64 seq = 0;
+      while (seq < tokens)
+      {
+        token* w;
+        int n = fifo.write_window(w);
+        if (n == 0)
+        {
+          wait(fifo.data_read_event());
+          continue;
+        }
+        n = std::min(n, int(std::min<sc_dt::uint64>(burst, tokens - seq)));
+        for (int i = 0; i < n; ++i, ++seq)
+        {
+          w[i].seq = seq;
+          w[i].data = payload(seq);
+        }
+        fifo.commit_write(n);
+        wait(1, SC_NS);
+      }
+      finish(fifo);
+    }
+
+    FIFO&         fifo;
+    sc_dt::uint64 tokens;
+    int           burst;
+};
+
+template <class FIFO>
+class consumer : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(consumer);
+
+    consumer(sc_module_name name, FIFO& fifo_, int tokens_)
+      : sc_module(name), received(0), errors(0), fifo(fifo_), tokens(tokens_)
+    {
+      SC_THREAD(main);
+    }
+
+    sc_dt::uint64 received;
+    sc_dt::uint64 errors;
+    sc_time       last;
+
+  private:
+    void main()
+    {
+      while (received < tokens)
+      {
+        token* r;
+        int n = fifo.read_window(r);
+        if (n == 0)
+        {
+          wait(fifo.data_written_event());
+          continue;
+        }
+        for (int i = 0; i < n; ++i, ++received)
+          errors += r[i].seq != received || r[i].data != payload(received);
+        fifo.commit_read(n);
+      }
+      last = sc_time_stamp();
+    }
+
+    FIFO&         fifo;
+    sc_dt::uint64 tokens;
+};
+
+typedef std::chrono::steady_clock host_clock;
+
+static void report(const char* mode, int tokens, int capacity, int burst,
+                   host_clock::time_point start, host_clock::time_point end)
+{
+  std::chrono::duration<double> sim = end - start;
+  cout << "Tokens: " << tokens << ", capacity: " << capacity
+       << ", burst: " << burst << ", " << mode << endl;
+  cout << "Transfer time: " << sim.count() << " s" << endl;
+  cout << "Time per token: " << sim.count() * 1e9 / tokens << " ns" << endl;
+}
+
+static int run_local(int tokens, int capacity, int burst)
+{
+  sc_fifo<token>                     fifo("fifo", capacity);
+  producer<sc_fifo<token> >          prod("producer", fifo, tokens, burst);
+  consumer<sc_fifo<token> >          cons("consumer", fifo, tokens);
+
+  host_clock::time_point start = host_clock::now();
+  sc_start();
+  host_clock::time_point end = host_clock::now();
+
+  cout << "Received: " << cons.received << ", errors: " << cons.errors
+       << ", local time: " << cons.last << endl;
+  report("single simulation", tokens, capacity, burst, start, end);
+  return cons.received == sc_dt::uint64(tokens) && cons.errors == 0 ? 0 : 1;
+}
+
+#if defined(SHM_FIFO_PERF_FORK)
+
+static const sc_time quantum(100, SC_NS);
+
+// the consumer simulation of the child process
+static int run_reader(const std::string& segment, bool lockstep,
+                      int tokens, int capacity)
+{
+  sc_shm_fifo_reader<token>              fifo("fifo", segment.c_str(), capacity);
+  consumer<sc_shm_fifo_reader<token> >   cons("consumer", fifo, tokens);
+  if (lockstep)
+    fifo.set_time_quantum(quantum);
+
+  sc_start();
+
+  cout << "Received: " << cons.received << ", errors: " << cons.errors
+       << ", local time: " << cons.last << endl;
+  return cons.received == sc_dt::uint64(tokens) && cons.errors == 0 ? 0 : 1;
+}
+
+// the producer simulation of the parent process
+static int run_writer(const std::string& segment, bool lockstep,
+                      int tokens, int capacity, int burst, pid_t reader)
+{
+  host_clock::time_point start = host_clock::now();
+  {
+    sc_shm_fifo_writer<token>              fifo("fifo", segment.c_str(), capacity);
+    producer<sc_shm_fifo_writer<token> >   prod("producer", fifo, tokens, burst);
+    if (lockstep)
+      fifo.set_time_quantum(quantum);
+
+    sc_start();
+  }
+  sc_time last = sc_time_stamp();
+
+  // the reader reports first
+  int status = 0;
+  waitpid(reader, &status, 0);
+  host_clock::time_point end = host_clock::now();
+
+  cout << "Sent: " << tokens << ", local time: " << last << endl;
+
+  report(lockstep ? "lockstep simulations" : "free-running simulations",
+         tokens, capacity, burst, start, end);
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
+
+#endif // SHM_FIFO_PERF_FORK
+
+int sc_main (int argc , char *argv[])
+{
+  const char* mode = argc > 1 ? argv[1] : "free";
+  int tokens   = argc > 2 ? atoi(argv[2]) : 1000000;
+  int capacity = argc > 3 ? atoi(argv[3]) : 1024;
+  int burst    = argc > 4 ? atoi(argv[4]) : 64;
+
+  if (tokens < 1)   tokens = 1;
+  if (capacity < 1) capacity = 1;
+  if (burst < 1)    burst = 1;
+
+#if defined(SHM_FIFO_PERF_FORK)
+  if (std::strcmp(mode, "local") != 0)
+  {
+    bool lockstep = std::strcmp(mode, "lockstep") == 0;
+    std::ostringstream segment;
+    segment << "/shm_fifo_perf." << getpid();
+
+    cout << flush;
+    pid_t reader = fork();
+    if (reader < 0)
+    {
+      cerr << "fork failed" << endl;
+      return 1;
+    }
+    if (reader == 0)
+      return run_reader(segment.str(), lockstep, tokens, capacity);
+    return run_writer(segment.str(), lockstep, tokens, capacity, burst, reader);
+  }
+#endif // SHM_FIFO_PERF_FORK
+
+  return run_local(tokens, capacity, burst);
+}
@@ -0,0 +1,150 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  signal_perf.cpp -- Signal port access performance example.
+
+                     A chain of RTL-like stages, each of which reads the
+                     registers of its predecessor through sc_in ports and
+                     writes its own registers through sc_out ports on every
+                     rising clock edge. The port accesses either go through
+                     the virtual interface methods or, with port resolution
+                     (see sc_set_port_resolution()), directly to the bound
+                     sc_signal channels.
+
+                     Usage:
+
+                       signal_perf [direct|virtual [stages [cycles]]]
+
+                     The defaults are direct access, 1000 stages and 10000
+                     clock cycles. To compare run e.g.
+
+                       ./signal_perf direct
+                       ./signal_perf virtual
+
+                     The wall clock time varies from run to run, therefore
+                     there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cstring>
+
+static const int WIDTH = 4; // registers per stage
+
+SC_MODULE(stage)
+{
+  sc_in<bool>         clk;
+  sc_in<bool>         enable;
+  sc_in<sc_uint<32> > in[WIDTH];
+  sc_out<sc_uint<32> > out[WIDTH];
+  sc_out<bool>        valid;
+
+  SC_CTOR(stage)
+  {
+    SC_METHOD(step);
+    sensitive << clk.pos();
+    dont_initialize();
+  }
+
+  void step()
+  {
+    if (!enable.read())
+      return;
+    for (int k = 0; k < WIDTH; ++k)
+      out[k].write(in[k].read() + (in[(k + 1) % WIDTH].read() >> 1) + 1);
+    valid.write(!valid.read());
+  }
+};
+
+int sc_main (int argc , char *argv[])
+{
+  bool direct = argc <= 1 || std::strcmp(argv[1], "virtual") != 0;
+  int  stages = argc > 2 ? atoi(argv[2]) : 1000;
+  int  cycles = argc > 3 ? atoi(argv[3]) : 10000;
+
+  if (stages < 1) stages = 1;
+  if (cycles < 1) cycles = 1;
+
+  sc_set_port_resolution(direct);
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  sc_clock                        clk("clk", 10, SC_NS);
+  sc_signal<bool>                 enable("enable", true);
+  std::vector<sc_signal<sc_uint<32> >*> regs;
+  std::vector<sc_signal<bool>*>   valid;
+  std::vector<stage*>             chain;
+
+  for (int k = 0; k < WIDTH; ++k)
+    regs.push_back(new sc_signal<sc_uint<32> >(sc_gen_unique_name("reg"), k));
+  for (int i = 0; i < stages; ++i)
+  {
+    stage* s = new stage(sc_gen_unique_name("stage"));
+    s->clk(clk);
+    s->enable(enable);
+    for (int k = 0; k < WIDTH; ++k)
+    {
+      s->in[k](*regs[i * WIDTH + k]);
+      regs.push_back(new sc_signal<sc_uint<32> >(sc_gen_unique_name("reg")));
+      s->out[k](*regs.back());
+    }
+    valid.push_back(new sc_signal<bool>(sc_gen_unique_name("valid")));
+    s->valid(*valid.back());
+    chain.push_back(s);
+  }
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start(cycles * 10, SC_NS);
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+  double accesses = double(stages) * cycles * (3 * WIDTH + 3);
+
+  cout << "Stages: " << stages << ", cycles: " << cycles
+       << (direct ? ", direct" : ", virtual") << " port access" << endl;
+  cout << "Last register: " << regs.back()->read() << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per port access: "
+       << sim.count() * 1e9 / accesses << " ns" << endl;
+
+  for (size_t i = 0; i < chain.size(); ++i)
+    delete chain[i];
+  for (size_t i = 0; i < regs.size(); ++i)
+    delete regs[i];
+  for (size_t i = 0; i < valid.size(); ++i)
+    delete valid[i];
+  return 0;
+}
@@ -0,0 +1,137 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  spawn_perf.cpp -- Dynamic thread process performance example.
+
+                    A dispatcher spawns short-lived thread processes, as
+                    the blocking/non-blocking adaptors of the TLM convenience
+                    sockets do for each transaction. Each process waits a
+                    few times and terminates, while a bounded number of them
+                    is active at the same time.
+
+                    The example reports the spawn rate and the statistics
+                    of the thread stack pool, see sc_get_stack_pool_stats().
+                    With "nopool", the pool limit is set to zero, so each
+                    stack is returned to the system when its process has
+                    been deleted.
+
+                    Usage:
+
+                      spawn_perf [pool|nopool [spawns [active]]]
+
+                    The defaults are 100000 spawns with up to 100 active
+                    processes.
+
+                    The wall clock time varies from run to run, therefore
+                    there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <chrono>
+#include <cstring>
+
+class dispatcher : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(dispatcher);
+
+    dispatcher(sc_module_name name, int spawns_, int active_)
+      : sc_module(name), completed(0), spawns(spawns_), active(active_),
+        running(0)
+    {
+      SC_THREAD(main);
+    }
+
+    int completed;
+
+  private:
+    void main()
+    {
+      for (int i = 0; i < spawns; ++i)
+      {
+        while (running >= active)
+          wait(done);
+        ++running;
+        sc_spawn(sc_bind(&dispatcher::transaction, this, i));
+        if (i % 8 == 7)
+          wait(1, SC_NS);
+      }
+    }
+
+    void transaction(int i)
+    {
+      for (int k = 0; k < 1 + i % 4; ++k)
+        wait(1 + (i + k) % 3, SC_NS);
+      ++completed;
+      --running;
+      done.notify(SC_ZERO_TIME);
+    }
+
+    sc_event done;
+    int      spawns;
+    int      active;
+    int      running;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  bool pool   = argc <= 1 || std::strcmp(argv[1], "nopool") != 0;
+  int  spawns = argc > 2 ? atoi(argv[2]) : 100000;
+  int  active = argc > 3 ? atoi(argv[3]) : 100;
+
+  if (spawns < 1) spawns = 1;
+  if (active < 1) active = 1;
+  if (!pool)
+    sc_set_stack_pool_limit(0);
+
+  dispatcher top("Dispatcher1", spawns, active);
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+  sc_start();
+  std::chrono::duration<double> elapsed = host_clock::now() - start;
+
+  sc_stack_pool_stats stats = sc_get_stack_pool_stats();
+  cout << "Spawned processes: " << spawns << ", completed: "
+       << top.completed << endl;
+  cout << "Stack pool limit: " << sc_get_stack_pool_limit() << " bytes"
+       << endl;
+  cout << "Stacks mapped: " << stats.stacks_mapped
+       << ", reused: " << stats.stacks_reused
+       << ", peak in use: " << stats.peak_stacks_in_use << endl;
+  cout << "Peak resident stack memory: "
+       << stats.peak_resident_bytes / 1024 << " KiB" << endl;
+  cout << "Spawn rate: " << spawns / elapsed.count() / 1e3 << " k/s" << endl;
+  return top.completed == spawns ? 0 : 1;
+}
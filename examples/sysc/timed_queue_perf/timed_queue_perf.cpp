@@ -0,0 +1,336 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  timed_queue_perf.cpp -- Timed event queue performance example.
+
+                          This example measures the cost of inserting and
+                          extracting timed notifications with a "hold"
+                          model: the number of pending notifications stays
+                          roughly constant while the simulation advances.
+
+                          Every clock period a generator schedules a batch
+                          of notifications, most of them on one of the next
+                          few clock edges, some of them in between. No
+                          process is sensitive to these events, so the
+                          queue operations dominate the run time. With
+                          "reschedule", each notification is cancelled and
+                          notified again right away, like a watchdog being
+                          kicked, and the number of cancelled entries that
+                          were removed from the queue is reported.
+
+                          A few checker events are re-notified at random
+                          delays and verify that they are triggered at the
+                          expected time. In addition, events are cancelled,
+                          cancelled and notified again, notified earlier or
+                          later than a pending notification, or overridden
+                          by a delta notification, and the times they are
+                          triggered at are checked, as well as the number
+                          of cancelled entries.
+
+                          Usage:
+
+                            timed_queue_perf [heap|wheel [pending [cycles
+                                             [reschedule]]]]
+
+                          The defaults are the wheel, 10000 pending
+                          notifications and 1000 clock cycles. To compare
+                          the implementations run e.g.
+
+                            for q in heap wheel; do
+                              for n in 1000 10000 100000 1000000 10000000; do
+                                ./timed_queue_perf $q $n 200
+                              done
+                            done
+
+                          The wall clock time varies from run to run,
+                          therefore there is no golden reference output for
+                          this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+#include "sysc/kernel/sc_timed_event_queue.h"
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+static const int horizon = 8; // notifications land up to 8 periods ahead
+
+static unsigned rnd()
+{
+  static unsigned state = 12345;
+  state = state * 1103515245u + 12345u;
+  return state >> 8;
+}
+
+static sc_time random_delay(const sc_time& period)
+{
+  sc_time delay = period * double(1 + rnd() % horizon);
+  if (rnd() % 4 == 0)
+    delay += period * (double(rnd() % 1000) / 1000.0);
+  return delay;
+}
+
+class generator : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(generator);
+
+    generator(sc_module_name name, int pending_, int cycles_,
+              const sc_time& period_, bool reschedule_)
+      : sc_module(name), inserted(0), pending(pending_), cycles(cycles_),
+        period(period_), reschedule(reschedule_), events(0), next(0)
+    {
+      SC_THREAD(main);
+    }
+
+    ~generator()
+    {
+      delete [] events;
+    }
+
+    void main()
+    {
+      // an event is reused after more than horizon periods, when its
+      // previous notification has been triggered
+      events = new sc_event[2 * pending];
+
+      // fill the queue, then keep it at the same level
+      schedule(pending);
+      for (int c = 0; c < cycles; ++c)
+      {
+        wait(period);
+        schedule(2 * pending / (horizon + 1));
+      }
+    }
+
+    void schedule(int n)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        sc_event& ev = events[next];
+        next = (next + 1) % (2 * pending);
+        ev.notify(random_delay(period));
+        if (reschedule)
+        {
+          ev.cancel();
+          ev.notify(random_delay(period));
+        }
+      }
+      inserted += n;
+    }
+
+    sc_dt::uint64 inserted;
+
+  private:
+    int       pending;
+    int       cycles;
+    sc_time   period;
+    bool      reschedule;
+    sc_event* events;
+    int       next;
+};
+
+class checker : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(checker);
+
+    checker(sc_module_name name, const sc_time& period_)
+      : sc_module(name), errors(0), triggers(0), period(period_)
+    {
+      SC_METHOD(main);
+      sensitive << ev;
+    }
+
+    void main()
+    {
+      if (triggers > 0 && sc_time_stamp() != expected)
+        ++errors;
+      ++triggers;
+      sc_time delay = random_delay(period);
+      expected = sc_time_stamp() + delay;
+      ev.notify(delay);
+    }
+
+    int      errors;
+    int      triggers;
+
+  private:
+    sc_event ev;
+    sc_time  expected;
+    sc_time  period;
+};
+
+// Records the times an event is triggered at.
+
+class event_watch : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(event_watch);
+
+    event_watch(sc_module_name name)
+      : sc_module(name)
+    {
+      SC_METHOD(record);
+      sensitive << ev;
+      dont_initialize();
+    }
+
+    void record() { times.push_back(sc_time_stamp()); }
+
+    // triggered exactly once, at the given time
+    bool once_at(const sc_time& t) const
+      { return times.size() == 1 && times[0] == t; }
+
+    sc_event             ev;
+    std::vector<sc_time> times;
+};
+
+class canceller : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(canceller);
+
+    canceller(sc_module_name name, const sc_time& period_)
+      : sc_module(name), errors(0), rounds(0), cancels(0), period(period_),
+        watch("Watch", 5)
+    {
+      SC_THREAD(main);
+    }
+
+    void main()
+    {
+      for (;;)
+      {
+        for (size_t i = 0; i < watch.size(); ++i)
+          watch[i].times.clear();
+
+        sc_time now = sc_time_stamp();
+        sc_time d1 = random_delay(period);
+        sc_time d2 = d1 + period * double(1 + rnd() % 3);
+
+        // cancelled
+        watch[0].ev.notify(d1);
+        watch[0].ev.cancel();
+        // cancelled and notified again
+        watch[1].ev.notify(d1);
+        watch[1].ev.cancel();
+        watch[1].ev.notify(d2);
+        // the earlier notification replaces the pending one
+        watch[2].ev.notify(d2);
+        watch[2].ev.notify(d1);
+        // the later notification is ignored
+        watch[3].ev.notify(d1);
+        watch[3].ev.notify(d2);
+        // the delta notification replaces the pending one
+        watch[4].ev.notify(d2);
+        watch[4].ev.notify(SC_ZERO_TIME);
+        cancels += 4;
+
+        wait(d2 + period);
+
+        if (!watch[0].times.empty() || !watch[1].once_at(now + d2)
+            || !watch[2].once_at(now + d1) || !watch[3].once_at(now + d1)
+            || !watch[4].once_at(now))
+        {
+          cout << name() << ": wrong triggers in round " << rounds
+               << " at " << now << endl;
+          ++errors;
+        }
+        ++rounds;
+      }
+    }
+
+    int           errors;
+    int           rounds;
+    sc_dt::uint64 cancels;
+
+  private:
+    sc_time                period;
+    sc_vector<event_watch> watch;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  bool heap    = argc > 1 && std::strcmp(argv[1], "heap") == 0;
+  int  pending = argc > 2 ? atoi(argv[2]) : 10000;
+  int  cycles  = argc > 3 ? atoi(argv[3]) : 1000;
+  bool resched = argc > 4 && std::strcmp(argv[4], "reschedule") == 0;
+
+  if (pending < 1) pending = 1;
+  if (cycles < 1)  cycles = 1;
+
+  sc_set_timed_event_queue(heap ? SC_TIMED_EVENT_HEAP : SC_TIMED_EVENT_WHEEL);
+
+  sc_time   period(10, SC_NS);
+  generator gen("Generator1", pending, cycles, period, resched);
+  sc_vector<checker> checkers("Checker", 16,
+    [&](const char* name, size_t) { return new checker(name, period); });
+  canceller cancel("Canceller", period);
+
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+  sc_start(period * double(cycles));
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  int errors = 0, triggers = 0;
+  for (size_t i = 0; i < checkers.size(); ++i)
+  {
+    errors   += checkers[i].errors;
+    triggers += checkers[i].triggers;
+  }
+
+  const sc_timed_event_queue* queue = sc_get_timed_event_queue();
+
+  // every cancelled timed notification is counted, and the heap removes
+  // all of them
+  sc_dt::uint64 cancelled = queue->removed_count() + queue->tombstone_count();
+  if (cancel.rounds == 0 || cancelled < cancel.cancels
+      || (heap && queue->tombstone_count() != 0))
+    ++errors;
+  errors += cancel.errors;
+
+  cout << "Timed event queue: " << queue->kind() << endl;
+  cout << "Pending notifications: " << pending << endl;
+  cout << "Notifications scheduled: " << gen.inserted
+       << (resched ? " (rescheduled)" : "") << endl;
+  cout << "Cancelled entries removed: " << queue->removed_count()
+       << ", left in queue: " << queue->tombstone_count() << endl;
+  cout << "Checker triggers: " << triggers << ", cancel rounds: "
+       << cancel.rounds << ", errors: " << errors << endl;
+  cout << "Wall clock time: " << elapsed.count() << " s" << endl;
+  cout << "Time per notification: "
+       << 1e9 * elapsed.count() / double(gen.inserted) << " ns" << endl;
+  return errors || triggers < 16 ? 1 : 0;
+}
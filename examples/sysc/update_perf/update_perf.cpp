@@ -0,0 +1,150 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  update_perf.cpp -- Update phase performance example.
+
+                     A single method writes a large number of sc_signal<int>
+                     and sc_signal<bool> channels in every delta cycle, so
+                     the run time is dominated by the update phase. A given
+                     share of the signals is written and then written back
+                     to its current value, which leaves an update without a
+                     change (see the unchanged updates in the profile
+                     written with SC_PROFILE=<basename>).
+
+                     Usage:
+
+                       update_perf [signals [deltas [unchanged_percent]]]
+
+                     The defaults are 100000 signals, 100 delta cycles and
+                     25 percent unchanged updates.
+
+                     The wall clock time varies from run to run, therefore
+                     there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <vector>
+
+class writer : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(writer);
+
+    writer(sc_module_name name, int signals, int deltas_, int unchanged_)
+      : sc_module(name), writes(0), deltas(deltas_), unchanged(unchanged_)
+      , delta(0)
+    {
+      for (int i = 0; i < signals; ++i)
+      {
+        if (i % 2)
+          flags.push_back(new sc_signal<bool>(sc_gen_unique_name("flag")));
+        else
+          words.push_back(new sc_signal<int>(sc_gen_unique_name("word")));
+      }
+      SC_METHOD(drive);
+    }
+
+    ~writer()
+    {
+      for (size_t i = 0; i < words.size(); ++i)
+        delete words[i];
+      for (size_t i = 0; i < flags.size(); ++i)
+        delete flags[i];
+    }
+
+    sc_dt::uint64 writes;
+
+  private:
+    // signal i is written back in deltas where ( i + delta ) % 100 is below
+    // the unchanged share, otherwise it toggles
+    bool restore(size_t i) const
+      { return int((i + delta) % 100) < unchanged; }
+
+    void drive()
+    {
+      for (size_t i = 0; i < words.size(); ++i)
+      {
+        int v = words[i]->read();
+        words[i]->write(v + 1);
+        if (restore(2 * i))
+          words[i]->write(v);
+      }
+      for (size_t i = 0; i < flags.size(); ++i)
+      {
+        bool v = flags[i]->read();
+        flags[i]->write(!v);
+        if (restore(2 * i + 1))
+          flags[i]->write(v);
+      }
+      writes += words.size() + flags.size();
+      if (++delta < deltas)
+        next_trigger(SC_ZERO_TIME);
+    }
+
+    int                             deltas;
+    int                             unchanged;
+    int                             delta;
+    std::vector<sc_signal<int>*>    words;
+    std::vector<sc_signal<bool>*>   flags;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  int signals   = argc > 1 ? atoi(argv[1]) : 100000;
+  int deltas    = argc > 2 ? atoi(argv[2]) : 100;
+  int unchanged = argc > 3 ? atoi(argv[3]) : 25;
+
+  if (signals < 1) signals = 1;
+  if (deltas < 1)  deltas = 1;
+
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  writer top("Writer1", signals, deltas, unchanged);
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start();
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+
+  cout << "Signals: " << signals << ", delta cycles: " << deltas
+       << ", unchanged: " << unchanged << "%" << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per update: "
+       << sim.count() * 1e9 / double(top.writes) << " ns" << endl;
+  return 0;
+}
@@ -0,0 +1,226 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  vector_perf.cpp -- Vector signal performance example.
+
+                     A single method writes a large number of 128 bit wide
+                     sc_signal<sc_lv<128> > or sc_signal<sc_bv<128> >
+                     channels in every delta cycle, alternating between two
+                     bit patterns, so the run time is dominated by writing
+                     and updating the vector signals. Another method waits
+                     for the rising edges of a single bit of the first
+                     signal (see sc_signal<sc_lv<W> >::posedge_event(int)).
+                     In addition, values, signals and signal interfaces are
+                     assigned to sc_lv and sc_bv signals with per-bit
+                     events, and the values and edges are checked.
+
+                     Usage:
+
+                       vector_perf [lv|bv [signals [deltas]]]
+
+                     The defaults are sc_lv, 10000 signals and 100 delta
+                     cycles. To compare run e.g.
+
+                       ./vector_perf lv
+                       ./vector_perf bv
+
+                     The wall clock time varies from run to run, therefore
+                     there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+static const int WIDTH = 128;
+static const int WATCHED_BIT = 3;
+
+template <class T>
+class bus_writer : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(bus_writer);
+
+    bus_writer(sc_module_name name, int signals, int deltas_)
+      : sc_module(name), writes(0), edges(0), deltas(deltas_), delta(0)
+    {
+      for (int i = 0; i < WIDTH; ++i)
+      {
+        pattern[0][i] = (i % 3) == 0;
+        pattern[1][i] = (i % 2) == 0;
+      }
+      for (int i = 0; i < signals; ++i)
+        buses.push_back(new sc_signal<T>(sc_gen_unique_name("bus")));
+
+      SC_METHOD(drive);
+      SC_METHOD(watch);
+      sensitive << buses[0]->posedge_event(WATCHED_BIT);
+      dont_initialize();
+    }
+
+    ~bus_writer()
+    {
+      for (size_t i = 0; i < buses.size(); ++i)
+        delete buses[i];
+    }
+
+    // the watched bit rises whenever pattern 0 is written
+    bool check() const
+      { return edges == sc_dt::uint64(deltas + 1) / 2; }
+
+    sc_dt::uint64 writes;
+    sc_dt::uint64 edges;
+
+  private:
+    void drive()
+    {
+      const T& value = pattern[delta % 2];
+      for (size_t i = 0; i < buses.size(); ++i)
+        buses[i]->write(value);
+      writes += buses.size();
+      if (++delta < deltas)
+        next_trigger(SC_ZERO_TIME);
+    }
+
+    void watch()
+    {
+      ++edges;
+    }
+
+    int                         deltas;
+    int                         delta;
+    T                           pattern[2];
+    std::vector<sc_signal<T>*>  buses;
+};
+
+// assigns values, signals and signal interfaces to two signals with
+// per-bit events
+template <class T>
+class bus_assign : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(bus_assign);
+
+    bus_assign(sc_module_name name)
+      : sc_module(name), edges(0), ok(false)
+    {
+      for (int i = 0; i < WIDTH; ++i)
+      {
+        pattern[0][i] = (i % 3) == 0;
+        pattern[1][i] = (i % 2) == 0;
+      }
+
+      SC_THREAD(assign);
+      SC_METHOD(watch);
+      sensitive << src.posedge_event(WATCHED_BIT)
+                << dst.posedge_event(WATCHED_BIT);
+      dont_initialize();
+    }
+
+    // the watched bit rises once on src and twice on dst
+    bool check() const
+      { return ok && edges == 3; }
+
+  private:
+    void assign()
+    {
+      src = pattern[0];
+      wait(SC_ZERO_TIME);
+      dst = src;
+      wait(SC_ZERO_TIME);
+      bool values = dst.read() == pattern[0];
+      dst = pattern[1];
+      wait(SC_ZERO_TIME);
+      values = values && dst.read() == pattern[1];
+      const sc_signal_in_if<T>& in = src;
+      dst = in;
+      wait(SC_ZERO_TIME);
+      ok = values && dst.read() == pattern[0] && src.read() == pattern[0];
+    }
+
+    void watch()
+    {
+      ++edges;
+    }
+
+    int           edges;
+    bool          ok;
+    T             pattern[2];
+    sc_signal<T>  src;
+    sc_signal<T>  dst;
+};
+
+template <class T>
+int run(const char* kind, int signals, int deltas)
+{
+  typedef std::chrono::steady_clock host_clock;
+  host_clock::time_point start = host_clock::now();
+
+  bus_writer<T> top("Writer1", signals, deltas);
+  bus_assign<sc_lv<WIDTH> > assign_lv("AssignLv");
+  bus_assign<sc_bv<WIDTH> > assign_bv("AssignBv");
+
+  host_clock::time_point elaborated = host_clock::now();
+  sc_start();
+  host_clock::time_point end = host_clock::now();
+
+  std::chrono::duration<double> elab = elaborated - start;
+  std::chrono::duration<double> sim  = end - elaborated;
+
+  cout << "Signals: " << signals << " x " << kind << "<" << WIDTH << ">"
+       << ", delta cycles: " << deltas << endl;
+  cout << "Edges of bit " << WATCHED_BIT << ": " << top.edges
+       << ", errors: " << !top.check() << endl;
+  bool assigned = assign_lv.check() && assign_bv.check();
+  cout << "Assignment errors: " << !assigned << endl;
+  cout << "Elaboration time: " << elab.count() << " s" << endl;
+  cout << "Simulation time: " << sim.count() << " s" << endl;
+  cout << "Time per write: "
+       << sim.count() * 1e9 / double(top.writes) << " ns" << endl;
+  return (top.check() && assigned) ? 0 : 1;
+}
+
+int sc_main (int argc , char *argv[])
+{
+  bool bv      = argc > 1 && std::strcmp(argv[1], "bv") == 0;
+  int  signals = argc > 2 ? atoi(argv[2]) : 10000;
+  int  deltas  = argc > 3 ? atoi(argv[3]) : 100;
+
+  if (signals < 1) signals = 1;
+  if (deltas < 1)  deltas = 1;
+
+  if (bv)
+    return run<sc_bv<WIDTH> >("sc_bv", signals, deltas);
+  return run<sc_lv<WIDTH> >("sc_lv", signals, deltas);
+}
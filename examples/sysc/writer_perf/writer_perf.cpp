@@ -0,0 +1,226 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  writer_perf.cpp -- Signal writer policy performance example.
+
+                     A thread writes a number of sc_signal<int> channels
+                     of the SC_ONE_WRITER, SC_MANY_WRITERS and
+                     SC_UNCHECKED_WRITERS policies repeatedly in every
+                     activation, and the time per write is measured for
+                     each policy. The repeated writes of a process skip the
+                     lookup of the current writer.
+
+                     In addition, two threads write the same signals, and
+                     the reported driver conflicts are checked: a write of
+                     a second process to a SC_ONE_WRITER signal, and writes
+                     of two processes to a SC_MANY_WRITERS signal in the
+                     same delta cycle, are errors. Writes of two processes
+                     in different delta cycles to a SC_MANY_WRITERS signal,
+                     and repeated writes of the same process, are not.
+
+                     Usage:
+
+                       writer_perf [signals [writes [activations]]]
+
+                     The defaults are 1000 signals, 100 writes per signal
+                     and activation, and 100 activations.
+
+                     The wall clock time varies from run to run, therefore
+                     there is no golden reference output for this example.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <chrono>
+#include <vector>
+
+static const char* const DRIVER_MSG =
+  "sc_signal<T> cannot have more than one driver";
+
+template <sc_writer_policy POL>
+class policy_writer : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(policy_writer);
+
+    policy_writer(sc_module_name name, int signals, int writes_,
+                  int activations_)
+      : sc_module(name), seconds(0), writes(writes_),
+        activations(activations_), sigs("sigs", signals)
+    {
+      SC_THREAD(write);
+    }
+
+    void write()
+    {
+      typedef std::chrono::steady_clock host_clock;
+      for (int a = 0; a < activations; ++a)
+      {
+        host_clock::time_point start = host_clock::now();
+        for (std::size_t i = 0; i < sigs.size(); ++i)
+          for (int w = 0; w < writes; ++w)
+            sigs[i].write(a + w);
+        std::chrono::duration<double> d = host_clock::now() - start;
+        seconds += d.count();
+        wait(SC_ZERO_TIME);
+      }
+    }
+
+    double count() const
+      { return double(sigs.size()) * writes * activations; }
+
+    double seconds;
+
+  private:
+    int writes;
+    int activations;
+    sc_vector<sc_signal<int, POL> > sigs;
+};
+
+// Two threads write the same signals. The counts of driver conflicts
+// are sampled between the phases and compared with the expected ones.
+
+class conflicts : public sc_module
+{
+  public:
+    SC_HAS_PROCESS(conflicts);
+
+    conflicts(sc_module_name name)
+      : sc_module(name), errors(0)
+    {
+      SC_THREAD(first);
+      SC_THREAD(second);
+      SC_THREAD(sample);
+    }
+
+    void first()
+    {
+      // repeated writes of the same process, also in the next delta cycle
+      for (int i = 0; i < 3; ++i)
+        one.write(i);
+      wait(SC_ZERO_TIME);
+      one.write(3);
+
+      wait(2, SC_NS);
+      many.write(1);
+
+      wait(1, SC_NS);
+      many.write(2);
+
+      wait(1, SC_NS);
+      unchecked.write(1);
+    }
+
+    void second()
+    {
+      // second driver of a SC_ONE_WRITER signal
+      wait(1, SC_NS);
+      one.write(4);
+
+      // same delta cycle as first()
+      wait(1, SC_NS);
+      many.write(3);
+      many.write(4);
+
+      // next delta cycle after first()
+      wait(1, SC_NS);
+      wait(SC_ZERO_TIME);
+      many.write(5);
+
+      wait(1, SC_NS);
+      unchecked.write(2);
+    }
+
+    void sample()
+    {
+      static const int expected[] = { 0, 1, 2, 2, 2 };
+      wait(500, SC_PS);
+      for (int i = 0; i < 5; ++i)
+      {
+        int count = sc_report_handler::get_count(DRIVER_MSG);
+        if (count != expected[i])
+        {
+          cout << sc_time_stamp() << ": " << count
+               << " driver conflicts, expected " << expected[i] << endl;
+          ++errors;
+        }
+        wait(1, SC_NS);
+      }
+      // the order of the writes to the unchecked signal is not specified
+      if (many.read() != 5 || (unchecked.read() != 1 && unchecked.read() != 2))
+        ++errors;
+    }
+
+    int errors;
+
+  private:
+    sc_signal<int>                       one;
+    sc_signal<int, SC_MANY_WRITERS>      many;
+    sc_signal<int, SC_UNCHECKED_WRITERS> unchecked;
+};
+
+int sc_main (int argc , char *argv[])
+{
+  int signals     = argc > 1 ? atoi(argv[1]) : 1000;
+  int writes      = argc > 2 ? atoi(argv[2]) : 100;
+  int activations = argc > 3 ? atoi(argv[3]) : 100;
+
+  if (signals < 1)     signals = 1;
+  if (writes < 1)      writes = 1;
+  if (activations < 1) activations = 1;
+
+  // the conflicts are counted, not displayed
+  sc_report_handler::set_actions(DRIVER_MSG, SC_DO_NOTHING);
+
+  policy_writer<SC_ONE_WRITER>        one("OneWriter", signals, writes,
+                                          activations);
+  policy_writer<SC_MANY_WRITERS>      many("ManyWriters", signals, writes,
+                                           activations);
+  policy_writer<SC_UNCHECKED_WRITERS> unchecked("UncheckedWriters", signals,
+                                                writes, activations);
+  conflicts check("Conflicts");
+
+  sc_start();
+
+  cout << "Signals: " << signals << ", writes per activation: " << writes
+       << ", activations: " << activations << endl;
+  cout << "Time per write (SC_ONE_WRITER): "
+       << one.seconds * 1e9 / one.count() << " ns" << endl;
+  cout << "Time per write (SC_MANY_WRITERS): "
+       << many.seconds * 1e9 / many.count() << " ns" << endl;
+  cout << "Time per write (SC_UNCHECKED_WRITERS): "
+       << unchecked.seconds * 1e9 / unchecked.count() << " ns" << endl;
+  cout << "Driver conflicts: "
+       << sc_report_handler::get_count(DRIVER_MSG)
+       << ", errors: " << check.errors << endl;
+  return check.errors ? 1 : 0;
+}
@@ -222,6 +222,16 @@ sc_clock::sc_clock( const char* name_,
 
 void sc_clock::before_end_of_elaboration()
 {
+    // let the kernel schedule the edges, if requested. The edge already
+    // notified by the constructor is handed over to the kernel.
+
+    if( simcontext()->clock_engine() ) {
+        m_next_posedge_event.cancel();
+        m_next_negedge_event.cancel();
+        simcontext()->add_clock( this, m_start_time );
+        return;
+    }
+
     std::string gen_base;
     sc_spawn_options posedge_options;	// Options for posedge process.
     sc_spawn_options negedge_options;	// Options for negedge process.
@@ -248,10 +258,12 @@ void sc_clock::before_end_of_elaboration()
 #undef sc_clock_negedge_callback
 #undef sc_spawn
 
-// destructor (does nothing)
+// destructor
 
 sc_clock::~sc_clock()
-= default;
+{
+    simcontext()->remove_clock( this );
+}
 
 void sc_clock::register_port( sc_port_base& /*port*/, const char* if_typename_ )
 {
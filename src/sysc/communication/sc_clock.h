@@ -50,6 +50,7 @@ public:
 
     friend class sc_clock_posedge_callback;
     friend class sc_clock_negedge_callback;
+    friend class sc_simcontext;
 
     // constructors
 
@@ -142,6 +143,9 @@ protected:
     void posedge_action();
     void negedge_action();
 
+    // edge scheduled by the kernel, returns the time until the next edge
+    const sc_time& edge_action();
+
 
     // error reporting
     void report_error( const char* id, const char* add_msg = 0 ) const;
@@ -193,6 +197,15 @@ sc_clock::negedge_action()
 	request_update();
 }
 
+inline
+const sc_time&
+sc_clock::edge_action()
+{
+    m_new_val = !m_new_val;
+    request_update();
+    return m_new_val ? m_negedge_time : m_posedge_time;
+}
+
 
 // ----------------------------------------------------------------------------
 
@@ -107,6 +107,14 @@ SC_DEFINE_MESSAGE( SC_ID_ATTEMPT_TO_BIND_CLOCK_TO_OUTPUT_,  128,
     "attempted to bind sc_clock instance to sc_inout or sc_out" )
 SC_DEFINE_MESSAGE( SC_ID_NO_ASYNC_UPDATE_,  129,
     "this build has no asynchronous update support" )
+SC_DEFINE_MESSAGE( SC_ID_INVALID_FIFO_COMMIT_,  130,
+    "sc_fifo<T> commit exceeds the window" )
+SC_DEFINE_MESSAGE( SC_ID_SHM_FIFO_SEGMENT_,  131,
+    "shared memory fifo segment not available" )
+SC_DEFINE_MESSAGE( SC_ID_SHM_FIFO_MISMATCH_,  132,
+    "shared memory fifo segment does not match" )
+SC_DEFINE_MESSAGE( SC_ID_SHM_FIFO_QUANTUM_,  133,
+    "shared memory fifo time quantum set after elaboration" )
 
 /* 
 $Log: sc_communication_ids.h,v $
@@ -27,76 +27,162 @@
  *****************************************************************************/
 
 #include "sysc/communication/sc_event_queue.h"
-#include "sysc/kernel/sc_method_process.h"
 
 namespace sc_core {
 
-template class SC_API sc_ppq<sc_time*>;
 template class SC_API sc_port<sc_event_queue_if,1,SC_ONE_OR_MORE_BOUND>;
 
-static int 
-sc_time_compare( const void* p1, const void* p2 )
-{
-    const auto* t1 = static_cast<const sc_time*>( p1 );
-    const auto* t2 = static_cast<const sc_time*>( p2 );
-
-    if( *t1 < *t2 ) {
-	return 1;
-    } if( *t1 > *t2 ) {
-	return -1;
-    } 
-	return 0;
-     
-}
-
 sc_event_queue::sc_event_queue( const sc_module_name& name_ )
     : sc_module( name_ ),
-      m_ppq( 128, sc_time_compare ),
+      m_heap(),
+      m_last(-1),
+      m_pending(0),
       m_e( sc_event::kernel_event ),
-      m_change_stamp(0),
-      m_pending_delta(0)
+      m_change_stamp(0)
 {
-    SC_METHOD( fire_event );
-    sensitive << m_e;
-    dont_initialize();
+    m_e.m_trigger_hook_p = this;
 }
 
 sc_event_queue::~sc_event_queue()
-{
-  while (!m_ppq.empty()) {
-    delete m_ppq.extract_top();
-  }
-}
+{}
 
 void sc_event_queue::cancel_all()
 {
-    m_pending_delta = 0;
-    while( !m_ppq.empty() )
-	delete m_ppq.extract_top();
+    m_heap.clear();
+    m_last = -1;
+    m_pending = 0;
     m_e.cancel();
 }
 
 void sc_event_queue::notify (const sc_time& when)
 {
+    notify( &when, 1 );
+}
+
+void sc_event_queue::notify (const sc_time* when, int n)
+{
+    if ( n <= 0 ) {
+        return;
+    }
     m_change_stamp = simcontext()->change_stamp();
-    auto* t = new sc_time( when+sc_time_stamp() );
-    if ( m_ppq.empty() || *t < *m_ppq.top() ) {
-	m_e.notify( when );
+    const sc_time now = sc_time_stamp();
+    const sc_time next = m_heap.empty() ? SC_ZERO_TIME : m_heap[0].when;
+    bool was_empty = m_heap.empty();
+
+    for ( int i = 0; i < n; ++i ) {
+        insert( when[i] + now );
+    }
+    m_pending += n;
+
+    if ( was_empty || m_heap[0].when < next ) {
+        m_e.notify( m_heap[0].when - now );
+    }
+}
+
+// Add a notification at the absolute time when. Notifications for the
+// earliest or the most recently notified time only increase its count.
+
+void sc_event_queue::insert( const sc_time& when )
+{
+    if ( !m_heap.empty() && m_heap[0].when == when ) {
+        ++m_heap[0].count;
+        m_last = 0;
+        return;
+    }
+    if ( m_last >= 0 && m_heap[m_last].when == when ) {
+        ++m_heap[m_last].count;
+        return;
+    }
+    entry e = { when, 1 };
+    m_heap.push_back( e );
+    m_last = static_cast<int>( m_heap.size() ) - 1;
+    sift_up( m_last );
+}
+
+void sc_event_queue::remove_top()
+{
+    int back = static_cast<int>( m_heap.size() ) - 1;
+    if ( m_last == 0 ) {
+        m_last = -1;
+    } else if ( m_last == back ) {
+        m_last = 0;
+    }
+    m_heap[0] = m_heap[back];
+    m_heap.pop_back();
+    if ( !m_heap.empty() ) {
+        sift_down( 0 );
+    }
+}
+
+// The sift operations move the entry at index i to its place in the heap,
+// m_last follows the entry it refers to.
+
+void sc_event_queue::sift_up( int i )
+{
+    entry e = m_heap[i];
+    bool last = ( i == m_last );
+    while ( i > 0 ) {
+        int parent = ( i - 1 ) / 2;
+        if ( !( e.when < m_heap[parent].when ) ) {
+            break;
+        }
+        m_heap[i] = m_heap[parent];
+        if ( m_last == parent ) {
+            m_last = i;
+        }
+        i = parent;
+    }
+    m_heap[i] = e;
+    if ( last ) {
+        m_last = i;
+    }
+}
+
+void sc_event_queue::sift_down( int i )
+{
+    int size = static_cast<int>( m_heap.size() );
+    entry e = m_heap[i];
+    bool last = ( i == m_last );
+    for ( ;; ) {
+        int child = 2 * i + 1;
+        if ( child >= size ) {
+            break;
+        }
+        if ( child + 1 < size && m_heap[child + 1].when < m_heap[child].when ) {
+            ++child;
+        }
+        if ( !( m_heap[child].when < e.when ) ) {
+            break;
+        }
+        m_heap[i] = m_heap[child];
+        if ( m_last == child ) {
+            m_last = i;
+        }
+        i = child;
+    }
+    m_heap[i] = e;
+    if ( last ) {
+        m_last = i;
     }
-    m_ppq.insert( t );
 }
-    
-void sc_event_queue::fire_event()
+
+// Called by the kernel whenever m_e triggers: consume one notification of
+// the current time and schedule the next one, which is the next delta
+// cycle if more notifications are pending at the current time.
+
+void sc_event_queue::triggered()
 {
-    if ( m_ppq.empty() ) { // event has been cancelled
+    if ( m_heap.empty() ) { // event has been cancelled
         return;
     }
-    sc_time* t = m_ppq.extract_top();
-    sc_assert( *t==sc_time_stamp() );
-    delete t;
+    sc_assert( m_heap[0].when == sc_time_stamp() );
+    --m_pending;
+    if ( --m_heap[0].count == 0 ) {
+        remove_top();
+    }
 
-    if ( !m_ppq.empty() ) {
-	m_e.notify( *m_ppq.top() - sc_time_stamp() );
+    if ( !m_heap.empty() ) {
+	m_e.notify( m_heap[0].when - sc_time_stamp() );
     }
 }
 
@@ -46,6 +46,11 @@
   in order to ensure that sensitive processes can notice each
   trigger. The first trigger happens in the earliest delta cycle
   possible which is the same behavior as a normal timed event.
+
+  The pending notifications are kept by value in a binary heap, where
+  all notifications for the same time share a single counted entry.
+  The kernel advances the queue whenever its default event triggers,
+  no process of the queue is involved.
   
 */
 
@@ -54,9 +59,9 @@
 #include "sysc/kernel/sc_event.h"
 #include "sysc/communication/sc_port.h"
 
-namespace sc_core {
+#include <vector>
 
-SC_API_TEMPLATE_DECL_ sc_ppq<sc_time*>;
+namespace sc_core {
 
 // ---------------------------------------------------------------------------
 // sc_event_queue_if
@@ -68,8 +73,18 @@ public:
     virtual void notify (double when, sc_time_unit base) =0;
     virtual void notify (const sc_time& when) =0;
     virtual void cancel_all() =0;
+
+    // notify at each of the given n times
+    virtual void notify (const sc_time* when, int n);
 };
 
+inline
+void sc_event_queue_if::notify (const sc_time* when, int n)
+{
+    for ( int i = 0; i < n; ++i )
+        notify( when[i] );
+}
+
 // ---------------------------------------------------------------------------
 // sc_event_queue: a queue that can contain any number of pending 
 // delta, or timed events.
@@ -77,7 +92,8 @@ public:
 
 class SC_API sc_event_queue: 
   public sc_event_queue_if,
-  public sc_module
+  public sc_module,
+  private sc_event_trigger_hook
 {
  public:
 
@@ -94,8 +110,12 @@ class SC_API sc_event_queue:
     //
     inline virtual void notify (double when, sc_time_unit base);
            virtual void notify (const sc_time& when);
+           virtual void notify (const sc_time* when, int n);
            virtual void cancel_all();
 
+    // How many notifications are pending altogether?
+    unsigned pending() const { return m_pending; }
+
     //
     // API for using the event queue in processes
     //
@@ -112,22 +132,32 @@ class SC_API sc_event_queue:
     void cancel (const sc_time& when);
     void cancel (double when, sc_time_unit base);
 
-    // How many events are pending altogether?
-    unsigned pending() const;
-
     // How many events are pending at the specific time?
     unsigned pending(const sc_time& when) const;
     unsigned pending(double when, sc_time_unit base) const;
 */
 
  private:
-    void fire_event();
+    // pending notifications at the same time
+    struct entry
+    {
+        sc_time  when;
+        unsigned count;
+    };
+
+    void insert( const sc_time& when );
+    void remove_top();
+    void sift_up( int i );
+    void sift_down( int i );
+
+    virtual void triggered();
 
  private:
-    sc_ppq<sc_time*> m_ppq;
+    std::vector<entry> m_heap;   // min-heap of the pending times
+    int m_last;                  // heap index of the last inserted time
+    unsigned m_pending;          // number of pending notifications
     sc_event m_e;
     sc_dt::uint64 m_change_stamp;
-    unsigned m_pending_delta;
 };
 
 inline
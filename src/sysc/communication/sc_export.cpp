@@ -41,12 +41,14 @@ namespace sc_core {
 //
 // ----------------------------------------------------------------------------
 
-sc_export_base::sc_export_base() : sc_object(sc_gen_unique_name("export"))
+sc_export_base::sc_export_base()
+  : sc_object(sc_gen_unique_name("export")), m_registry_index(-1)
 {
     simcontext()->get_export_registry()->insert(this);
 }
     
-sc_export_base::sc_export_base(const char* name_) : sc_object(name_)
+sc_export_base::sc_export_base(const char* name_)
+  : sc_object(name_), m_registry_index(-1)
 {
     simcontext()->get_export_registry()->insert(this);
 }
@@ -176,6 +178,7 @@ sc_export_registry::insert( sc_export_base* export_ )
     }
 
     // insert
+    export_->m_registry_index = size();
     m_export_vec.push_back( export_ );
 }
 
@@ -183,20 +186,17 @@ void
 sc_export_registry::remove( sc_export_base* export_ )
 {
     if (size()==0) return;
-    int i;
-    for( i = size() - 1; i >= 0; -- i ) {
-	if( export_ == m_export_vec[i] ) {
-	    break;
-	}
-    }
-    if( i == -1 ) {
+    int i = export_->m_registry_index;
+    if( i < 0 || i >= size() || m_export_vec[i] != export_ ) {
         export_->report_error( SC_ID_SC_EXPORT_NOT_REGISTERED_ );
         return;
     }
 
     // remove
     m_export_vec[i] = m_export_vec.back();
+    m_export_vec[i]->m_registry_index = i;
     m_export_vec.pop_back();
+    export_->m_registry_index = -1;
 }
 
 // constructor
@@ -104,6 +104,8 @@ private:
     void start_simulation();
     void simulation_done();
 
+    int m_registry_index; // position in the sc_export_registry
+
     // disabled
     sc_export_base(const this_type&);
     this_type& operator = (const this_type& );
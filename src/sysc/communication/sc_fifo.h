@@ -36,7 +36,9 @@
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/tracing/sc_trace.h"
+#include <algorithm>
 #include <typeinfo>
+#include <utility>
 
 namespace sc_core {
 
@@ -87,6 +89,11 @@ public:
     // non-blocking read
     virtual bool nb_read( T& );
 
+    // block read: the samples are moved out of the buffer and a single
+    // update is requested per call
+    virtual void read( T*, int );
+    virtual int nb_read_n( T*, int );
+
 
     // get the number of available samples
 
@@ -106,6 +113,10 @@ public:
     // non-blocking write
     virtual bool nb_write( const T& );
 
+    // block write: a single update is requested per call
+    virtual void write( const T*, int );
+    virtual int nb_write_n( const T*, int );
+
 
     // get the number of free spaces
 
@@ -119,6 +130,18 @@ public:
 	{ return m_data_read_event; }
 
 
+    // zero-copy access: the window is the contiguous part of the buffer
+    // holding the next readable samples (or free spaces); its size is
+    // returned, and the first n entries are consumed (or published) by
+    // commit_read( n ) (or commit_write( n ))
+
+    int read_window( T*& );
+    void commit_read( int );
+
+    int write_window( T*& );
+    void commit_write( int );
+
+
     // other methods
 
     operator T ()
@@ -256,6 +279,50 @@ sc_fifo<T>::nb_read( T& val_ )
 }
 
 
+// block read
+
+template <class T>
+inline
+void
+sc_fifo<T>::read( T* buf_, int n_ )
+{
+    while( n_ > 0 ) {
+        while( num_available() == 0 ) {
+            sc_core::wait( m_data_written_event );
+        }
+        int n = sc_fifo<T>::nb_read_n( buf_, n_ );
+        buf_ += n;
+        n_ -= n;
+    }
+}
+
+template <class T>
+inline
+int
+sc_fifo<T>::nb_read_n( T* buf_, int n_ )
+{
+    int n = std::min( num_available(), n_ );
+    if( n <= 0 ) {
+        return 0;
+    }
+    // at most two contiguous chunks: up to the end of the buffer, then
+    // from its start
+    int first = std::min( n, m_size - m_ri );
+    T* src = m_buf + m_ri;
+    std::move( src, src + first, buf_ );
+    std::fill( src, src + first, T() ); // clear entries, see buf_read()
+    if( first < n ) {
+        std::move( m_buf, m_buf + ( n - first ), buf_ + first );
+        std::fill( m_buf, m_buf + ( n - first ), T() );
+    }
+    m_ri = ( m_ri + n ) % m_size;
+    m_free += n;
+    m_num_read += n;
+    request_update();
+    return n;
+}
+
+
 // blocking write
 
 template <class T>
@@ -288,6 +355,102 @@ sc_fifo<T>::nb_write( const T& val_ )
     return write_success;
 }
 
+// block write
+
+template <class T>
+inline
+void
+sc_fifo<T>::write( const T* buf_, int n_ )
+{
+    while( n_ > 0 ) {
+        while( num_free() == 0 ) {
+            sc_core::wait( m_data_read_event );
+        }
+        int n = sc_fifo<T>::nb_write_n( buf_, n_ );
+        buf_ += n;
+        n_ -= n;
+    }
+}
+
+template <class T>
+inline
+int
+sc_fifo<T>::nb_write_n( const T* buf_, int n_ )
+{
+    int n = std::min( num_free(), n_ );
+    if( n <= 0 ) {
+        return 0;
+    }
+    int first = std::min( n, m_size - m_wi );
+    std::copy( buf_, buf_ + first, m_buf + m_wi );
+    if( first < n ) {
+        std::copy( buf_ + first, buf_ + n, m_buf );
+    }
+    m_wi = ( m_wi + n ) % m_size;
+    m_free -= n;
+    m_num_written += n;
+    request_update();
+    return n;
+}
+
+
+// zero-copy access
+
+template <class T>
+inline
+int
+sc_fifo<T>::read_window( T*& ptr_ )
+{
+    ptr_ = m_buf + m_ri;
+    return std::min( num_available(), m_size - m_ri );
+}
+
+template <class T>
+inline
+void
+sc_fifo<T>::commit_read( int n_ )
+{
+    if( n_ < 0 || n_ > num_available() || n_ > m_size - m_ri ) {
+        SC_REPORT_ERROR( SC_ID_INVALID_FIFO_COMMIT_, "commit_read" );
+        return;
+    }
+    if( n_ == 0 ) {
+        return;
+    }
+    std::fill( m_buf + m_ri, m_buf + m_ri + n_, T() );
+    m_ri = ( m_ri + n_ ) % m_size;
+    m_free += n_;
+    m_num_read += n_;
+    request_update();
+}
+
+template <class T>
+inline
+int
+sc_fifo<T>::write_window( T*& ptr_ )
+{
+    ptr_ = m_buf + m_wi;
+    return std::min( num_free(), m_size - m_wi );
+}
+
+template <class T>
+inline
+void
+sc_fifo<T>::commit_write( int n_ )
+{
+    if( n_ < 0 || n_ > num_free() || n_ > m_size - m_wi ) {
+        SC_REPORT_ERROR( SC_ID_INVALID_FIFO_COMMIT_, "commit_write" );
+        return;
+    }
+    if( n_ == 0 ) {
+        return;
+    }
+    m_wi = ( m_wi + n_ ) % m_size;
+    m_free -= n_;
+    m_num_written += n_;
+    request_update();
+}
+
 
 template <class T>
 inline
@@ -413,7 +576,7 @@ sc_fifo<T>::buf_read( T& val_ )
     if( m_free == m_size ) {
 	return false;
     }
-    val_ = m_buf[m_ri];
+    val_ = std::move( m_buf[m_ri] );
     m_buf[m_ri] = T(); // clear entry for boost::shared_ptr, et al.
     m_ri = ( m_ri + 1 ) % m_size;
     m_free ++;
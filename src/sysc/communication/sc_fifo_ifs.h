@@ -49,6 +49,16 @@ public:
     // non-blocking read 
     virtual bool nb_read( T& ) = 0; 
 
+    // non-blocking read of up to n samples, returns the number read
+    virtual int nb_read_n( T* buf_, int n_ )
+    {
+        int i = 0;
+        while( i < n_ && nb_read( buf_[i] ) ) {
+            ++ i;
+        }
+        return i;
+    }
+
     // get the data written event 
     virtual const sc_event& data_written_event() const = 0; 
 }; 
@@ -68,6 +78,14 @@ public:
     // blocking read 
     virtual void read( T& ) = 0; 
     virtual T read() = 0; 
+
+    // blocking read of n samples
+    virtual void read( T* buf_, int n_ )
+    {
+        for( int i = 0; i < n_; ++ i ) {
+            read( buf_[i] );
+        }
+    }
 }; 
 
 // ----------------------------------------------------------------------------
@@ -115,6 +133,16 @@ public:
     // non-blocking write 
     virtual bool nb_write( const T& ) = 0; 
 
+    // non-blocking write of up to n samples, returns the number written
+    virtual int nb_write_n( const T* buf_, int n_ )
+    {
+        int i = 0;
+        while( i < n_ && nb_write( buf_[i] ) ) {
+            ++ i;
+        }
+        return i;
+    }
+
     // get the data read event 
     virtual const sc_event& data_read_event() const = 0; 
 }; 
@@ -134,6 +162,14 @@ public:
     // blocking write 
     virtual void write( const T& ) = 0; 
 
+    // blocking write of n samples
+    virtual void write( const T* buf_, int n_ )
+    {
+        for( int i = 0; i < n_; ++ i ) {
+            write( buf_[i] );
+        }
+    }
+
 }; 
 
 // ----------------------------------------------------------------------------
@@ -175,6 +211,11 @@ private:
   Description of Modification: Split up the interfaces into blocking and 
                                non blocking parts
     
+      Name, Affiliation, Date: 
+  Description of Modification: Added block transfers (read/write of n
+                               samples, nb_read_n, nb_write_n), which
+                               channels may implement more efficiently.
+
       Name, Affiliation, Date: 
   Description of Modification: 
 
@@ -128,6 +128,15 @@ public:
         { return (*this)->nb_read( value_ ); }
 
 
+    // block read
+
+    void read( data_type* buf_, int n_ )
+        { (*this)->read( buf_, n_ ); }
+
+    int nb_read_n( data_type* buf_, int n_ )
+        { return (*this)->nb_read_n( buf_, n_ ); }
+
+
     // get the number of available samples
 
     int num_available() const
@@ -252,6 +261,15 @@ public:
         { return (*this)->nb_write( value_ ); }
 
 
+    // block write
+
+    void write( const data_type* buf_, int n_ )
+        { (*this)->write( buf_, n_ ); }
+
+    int nb_write_n( const data_type* buf_, int n_ )
+        { return (*this)->nb_write_n( buf_, n_ ); }
+
+
     // get the number of free spaces
 
     int num_free() const
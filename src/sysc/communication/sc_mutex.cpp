@@ -42,13 +42,25 @@ namespace sc_core {
 sc_mutex::sc_mutex()
 : sc_object( sc_gen_unique_name( "mutex" ) ),
   m_owner( nullptr ),
-  m_free( sc_event::kernel_event, "free_event" )
+  m_free( sc_event::kernel_event, "free_event" ),
+  m_policy( SC_COMPETING_WAITERS ),
+  m_waiters()
 {}
 
 sc_mutex::sc_mutex( const char* name_ )
 : sc_object( name_ ),
   m_owner( nullptr ),
-  m_free( sc_event::kernel_event, "free_event" )
+  m_free( sc_event::kernel_event, "free_event" ),
+  m_policy( SC_COMPETING_WAITERS ),
+  m_waiters()
+{}
+
+sc_mutex::sc_mutex( const char* name_, sc_fairness_policy policy_ )
+: sc_object( name_ ),
+  m_owner( nullptr ),
+  m_free( sc_event::kernel_event, "free_event" ),
+  m_policy( policy_ ),
+  m_waiters()
 {}
 
 
@@ -61,14 +73,34 @@ sc_mutex::~sc_mutex()
 
 // blocks until mutex could be locked
 
+// Only the longest waiting process is resumed by unlock(). With the
+// SC_FIFO_WAITERS policy it already owns the mutex, otherwise it competes
+// and, if it loses, waits again at the head of the queue.
+
 int
 sc_mutex::lock()
 {
-    if ( m_owner == sc_get_current_process_b()) return 0;
+    sc_process_b* self = sc_get_current_process_b();
+    if ( m_owner == self ) return 0;
+    bool requeue = false;
     while( in_use() ) {
-	sc_core::wait( m_free, sc_get_curr_simcontext() );
+	sc_waiter_queue::waiter w( m_waiters, requeue );
+	try {
+	    w.wait();
+	}
+	catch( ... ) {
+	    // pass the mutex or the wake-up on when the process is unwound
+	    if( m_owner == self ) {
+		release( false );
+	    } else if( w.woken() && !in_use() ) {
+		m_waiters.wake_front( false );
+	    }
+	    throw;
+	}
+	if( m_owner == self ) return 0;
+	requeue = true;
     }
-    m_owner = sc_get_current_process_b();
+    m_owner = self;
     return 0;
 }
 
@@ -95,11 +127,27 @@ sc_mutex::unlock()
     if( m_owner != sc_get_current_process_b() ) {
 	return -1;
     }
-    m_owner = nullptr;
-    m_free.notify();
+    release( true );
     return 0;
 }
 
+
+void
+sc_mutex::release( bool immediate )
+{
+    if( m_policy == SC_FIFO_WAITERS && !m_waiters.empty() ) {
+	m_owner = m_waiters.wake_front( immediate );
+	return;
+    }
+    m_owner = nullptr;
+    if( immediate ) {
+	m_free.notify();
+    } else {
+	m_free.notify( SC_ZERO_TIME );
+    }
+    m_waiters.wake_front( immediate );
+}
+
 } // namespace sc_core
 
 // $Log: sc_mutex.cpp,v $
@@ -33,6 +33,7 @@
 #include "sysc/kernel/sc_object.h"
 #include "sysc/kernel/sc_wait.h"
 #include "sysc/communication/sc_mutex_if.h"
+#include "sysc/communication/sc_waiter_queue.h"
 
 namespace sc_core {
 
@@ -52,6 +53,7 @@ public:
 
     sc_mutex();
     explicit sc_mutex( const char* name_ );
+    sc_mutex( const char* name_, sc_fairness_policy policy_ );
 	virtual ~sc_mutex();
 
 
@@ -69,6 +71,9 @@ public:
     virtual const char* kind() const
         { return "sc_mutex"; }
 
+    sc_fairness_policy fairness_policy() const
+        { return m_policy; }
+
 protected:
 
     // support methods
@@ -81,6 +86,14 @@ protected:
     sc_process_b* m_owner;
     sc_event      m_free;
 
+private:
+
+    // unlock, or hand the mutex to the next waiter
+    void release( bool immediate );
+
+    sc_fairness_policy m_policy;
+    sc_waiter_queue    m_waiters;
+
 private:
 
     // disabled
@@ -125,13 +125,17 @@ struct sc_bind_info
     [[nodiscard]] sc_port_policy policy() const; 
     [[nodiscard]] int            size() const;
 
+    // state of the port in the traversal of sc_port_registry
+    enum visit_state { UNVISITED, VISITING, ORDERED };
+
     int                        m_max_size;
     sc_port_policy             m_policy;
-    std::vector<sc_bind_elem*> vec;
+    std::vector<sc_bind_elem>  vec;
     bool                       has_parent;
     int                        last_add;
     bool                       is_leaf;
     bool                       complete;
+    visit_state                visit;
 
     ef_vector                  thread_vec;
     ef_vector                  method_vec;
@@ -148,18 +152,15 @@ sc_bind_info::sc_bind_info( int max_size_, sc_port_policy policy_ )
   has_parent( false ),
   last_add( -1 ),
   is_leaf( true ),
-  complete( false )
+  complete( false ),
+  visit( UNVISITED )
 {}
 
 
 // destructor
 
 sc_bind_info::~sc_bind_info()
-{
-    for( int i = size() - 1; i >= 0; -- i ) {
-	delete vec[i];
-    }
-}
+= default;
 
 
 int
@@ -233,7 +234,8 @@ sc_port_base::sc_port_base(
     int max_size_, sc_port_policy policy 
 ) : 
     sc_object( sc_gen_unique_name( "port" ) ),
-    m_bind_info(nullptr)
+    m_bind_info(nullptr),
+    m_registry_index(-1)
 {
     simcontext()->get_port_registry()->insert( this );
     m_bind_info = new sc_bind_info( max_size_, policy );
@@ -243,7 +245,8 @@ sc_port_base::sc_port_base(
     const char* name_, int max_size_, sc_port_policy policy 
 ) : 
     sc_object( name_ ),
-    m_bind_info(nullptr)
+    m_bind_info(nullptr),
+    m_registry_index(-1)
 {
     simcontext()->get_port_registry()->insert( this );
     m_bind_info = new sc_bind_info( max_size_, policy );
@@ -271,7 +274,7 @@ sc_port_base::bind( sc_interface& interface_ )
         return;
     }
 
-    m_bind_info->vec.push_back( new sc_bind_elem( &interface_ ) );
+    m_bind_info->vec.push_back( sc_bind_elem( &interface_ ) );
     
     if( ! m_bind_info->has_parent ) {
 	// add (cache) the interface
@@ -300,18 +303,23 @@ sc_port_base::bind( this_type& parent_ )
     // check if parent port is already bound to this port
 #if 0
     for( int i = m_bind_info->size() - 1; i >= 0; -- i ) {
-        if( &parent_ == m_bind_info->vec[i]->parent ) {
+        if( &parent_ == m_bind_info->vec[i].parent ) {
             report_error( SC_ID_BIND_PORT_TO_PORT_, "already bound" );
             return;
         }
     }
 #endif // 
 
-    m_bind_info->vec.push_back( new sc_bind_elem( &parent_ ) );
+    m_bind_info->vec.push_back( sc_bind_elem( &parent_ ) );
     m_bind_info->has_parent = true;
     parent_.m_bind_info->is_leaf = false;
 }
 
+// called by complete_binding (does nothing by default)
+
+void sc_port_base::reserve_interfaces( int )
+{}
+
 // called by construction_done (null by default)
 
 void sc_port_base::before_end_of_elaboration() 
@@ -394,51 +402,40 @@ sc_port_base::make_sensitive( sc_method_handle handle_,
 
 // support methods
 
-int
-sc_port_base::first_parent()
-{
-    for( int i = 0; i < m_bind_info->size(); ++ i ) {
-	if( m_bind_info->vec[i]->parent != nullptr ) {
-	    return i;
-	}
-    }
-    return -1;
-}
+// replace the parent ports in the bind vector by their interfaces, the
+// bindings of the parent ports are complete already
 
 void
-sc_port_base::insert_parent( int i )
+sc_port_base::insert_parents()
 {
-    std::vector<sc_bind_elem*>& vec = m_bind_info->vec;
+    std::vector<sc_bind_elem>& vec = m_bind_info->vec;
 
-    this_type* parent = vec[i]->parent;
+    // count the resulting elements first, so that the vector is built in a
+    // single pass. A parent without binding leaves an unbound element.
 
+    std::size_t count = 0;
+    for( std::size_t i = 0; i < vec.size(); ++ i ) {
+        const this_type* parent = vec[i].parent;
+        count += ( parent && !parent->m_bind_info->vec.empty() )
+               ? parent->m_bind_info->vec.size() : 1;
+    }
 
-    // IF OUR PARENT HAS NO BINDING THEN IGNORE IT:
-    //
-    // Note that the zeroing of the parent pointer must occur before this
-    // test
-
-    vec[i]->parent = nullptr;
-    if ( parent->m_bind_info->vec.empty() ) return;
-
-    vec[i]->iface = parent->m_bind_info->vec[0]->iface;
-    int n = parent->m_bind_info->size() - 1;
-    if( n > 0 ) {
-	// resize the bind vector (by adding new elements)
-	for( int k = 0; k < n; ++ k ) {
-	    vec.push_back( new sc_bind_elem() );
-	}
-	// move elements in the bind vector
-	for( int k = m_bind_info->size() - n - 1; k > i; -- k ) {
-	    vec[k + n]->iface = vec[k]->iface;
-	    vec[k + n]->parent = vec[k]->parent;
-	}
-	// insert parent interfaces into the bind vector
-	for( int k = i + 1; k <= i + n; ++ k ) {
-	    vec[k]->iface = parent->m_bind_info->vec[k - i]->iface;
-	    vec[k]->parent = nullptr;
-	}
+    std::vector<sc_bind_elem> resolved;
+    resolved.reserve( count );
+    for( std::size_t i = 0; i < vec.size(); ++ i ) {
+        const this_type* parent = vec[i].parent;
+        if( parent == nullptr ) {
+            resolved.push_back( vec[i] );
+        } else if( parent->m_bind_info->vec.empty() ) {
+            resolved.push_back( sc_bind_elem() );
+        } else {
+            const std::vector<sc_bind_elem>& pvec = parent->m_bind_info->vec;
+            for( std::size_t k = 0; k < pvec.size(); ++ k ) {
+                resolved.push_back( sc_bind_elem( pvec[k].iface ) );
+            }
+        }
     }
+    vec.swap( resolved );
 }
 
 
@@ -455,19 +452,27 @@ sc_port_base::complete_binding()
     }
 
     // COMPLETE BINDING OF OUR PARENT PORTS SO THAT WE CAN USE THAT INFORMATION:
-
-    int i = first_parent();
-    while( i >= 0 ) {
-        m_bind_info->vec[i]->parent->complete_binding();
-        insert_parent( i );
-        i = first_parent();
+    //
+    // sc_port_registry::complete_binding() completes the parent ports first,
+    // so this recursion only happens for ports completed out of that order.
+
+    if( m_bind_info->has_parent ) {
+        for( int i = 0; i < m_bind_info->size(); ++ i ) {
+            this_type* parent = m_bind_info->vec[i].parent;
+            if( parent != nullptr && !parent->m_bind_info->complete ) {
+                parent->complete_binding();
+            }
+        }
+        insert_parents();
     }
 
     // LOOP OVER BINDING INFORMATION TO COMPLETE THE BINDING PROCESS:
 
+    reserve_interfaces( m_bind_info->size() );
+
     int size;
     for( int j = 0; j < m_bind_info->size(); ++ j ) {
-        sc_interface* iface = m_bind_info->vec[j]->iface;
+        sc_interface* iface = m_bind_info->vec[j].iface;
 
 	// if the interface is zero this was for an unbound port.
 	if ( iface == nullptr ) continue;
@@ -644,26 +649,24 @@ sc_port_registry::insert( sc_port_base* port_ )
     curr_module->append_port( port_ );
 
     // insert
+    port_->m_registry_index = size();
     m_port_vec.push_back( port_ );
 }
 
 void
 sc_port_registry::remove( sc_port_base* port_ )
 {
-    int i;
-    for( i = size() - 1; i >= 0; -- i ) {
-	if( port_ == m_port_vec[i] ) {
-	    break;
-	}
-    }
-    if( i == -1 ) {
+    int i = port_->m_registry_index;
+    if( i < 0 || i >= size() || m_port_vec[i] != port_ ) {
         port_->report_error( SC_ID_REMOVE_PORT_, "port not registered" );
         return;
     }
 
     // remove
     m_port_vec[i] = m_port_vec.back();
+    m_port_vec[i]->m_registry_index = i;
     m_port_vec.pop_back();
+    port_->m_registry_index = -1;
 }
 
 
@@ -698,24 +701,79 @@ sc_port_registry::construction_done()
     return false;
 }
 
-// called when when elaboration is done
+// called when elaboration is done, returns the number of bound interfaces
 
-void
+std::size_t
 sc_port_registry::complete_binding()
 {
+    // ORDER THE PORTS SO THAT EACH PORT FOLLOWS THE PORTS IT IS BOUND TO:
+    //
+    // The port-to-port bindings form a graph, which is traversed once
+    // depth-first with an explicit stack instead of recursing per port. A
+    // port is appended to the order after all of its parents, so every
+    // binding is resolved exactly once and in the same order as before, in
+    // time linear in the number of bindings.
+
+    std::vector<sc_port_base*> order;
+    order.reserve( m_port_vec.size() );
+    std::vector< std::pair<sc_port_base*, int> > stack;
+
     for( int i = size() - 1; i >= 0; -- i ) {
-        m_port_vec[i]->complete_binding();
+        sc_bind_info* info = m_port_vec[i]->m_bind_info;
+        if( info->complete || info->visit != sc_bind_info::UNVISITED ) {
+            continue;
+        }
+        info->visit = sc_bind_info::VISITING;
+        stack.push_back( std::make_pair( m_port_vec[i], 0 ) );
+
+        while( !stack.empty() ) {
+            sc_port_base* port = stack.back().first;
+            std::vector<sc_bind_elem>& vec = port->m_bind_info->vec;
+            int next = stack.back().second;
+            sc_port_base* parent = nullptr;
+
+            while( parent == nullptr && next < static_cast<int>( vec.size() ) ) {
+                sc_port_base* p = vec[next++].parent;
+                if( p == nullptr || p->m_bind_info->complete ||
+                    p->m_bind_info->visit == sc_bind_info::ORDERED ) {
+                    continue;
+                }
+                if( p->m_bind_info->visit == sc_bind_info::VISITING ) {
+                    port->report_error( SC_ID_BIND_PORT_TO_PORT_,
+                                        "cyclic binding" );
+                    // may continue, if suppressed
+                    vec[next - 1].parent = nullptr;
+                    continue;
+                }
+                parent = p;
+            }
+            stack.back().second = next;
+
+            if( parent != nullptr ) {
+                parent->m_bind_info->visit = sc_bind_info::VISITING;
+                stack.push_back( std::make_pair( parent, 0 ) );
+            } else {
+                port->m_bind_info->visit = sc_bind_info::ORDERED;
+                order.push_back( port );
+                stack.pop_back();
+            }
+        }
     }
+
+    std::size_t bound = 0;
+    for( std::size_t i = 0; i < order.size(); ++ i ) {
+        order[i]->complete_binding();
+        bound += order[i]->interface_count();
+    }
+    return bound;
 }
 
 
-// called when elaboration is done
+// called when elaboration is done, after complete_binding()
 
 void
 sc_port_registry::elaboration_done()
 {
-    complete_binding();
-
     for( int i = size() - 1; i >= 0; -- i ) {
         m_port_vec[i]->elaboration_done();
     }
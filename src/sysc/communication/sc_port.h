@@ -128,6 +128,7 @@ private:
     // called by complete_binding (for internal use only)
     virtual void add_interface( sc_interface* ) = 0;
     virtual int interface_count() const = 0;
+    virtual void reserve_interfaces( int );
 
     const char* if_typename() const
       { return get_interface_type().name(); }
@@ -165,8 +166,7 @@ private:
 
 
     // support methods
-    int first_parent();
-    void insert_parent( int );
+    void insert_parents();
 
     // called when construction is done
     void construction_done();
@@ -188,6 +188,10 @@ protected:
 
     sc_bind_info* m_bind_info;
 
+private:
+
+    int           m_registry_index; // position in the sc_port_registry
+
 private:
 
     // disabled
@@ -224,8 +228,8 @@ private:
     // destructor
     ~sc_port_registry();
 
-    // called when by construction_done and elaboration done
-    void complete_binding();
+    // called when elaboration is done, before elaboration_done
+    std::size_t complete_binding();
 
     // called when construction is done
     bool construction_done();
@@ -363,6 +367,8 @@ private:
     // called by complete_binding (for internal use only)
     virtual void add_interface( sc_interface* );
     virtual int interface_count() const;
+    virtual void reserve_interfaces( int n_ )
+        { m_interface_vec.reserve( n_ ); }
 
     // disabled
     sc_port_b();
@@ -32,6 +32,7 @@
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_object_int.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 
 #ifndef SC_DISABLE_ASYNC_UPDATES
 #  include "sysc/communication/sc_host_mutex.h"
@@ -39,6 +40,7 @@
 #endif
 
 #include <algorithm> // std::find
+#include <atomic>
 
 namespace sc_core {
 
@@ -53,7 +55,10 @@ namespace sc_core {
 sc_prim_channel::sc_prim_channel()
 : sc_object( nullptr ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( nullptr ) 
+  m_update_kernel( &sc_prim_channel::virtual_update ),
+  m_update_requested( false ),
+  m_async_requested( false ),
+  m_async_next_p( nullptr )
 {
     m_registry->insert( *this );
 }
@@ -61,7 +66,10 @@ sc_prim_channel::sc_prim_channel()
 sc_prim_channel::sc_prim_channel( const char* name_ )
 : sc_object( name_ ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( nullptr )
+  m_update_kernel( &sc_prim_channel::virtual_update ),
+  m_update_requested( false ),
+  m_async_requested( false ),
+  m_async_next_p( nullptr )
 {
     m_registry->insert( *this );
 }
@@ -82,6 +90,15 @@ sc_prim_channel::update()
 {}
 
 
+// the update kernel (none by default, update() is called)
+
+sc_prim_channel::update_kernel
+sc_prim_channel::get_update_kernel() const
+{
+    return nullptr;
+}
+
+
 // called by construction_done (does nothing by default)
 
 void sc_prim_channel::before_end_of_elaboration() 
@@ -156,44 +173,66 @@ public:
 
     [[nodiscard]] bool pending() const
     {
-	return !m_push_queue.empty();
+	return m_push_head.load( std::memory_order_acquire ) != nullptr;
     }
 
+    // The kernel announces that it is about to sleep before it checks for
+    // pending updates, while appenders check the announcement after they
+    // published their channel. Both sides use sequentially consistent
+    // operations, so at least one of them sees the other.
+
     void suspend()
     {
         if( m_has_suspending_channels ) {
-            m_suspend_semaphore.wait();
-            m_suspend_semaphore.post(); // replace token
+            while( true ) {
+                m_sleeping.store( true );
+                if( pending() ) break;
+                m_suspend_semaphore.wait(); // may be a stale wake-up
+            }
+            m_sleeping.store( false );
         }
     }
 
+    // Lock-free, may be called from any number of host threads. Requests
+    // of a channel not yet accepted by the kernel are coalesced.
+
     void append( sc_prim_channel& prim_channel_ )
     {
-        sc_scoped_lock lock( m_mutex );
-        m_push_queue.push_back( &prim_channel_ );
-        m_suspend_semaphore.post();
-        // return releases the mutex
+        if( prim_channel_.m_async_requested.exchange( true ) )
+            return;
+
+        sc_prim_channel* head_p = m_push_head.load( std::memory_order_relaxed );
+        do {
+            prim_channel_.m_async_next_p = head_p;
+        } while( !m_push_head.compare_exchange_weak( head_p, &prim_channel_ ) );
+
+        // wake up the kernel only if it waits for updates
+        if( m_sleeping.load() && m_sleeping.exchange( false ) )
+            m_suspend_semaphore.post();
     }
 
     void accept_updates()
     {
-	sc_assert( m_pop_queue.empty() );
+	sc_prim_channel* list_p = m_push_head.exchange( nullptr );
+
+	// restore the order of the requests
+	sc_prim_channel* pop_p = nullptr;
+	while( list_p != nullptr )
 	{
-	    sc_scoped_lock lock( m_mutex );
-	    m_push_queue.swap( m_pop_queue );
-	    // leaving the block releases the mutex
+	    sc_prim_channel* next_p = list_p->m_async_next_p;
+	    list_p->m_async_next_p = pop_p;
+	    pop_p = list_p;
+	    list_p = next_p;
 	}
 
-	auto it = m_pop_queue.begin(); auto end = m_pop_queue.end();
-	while( it!= end )
+	while( pop_p != nullptr )
 	{
-	    // we use request_update instead of perform_update
-	    // to skip duplicates
-	    (*it++)->request_update();
-	    int sem_trywait = m_suspend_semaphore.trywait(); // this must never block !
-	    sc_assert( sem_trywait == 0 );
+	    sc_prim_channel* next_p = pop_p->m_async_next_p;
+	    // later requests of this channel are queued again from here on
+	    pop_p->m_async_requested.store( false );
+	    pop_p->request_update();
+	    pop_p = next_p;
 	}
-	m_pop_queue.clear();
     }
 
     bool attach_suspending( sc_prim_channel& p )
@@ -228,10 +267,10 @@ public:
     async_update_list() = default;
 
 private:
-    sc_host_mutex                   m_mutex;
+    sc_host_mutex                   m_mutex; // suspending channels only.
     sc_host_semaphore               m_suspend_semaphore;
-    std::vector< sc_prim_channel* > m_push_queue;
-    std::vector< sc_prim_channel* > m_pop_queue;
+    std::atomic<sc_prim_channel*>   m_push_head{};  // requests, latest first.
+    std::atomic<bool>               m_sleeping{};   // kernel in suspend().
     std::vector< sc_prim_channel* > m_suspending_channels;
     bool                            m_has_suspending_channels{};
 
@@ -354,7 +393,12 @@ sc_prim_channel_registry::async_detach_suspending(sc_prim_channel& p)
 // |"sc_prim_channel_registry::perform_update"
 // |
 // | This method updates the values of the primitive channels in its update
-// | lists.
+// | list. The list is a contiguous array of requests, each of which carries
+// | the update kernel of its channel, so plain channels are updated without
+// | a virtual call. The requests are performed in reverse order, which keeps
+// | the order of the delta notifications (and thereby the order of process
+// | execution) of the former linked list. Updates requested by the updates
+// | themselves are left for the next update phase.
 // +----------------------------------------------------------------------------
 void
 sc_prim_channel_registry::perform_update()
@@ -367,19 +411,36 @@ sc_prim_channel_registry::perform_update()
 	m_async_update_list_p->accept_updates();
 #endif
 
-    sc_prim_channel* next_p; // Next update to perform.
-    sc_prim_channel* now_p;  // Update now performing.
-
     // Update the values for the primitive channels in the simulator's list.
 
-    now_p = m_update_list_p;
-    m_update_list_p = (sc_prim_channel*)sc_prim_channel::list_end;
-    for ( ; now_p != (sc_prim_channel*)sc_prim_channel::list_end;
-	now_p = next_p )
+    m_update_vec.swap( m_performed_vec );
+    m_updates = static_cast<int>( m_performed_vec.size() );
+    m_unchanged_updates = 0;
+
+    const update_request* begin_p = m_performed_vec.data();
+    for( const update_request* now_p = begin_p + m_updates;
+         now_p != begin_p; )
     {
-	next_p = now_p->m_update_next_p;
-	now_p->perform_update();
+        -- now_p;
+        now_p->channel_p->m_update_requested = false;
+        now_p->kernel( now_p->channel_p );
     }
+    m_performed_vec.clear();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::defer_update"
+// |
+// | This method records an update request of an isolated method process
+// | executing within a parallel evaluation batch. The request is replayed
+// | on the simulator thread once the batch is complete, so the update list
+// | itself is never touched concurrently.
+// +----------------------------------------------------------------------------
+void
+sc_prim_channel_registry::defer_update( sc_prim_channel& prim_channel_ )
+{
+    sc_parallel_evaluator::defer( sc_parallel_evaluator::DEFER_UPDATE,
+                                  &prim_channel_ );
 }
 
 // constructor
@@ -388,7 +449,11 @@ sc_prim_channel_registry::sc_prim_channel_registry( sc_simcontext& simc_ )
   :  m_async_update_list_p(nullptr)
   ,  m_construction_done(0)
   ,  m_simc( &simc_ )
-  ,  m_update_list_p((sc_prim_channel*)sc_prim_channel::list_end)
+  ,  m_update_vec()
+  ,  m_performed_vec()
+  ,  m_updates(0)
+  ,  m_unchanged_updates(0)
+  ,  m_deferred_updates(false)
 {
 #   ifndef SC_DISABLE_ASYNC_UPDATES
         m_async_update_list_p = new async_update_list();
@@ -428,6 +493,17 @@ sc_prim_channel_registry::elaboration_done()
     for( int i = 0; i < size(); ++ i ) {
 	m_prim_channel_vec[i]->elaboration_done();
     }
+
+    // the types of all channels are complete now, choose their update
+    // kernels (pending requests keep the kernel they were requested with)
+    for( int i = 0; i < size(); ++ i ) {
+        sc_prim_channel* prim_channel_p = m_prim_channel_vec[i];
+        sc_prim_channel::update_kernel kernel =
+          prim_channel_p->get_update_kernel();
+        if( kernel ) {
+            prim_channel_p->m_update_kernel = kernel;
+        }
+    }
 }
 
 // called before simulation begins
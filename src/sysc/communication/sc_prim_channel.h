@@ -33,6 +33,9 @@
 #include "sysc/kernel/sc_wait.h"
 #include "sysc/kernel/sc_wait_cthread.h"
 
+#include <atomic>
+#include <vector>
+
 namespace sc_core {
 
 // ----------------------------------------------------------------------------
@@ -53,7 +56,7 @@ public:
         { return "sc_prim_channel"; }
 
     inline bool update_requested() 
-	{ return m_update_next_p != (sc_prim_channel*)list_end; }
+	{ return m_update_requested; }
 
     // request the update method to be executed during the update phase
     inline void request_update();
@@ -62,6 +65,11 @@ public:
     // from a process external to the simulator.
     void async_request_update();
 
+    // is an asynchronous update request waiting to be accepted by the
+    // kernel? (may be polled by external threads to limit their rate)
+    bool async_update_requested() const
+        { return m_async_requested.load( std::memory_order_acquire ); }
+
 protected:
 
     // constructors
@@ -74,6 +82,17 @@ protected:
     // the update method (does nothing by default)
     virtual void update();
 
+    // function performing the update of a channel without virtual dispatch
+    typedef void (*update_kernel)( sc_prim_channel* );
+
+    // the update kernel of this channel, or 0 to call update() (default);
+    // queried once elaboration is done
+    virtual update_kernel get_update_kernel() const;
+
+    // count an update that left the channel unchanged, see
+    // sc_prim_channel_registry::unchanged_updates()
+    inline void update_unchanged();
+
     // called by construction_done (does nothing by default)
     virtual void before_end_of_elaboration();
 
@@ -200,8 +219,8 @@ protected:
 
 private:
 
-    // called during the update phase of a delta cycle (if requested)
-    void perform_update();
+    // the update kernel calling the virtual update()
+    static void virtual_update( sc_prim_channel* );
 
     // called when construction is done
     void construction_done();
@@ -222,7 +241,10 @@ private:
 private:
 
     sc_prim_channel_registry* m_registry;          // Update list manager.
-    sc_prim_channel*          m_update_next_p;     // Next entry in update list.
+    update_kernel             m_update_kernel;     // Performs the update.
+    bool                      m_update_requested;  // In update list.
+    std::atomic<bool>         m_async_requested;   // In async update list.
+    sc_prim_channel*          m_async_next_p;      // Next entry in async list.
 };
 
 
@@ -235,7 +257,9 @@ private:
 
 class sc_prim_channel_registry
 {
+    friend class sc_prim_channel;
     friend class sc_simcontext;
+    friend class sc_parallel_evaluator;
 
 public:
 
@@ -251,10 +275,16 @@ public:
 
     bool pending_updates() const
     { 
-        return m_update_list_p != (sc_prim_channel*)sc_prim_channel::list_end 
-               || pending_async_updates();
+        return !m_update_vec.empty() || pending_async_updates();
     }   
 
+    // number of updates performed in the last update phase, and how many
+    // of them left their channel unchanged
+    int updates() const
+        { return m_updates; }
+    int unchanged_updates() const
+        { return m_unchanged_updates; }
+
     bool pending_async_updates() const;
 
     // synchronization with attached async suspending channels
@@ -294,6 +324,9 @@ private:
     // called after simulation ends
     void simulation_done();
 
+    // called instead of request_update() during a parallel evaluation
+    void defer_update( sc_prim_channel& );
+
     // disabled
     sc_prim_channel_registry();
     sc_prim_channel_registry( const sc_prim_channel_registry& );
@@ -302,11 +335,22 @@ private:
 private:
     class async_update_list;   
 
+    // pending update of a channel
+    struct update_request
+    {
+        sc_prim_channel*               channel_p;
+        sc_prim_channel::update_kernel kernel;
+    };
+
     async_update_list*            m_async_update_list_p; // external updates.
     int                           m_construction_done;   // # of constructs.
     std::vector<sc_prim_channel*> m_prim_channel_vec;    // existing channels.
     sc_simcontext*                m_simc;                // simulator context.
-    sc_prim_channel*              m_update_list_p;       // internal updates.
+    std::vector<update_request>   m_update_vec;          // internal updates.
+    std::vector<update_request>   m_performed_vec;       // being updated.
+    int                           m_updates;             // last update phase.
+    int                           m_unchanged_updates;   // last update phase.
+    bool                          m_deferred_updates;    // parallel evaluation.
 };
 
 
@@ -323,8 +367,13 @@ inline
 void
 sc_prim_channel_registry::request_update( sc_prim_channel& prim_channel_ )
 {
-    prim_channel_.m_update_next_p = m_update_list_p;
-    m_update_list_p = &prim_channel_;
+    if( SC_UNLIKELY_( m_deferred_updates ) ) {
+        defer_update( prim_channel_ );
+        return;
+    }
+    prim_channel_.m_update_requested = true;
+    update_request request = { &prim_channel_, prim_channel_.m_update_kernel };
+    m_update_vec.push_back( request );
 }
 
 // ----------------------------------------------------------------------------
@@ -339,11 +388,20 @@ inline
 void
 sc_prim_channel::request_update()
 {
-    if( ! m_update_next_p ) {
+    if( ! m_update_requested ) {
 	m_registry->request_update( *this );
     }
 }
 
+// count an update that left the channel unchanged
+
+inline
+void
+sc_prim_channel::update_unchanged()
+{
+    ++ m_registry->m_unchanged_updates;
+}
+
 // request the update method from external to the simulator (to be executed 
 // during the update phase)
 
@@ -369,14 +427,13 @@ sc_prim_channel::async_detach_suspending()
 }
 
 
-// called during the update phase of a delta cycle (if requested)
+// the update kernel calling the virtual update()
 
 inline
 void
-sc_prim_channel::perform_update()
+sc_prim_channel::virtual_update( sc_prim_channel* prim_channel_p )
 {
-    update();
-    m_update_next_p = 0;
+    prim_channel_p->update();
 }
 
 
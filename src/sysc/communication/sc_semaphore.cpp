@@ -59,7 +59,9 @@ sc_semaphore::report_error( const char* id, const char* add_msg ) const
 sc_semaphore::sc_semaphore( int init_value_ )
 : sc_object( sc_gen_unique_name( "semaphore" ) ),
   m_free( sc_event::kernel_event, "free_event" ),
-  m_value( init_value_ )
+  m_value( init_value_ ),
+  m_policy( SC_COMPETING_WAITERS ),
+  m_waiters()
 {
     if( m_value < 0 ) {
 	report_error( SC_ID_INVALID_SEMAPHORE_VALUE_ );
@@ -69,7 +71,22 @@ sc_semaphore::sc_semaphore( int init_value_ )
 sc_semaphore::sc_semaphore( const char* name_, int init_value_ )
 : sc_object( name_ ), 
   m_free( sc_event::kernel_event, "free_event" ),
-  m_value( init_value_ )
+  m_value( init_value_ ),
+  m_policy( SC_COMPETING_WAITERS ),
+  m_waiters()
+{
+    if( m_value < 0 ) {
+	report_error( SC_ID_INVALID_SEMAPHORE_VALUE_ );
+    }
+}
+
+sc_semaphore::sc_semaphore( const char* name_, int init_value_,
+                            sc_fairness_policy policy_ )
+: sc_object( name_ ),
+  m_free( sc_event::kernel_event, "free_event" ),
+  m_value( init_value_ ),
+  m_policy( policy_ ),
+  m_waiters()
 {
     if( m_value < 0 ) {
 	report_error( SC_ID_INVALID_SEMAPHORE_VALUE_ );
@@ -80,12 +97,34 @@ sc_semaphore::sc_semaphore( const char* name_, int init_value_ )
 // interface methods
 
 // lock (take) the semaphore, block if not available
+//
+// Only the longest waiting process is resumed by post(). With the
+// SC_FIFO_WAITERS policy the semaphore has already been taken for it,
+// otherwise it competes and, if it loses, waits again at the head of the
+// queue.
 
 int
 sc_semaphore::wait()
 {
+    bool requeue = false;
     while( in_use() ) {
-	sc_core::wait( m_free, sc_get_curr_simcontext() );
+	sc_waiter_queue::waiter w( m_waiters, requeue );
+	try {
+	    w.wait();
+	}
+	catch( ... ) {
+	    // pass the semaphore or the wake-up on when the process is unwound
+	    if( w.woken() ) {
+		if( m_policy == SC_FIFO_WAITERS ) {
+		    release( false );
+		} else if( !in_use() ) {
+		    m_waiters.wake_front( false );
+		}
+	    }
+	    throw;
+	}
+	if( m_policy == SC_FIFO_WAITERS ) return 0;
+	requeue = true;
     }
     -- m_value;
     return 0;
@@ -110,11 +149,27 @@ sc_semaphore::trywait()
 int
 sc_semaphore::post()
 {
-    ++m_value;
-    m_free.notify();
+    release( true );
     return 0;
 }
 
+
+void
+sc_semaphore::release( bool immediate )
+{
+    if( m_policy == SC_FIFO_WAITERS && !m_waiters.empty() ) {
+	m_waiters.wake_front( immediate );
+	return;
+    }
+    ++m_value;
+    if( immediate ) {
+	m_free.notify();
+    } else {
+	m_free.notify( SC_ZERO_TIME );
+    }
+    m_waiters.wake_front( immediate );
+}
+
 } // namespace sc_core
 
 // $Log: sc_semaphore.cpp,v $
@@ -33,6 +33,7 @@
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_object.h"
 #include "sysc/communication/sc_semaphore_if.h"
+#include "sysc/communication/sc_waiter_queue.h"
 
 namespace sc_core {
 
@@ -52,6 +53,8 @@ public:
 
     explicit sc_semaphore( int init_value_ );
     sc_semaphore( const char* name_, int init_value_ );
+    sc_semaphore( const char* name_, int init_value_,
+                  sc_fairness_policy policy_ );
 
 
     // interface methods
@@ -72,6 +75,9 @@ public:
     virtual const char* kind() const
         { return "sc_semaphore"; }
 
+    sc_fairness_policy fairness_policy() const
+        { return m_policy; }
+
 protected:
 
     // support methods
@@ -88,6 +94,14 @@ protected:
     sc_event m_free;        // event to block on when m_value is negative
     int      m_value;       // current value of the semaphore
 
+private:
+
+    // give the semaphore, or hand it to the next waiter
+    void release( bool immediate );
+
+    sc_fairness_policy m_policy;
+    sc_waiter_queue    m_waiters;
+
 private:
 
     // disabled
@@ -0,0 +1,555 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_shm_fifo.cpp -- The shared memory segment of sc_shm_fifo_writer<T> and
+                     sc_shm_fifo_reader<T>.
+
+  CHANGE LOG IS AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/communication/sc_shm_fifo.h"
+#include "sysc/kernel/sc_dynamic_processes.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_spawn.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#if !defined(WIN32) && !defined(_WIN32) // use POSIX shared memory
+# define SC_SHM_FIFO_POSIX_
+# include <cerrno>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace sc_core {
+
+namespace {
+
+// layout of the start of the segment, followed by the ring buffer
+
+enum shm_end_state
+{
+    SHM_END_DETACHED = 0,
+    SHM_END_ATTACHED,
+    SHM_END_CLOSED
+};
+
+const std::uint32_t shm_magic = 0x5c5f1f01u;
+
+// published local time of an end not taking part in the synchronization
+const std::uint64_t shm_unsynchronized = ~std::uint64_t( 0 );
+
+// the counts are modified by different processes, keep them apart
+struct alignas( 64 ) shm_count
+{
+    std::atomic<std::uint64_t> value;
+};
+
+struct shm_header
+{
+    std::atomic<std::uint32_t> magic;        // set last by the creator
+    std::uint32_t              element_size;
+    std::uint64_t              capacity;
+    std::atomic<std::uint32_t> state[2];     // shm_end_state, writer/reader
+    std::atomic<std::uint32_t> closed_ends;
+    std::atomic<std::uint64_t> time[2];      // local time (fs), writer/reader
+    shm_count                  count[2];     // samples written/read
+};
+
+const std::size_t shm_slots_offset = ( sizeof( shm_header ) + 63 ) & ~63u;
+
+// wait politely for the other host process
+
+inline void
+shm_backoff( unsigned idle_ )
+{
+    if( idle_ < 64 ) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(
+          std::chrono::microseconds( 1u << std::min( idle_ - 64, 10u ) ) );
+    }
+}
+
+} // namespace
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_fifo_segment (implementation-defined)
+//
+//  The mapping of the segment and the host thread of one end.
+// ----------------------------------------------------------------------------
+
+class sc_shm_fifo_segment
+{
+public:
+
+    sc_shm_fifo_segment( void* map_, std::size_t size_, bool writer_ )
+      : m_header( *static_cast<shm_header*>( map_ ) ),
+        m_map_p( map_ ),
+        m_size( size_ ),
+        m_own( writer_ ? 0 : 1 ),
+        m_peer( writer_ ? 1 : 0 ),
+        m_resolution_fs( static_cast<std::uint64_t>(
+          sc_get_time_resolution().to_seconds() * 1e15 + 0.5 ) ),
+        m_watcher(),
+        m_stop( false )
+      {}
+
+    ~sc_shm_fifo_segment()
+    {
+        stop_watcher();
+#if defined(SC_SHM_FIFO_POSIX_)
+        ::munmap( m_map_p, m_size );
+#endif
+    }
+
+    void start_watcher( sc_shm_fifo_base& owner_ )
+    {
+        if( !m_watcher.joinable() ) {
+            m_stop.store( false );
+            m_watcher = std::thread( &sc_shm_fifo_base::watch_peer, &owner_ );
+        }
+    }
+
+    void stop_watcher()
+    {
+        if( m_watcher.joinable() ) {
+            m_stop.store( true );
+            m_watcher.join();
+        }
+    }
+
+    std::uint64_t femtoseconds( const sc_time& t_ ) const
+        { return t_.value() * m_resolution_fs; }
+
+public:
+    shm_header&       m_header;
+    void*             m_map_p;
+    std::size_t       m_size;
+    const int         m_own;    // index of this end in the header
+    const int         m_peer;   // index of the other end
+    std::uint64_t     m_resolution_fs;
+    std::thread       m_watcher;
+    std::atomic<bool> m_stop;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_fifo_base
+// ----------------------------------------------------------------------------
+
+sc_shm_fifo_base::sc_shm_fifo_base( const char* name_, const char* segment_,
+                                    std::size_t element_size_, int capacity_,
+                                    bool writer_ )
+  : sc_prim_channel( name_ ),
+    m_local( 0 ),
+    m_peer( 0 ),
+    m_closed( true ),
+    m_peer_closed( false ),
+    m_peer_event( sc_event::kernel_event,
+                  writer_ ? "read_event" : "write_event" ),
+    m_writer( writer_ ),
+    m_capacity( capacity_ > 0 ? capacity_ : 1 ),
+    m_element_size( element_size_ ),
+    m_segment_name( segment_ && segment_[0] == '/' ? "" : "/" ),
+    m_segment_p( 0 ),
+    m_slots_p( 0 ),
+    m_published( 0 ),
+    m_quantum( SC_ZERO_TIME ),
+    m_port_p( 0 ),
+    m_kept_alive( false )
+{
+    m_segment_name += segment_ ? segment_ : "";
+    attach();
+}
+
+sc_shm_fifo_base::~sc_shm_fifo_base()
+{
+    close();
+    delete m_segment_p;
+}
+
+
+// map the segment, creating it if the other end has not done so yet
+
+void
+sc_shm_fifo_base::attach()
+{
+#if defined(SC_DISABLE_ASYNC_UPDATES)
+    SC_REPORT_ERROR( SC_ID_NO_ASYNC_UPDATE_, name() );
+#elif !defined(SC_SHM_FIFO_POSIX_)
+    std::string msg = m_segment_name + ": not supported on this platform";
+    SC_REPORT_ERROR( SC_ID_SHM_FIFO_SEGMENT_, msg.c_str() );
+#else
+    const std::size_t size = shm_slots_offset + m_element_size * m_capacity;
+    const char* nm = m_segment_name.c_str();
+    std::string msg;
+
+    int fd = ::shm_open( nm, O_RDWR | O_CREAT | O_EXCL, 0600 );
+    bool creator = ( fd >= 0 );
+    if( !creator && errno == EEXIST ) {
+        fd = ::shm_open( nm, O_RDWR, 0600 );
+    }
+    if( fd < 0 ) {
+        msg = m_segment_name + ": " + std::strerror( errno );
+        SC_REPORT_ERROR( SC_ID_SHM_FIFO_SEGMENT_, msg.c_str() );
+        return;
+    }
+
+    if( creator ) {
+        if( ::ftruncate( fd, static_cast<off_t>( size ) ) != 0 ) {
+            msg = m_segment_name + ": " + std::strerror( errno );
+            ::close( fd );
+            ::shm_unlink( nm );
+            SC_REPORT_ERROR( SC_ID_SHM_FIFO_SEGMENT_, msg.c_str() );
+            return;
+        }
+    } else {
+        // the creator may not have sized the segment yet
+        struct stat st;
+        for( unsigned idle = 0;
+             ::fstat( fd, &st ) == 0 && st.st_size == 0 && idle < 1000;
+             ++ idle ) {
+            shm_backoff( idle );
+        }
+        if( ::fstat( fd, &st ) != 0 ||
+            static_cast<std::size_t>( st.st_size ) != size ) {
+            msg = m_segment_name + ": size differs";
+            ::close( fd );
+            SC_REPORT_ERROR( SC_ID_SHM_FIFO_MISMATCH_, msg.c_str() );
+            return;
+        }
+    }
+
+    void* map = ::mmap( 0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    int map_errno = errno;
+    ::close( fd );
+    if( map == MAP_FAILED ) {
+        msg = m_segment_name + ": " + std::strerror( map_errno );
+        if( creator ) {
+            ::shm_unlink( nm );
+        }
+        SC_REPORT_ERROR( SC_ID_SHM_FIFO_SEGMENT_, msg.c_str() );
+        return;
+    }
+    m_segment_p = new sc_shm_fifo_segment( map, size, m_writer );
+    shm_header& h = m_segment_p->m_header;
+
+    if( creator ) {
+        new( map ) shm_header();
+        h.element_size = static_cast<std::uint32_t>( m_element_size );
+        h.capacity = static_cast<std::uint64_t>( m_capacity );
+        h.magic.store( shm_magic, std::memory_order_release );
+    } else {
+        for( unsigned idle = 0;
+             h.magic.load( std::memory_order_acquire ) != shm_magic &&
+             idle < 1000;
+             ++ idle ) {
+            shm_backoff( idle );
+        }
+        if( h.magic.load( std::memory_order_acquire ) != shm_magic ||
+            h.element_size != m_element_size ||
+            h.capacity != static_cast<std::uint64_t>( m_capacity ) ) {
+            msg = m_segment_name + ": element size or capacity differs";
+            delete m_segment_p;
+            m_segment_p = 0;
+            SC_REPORT_ERROR( SC_ID_SHM_FIFO_MISMATCH_, msg.c_str() );
+            return;
+        }
+    }
+
+    std::uint32_t detached = SHM_END_DETACHED;
+    if( !h.state[m_segment_p->m_own].compare_exchange_strong(
+          detached, SHM_END_ATTACHED ) ) {
+        msg = m_segment_name + ( m_writer ? ": writer" : ": reader" )
+            + " already attached";
+        delete m_segment_p;
+        m_segment_p = 0;
+        SC_REPORT_ERROR( SC_ID_SHM_FIFO_SEGMENT_, msg.c_str() );
+        return;
+    }
+
+    m_slots_p = static_cast<unsigned char*>( map ) + shm_slots_offset;
+    m_local = m_published =
+      h.count[m_segment_p->m_own].value.load( std::memory_order_acquire );
+    m_peer = h.count[m_segment_p->m_peer].value.load( std::memory_order_acquire );
+    m_closed = false;
+#endif // SC_SHM_FIFO_POSIX_
+}
+
+
+void
+sc_shm_fifo_base::set_time_quantum( const sc_time& quantum_ )
+{
+    if( simcontext()->elaboration_done() ) {
+        SC_REPORT_ERROR( SC_ID_SHM_FIFO_QUANTUM_, name() );
+        return;
+    }
+    m_quantum = quantum_;
+}
+
+
+bool
+sc_shm_fifo_base::peer_attached() const
+{
+    return m_segment_p != 0 &&
+      m_segment_p->m_header.state[m_segment_p->m_peer].load(
+        std::memory_order_acquire ) != SHM_END_DETACHED;
+}
+
+
+void
+sc_shm_fifo_base::close()
+{
+    if( m_closed ) {
+        return;
+    }
+    m_closed = true;
+    shm_header& h = m_segment_p->m_header;
+    const int own = m_segment_p->m_own;
+
+    m_segment_p->stop_watcher();
+    h.count[own].value.store( m_local, std::memory_order_release );
+    m_published = m_local;
+    h.time[own].store( shm_unsynchronized, std::memory_order_release );
+    h.state[own].store( SHM_END_CLOSED, std::memory_order_release );
+
+    keep_alive( false );
+
+#if defined(SC_SHM_FIFO_POSIX_)
+    if( h.closed_ends.fetch_add( 1 ) == 1 ) {
+        ::shm_unlink( m_segment_name.c_str() );
+    }
+#endif
+}
+
+
+void
+sc_shm_fifo_base::check_port( sc_port_base& port_, bool known_ )
+{
+    if( !known_ ) {
+        SC_REPORT_ERROR( SC_ID_BIND_IF_TO_PORT_,
+                         m_writer ? "sc_shm_fifo_writer<T> port not recognized"
+                                  : "sc_shm_fifo_reader<T> port not recognized" );
+        // may continue, if suppressed
+        return;
+    }
+    if( m_port_p != 0 ) {
+        SC_REPORT_ERROR( m_writer ? SC_ID_MORE_THAN_ONE_FIFO_WRITER_
+                                  : SC_ID_MORE_THAN_ONE_FIFO_READER_, 0 );
+        // may continue, if suppressed
+    }
+    m_port_p = &port_;
+}
+
+
+// the kernel waits for asynchronous updates as long as this end depends on
+// the other one
+
+void
+sc_shm_fifo_base::keep_alive( bool keep_ )
+{
+    if( keep_ && !m_kept_alive ) {
+        async_attach_suspending();
+        m_kept_alive = true;
+    } else if( !keep_ && m_kept_alive ) {
+        async_detach_suspending();
+        m_kept_alive = false;
+    }
+}
+
+
+// publish the own count and take over the count of the other end
+
+void
+sc_shm_fifo_base::update()
+{
+    if( m_closed ) {
+        return;
+    }
+    shm_header& h = m_segment_p->m_header;
+
+    if( m_local != m_published ) {
+        h.count[m_segment_p->m_own].value.store( m_local,
+                                                 std::memory_order_release );
+        m_published = m_local;
+    }
+
+    // the final count is published before the closed state
+    bool peer_closed = h.state[m_segment_p->m_peer].load(
+      std::memory_order_acquire ) == SHM_END_CLOSED;
+    sc_dt::uint64 peer =
+      h.count[m_segment_p->m_peer].value.load( std::memory_order_acquire );
+
+    if( peer != m_peer || peer_closed != m_peer_closed ) {
+        m_peer = peer;
+        m_peer_closed = peer_closed;
+        m_peer_event.notify( SC_ZERO_TIME );
+    }
+
+    // the reader waits for samples until the writer is closed, the writer
+    // waits for free space while the ring buffer is full
+    keep_alive( !m_peer_closed &&
+                ( !m_writer || m_local - m_peer >= sc_dt::uint64( m_capacity ) ) );
+}
+
+
+// the process of the conservative synchronization is registered with the
+// global simcontext, see sc_clock::before_end_of_elaboration
+
+void
+sc_shm_fifo_base::before_end_of_elaboration()
+{
+    if( m_closed ) {
+        return;
+    }
+    shm_header& h = m_segment_p->m_header;
+    if( m_quantum == SC_ZERO_TIME ) {
+        h.time[m_segment_p->m_own].store( shm_unsynchronized,
+                                          std::memory_order_release );
+        return;
+    }
+
+    sc_spawn_options opt;
+    opt.spawn_method();
+    std::string gen_base = basename();
+    gen_base += "_sync";
+    sc_spawn( sc_bind( &sc_shm_fifo_base::sync_quantum, this ),
+              sc_gen_unique_name( gen_base.c_str() ), &opt );
+}
+
+void
+sc_shm_fifo_base::start_of_simulation()
+{
+    if( m_closed ) {
+        return;
+    }
+    keep_alive( !m_writer && !m_peer_closed );
+    m_segment_p->start_watcher( *this );
+}
+
+void
+sc_shm_fifo_base::end_of_simulation()
+{
+    close();
+}
+
+
+// publish the local time and block the kernel until the other end has
+// reached it as well, once per quantum
+
+void
+sc_shm_fifo_base::sync_quantum()
+{
+    if( m_closed ) {
+        return;
+    }
+    shm_header& h = m_segment_p->m_header;
+    const std::uint64_t now = m_segment_p->femtoseconds( sc_time_stamp() );
+
+    h.time[m_segment_p->m_own].store( now, std::memory_order_release );
+    for( unsigned idle = 0;
+         h.time[m_segment_p->m_peer].load( std::memory_order_acquire ) < now;
+         ++ idle ) {
+        shm_backoff( idle );
+    }
+
+    // a closed end publishes an unsynchronized time, stop then
+    if( h.state[m_segment_p->m_peer].load( std::memory_order_acquire ) !=
+        SHM_END_CLOSED ) {
+        next_trigger( m_quantum );
+    }
+}
+
+
+// host thread: hand changes of the other end over to the kernel
+
+void
+sc_shm_fifo_base::watch_peer()
+{
+    const shm_header& h = m_segment_p->m_header;
+    const int peer_end = m_segment_p->m_peer;
+    std::uint64_t count = h.count[peer_end].value.load( std::memory_order_acquire );
+    std::uint32_t state = h.state[peer_end].load( std::memory_order_acquire );
+
+    // the other end may have been active before the simulation started
+    async_request_update();
+
+    unsigned idle = 0;
+    while( !m_segment_p->m_stop.load( std::memory_order_acquire ) ) {
+        std::uint32_t s = h.state[peer_end].load( std::memory_order_acquire );
+        std::uint64_t c = h.count[peer_end].value.load( std::memory_order_acquire );
+        if( c != count || s != state ) {
+            count = c;
+            state = s;
+            async_request_update();
+            idle = 0;
+        } else {
+            shm_backoff( idle ++ );
+        }
+    }
+}
+
+
+void
+sc_shm_fifo_base::print( ::std::ostream& os ) const
+{
+    os << m_segment_name << ( m_writer ? ": written " : ": read " )
+       << m_local << ( m_writer ? ", read " : ", written " ) << m_peer;
+    if( m_closed ) {
+        os << " (closed)";
+    }
+}
+
+void
+sc_shm_fifo_base::dump( ::std::ostream& os ) const
+{
+    os << "name = " << name() << ::std::endl;
+    os << "segment = " << m_segment_name << ::std::endl;
+    os << "capacity = " << m_capacity << ::std::endl;
+    os << ( m_writer ? "written = " : "read = " ) << m_local << ::std::endl;
+    os << ( m_writer ? "read = " : "written = " ) << m_peer << ::std::endl;
+    os << "quantum = " << m_quantum << ::std::endl;
+    os << "closed = " << m_closed
+       << ", peer closed = " << m_peer_closed << ::std::endl;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+// Taf!
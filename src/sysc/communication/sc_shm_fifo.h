@@ -0,0 +1,527 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_shm_fifo.h -- The two ends of a fifo between the SystemC kernels of two
+                   host processes, sc_shm_fifo_writer<T> and
+                   sc_shm_fifo_reader<T>. The samples are kept in a POSIX
+                   shared memory ring buffer.
+
+  CHANGE LOG IS AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_SHM_FIFO_H
+#define SC_SHM_FIFO_H
+
+#include "sysc/communication/sc_communication_ids.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/communication/sc_fifo_ifs.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_time.h"
+#include "sysc/kernel/sc_wait.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+namespace sc_core {
+
+class sc_shm_fifo_segment;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_fifo_base
+//
+//  Common part of the two ends of a shared memory fifo.
+//
+//  Each end lives in the simulation of its own host process and both map
+//  the same named POSIX shared memory segment; whichever end comes first
+//  creates it. The ring buffer holds the samples themselves, so they are
+//  written into and read from shared memory without further copies, and
+//  the ends only exchange the number of samples written and read so far.
+//
+//  An end publishes its own count in the update phase of its kernel. A
+//  host thread per end watches the count of the other end and hands a
+//  change to the kernel with async_request_update(), so the update phase
+//  of that kernel makes the new samples (or free spaces) visible and
+//  notifies data_written_event() (or data_read_event()). The reader keeps
+//  its kernel from ending until the writer is closed, and the writer does
+//  so while the ring buffer is full.
+//
+//  The local times of the two kernels are independent by default. With a
+//  time quantum set, each end lets its kernel advance by at most one
+//  quantum beyond the local time of the other one (conservative
+//  synchronization), see set_time_quantum().
+//
+//  An end is closed by close(), by the end of the simulation or by its
+//  destructor. The segment name is removed when both ends are closed.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_shm_fifo_base
+: public sc_prim_channel
+{
+public:
+
+    // name of the shared memory segment
+
+    const char* segment_name() const
+        { return m_segment_name.c_str(); }
+
+    // number of samples the ring buffer can hold
+
+    int capacity() const
+        { return m_capacity; }
+
+    // conservative synchronization of the local times: must be set during
+    // elaboration; SC_ZERO_TIME (the default) leaves them independent
+
+    void set_time_quantum( const sc_time& );
+
+    const sc_time& time_quantum() const
+        { return m_quantum; }
+
+    // has the other end attached to the segment or been closed already?
+
+    bool peer_attached() const;
+    bool peer_closed() const
+        { return m_peer_closed; }
+
+    // detach this end: its pending samples (or reads) are published first,
+    // afterwards it neither accepts nor provides samples
+
+    void close();
+
+    bool closed() const
+        { return m_closed; }
+
+    virtual void print( ::std::ostream& = ::std::cout ) const;
+    virtual void dump( ::std::ostream& = ::std::cout ) const;
+
+protected:
+
+    // the capacity must be the same for both ends
+    sc_shm_fifo_base( const char* name_, const char* segment_,
+                      std::size_t element_size_, int capacity_,
+                      bool writer_ );
+
+    virtual ~sc_shm_fifo_base();
+
+    virtual void update();
+
+    virtual void before_end_of_elaboration();
+    virtual void start_of_simulation();
+    virtual void end_of_simulation();
+
+    // only one port of the matching fifo interface can be bound
+    void check_port( sc_port_base&, bool known_ );
+
+    unsigned char* slots() const
+        { return m_slots_p; }
+
+    // index of the n-th sample in the ring buffer
+    int slot_index( sc_dt::uint64 n_ ) const
+        { return static_cast<int>( n_ % static_cast<unsigned>( m_capacity ) ); }
+
+private:
+
+    void attach();
+    void keep_alive( bool );
+    void sync_quantum();
+    void watch_peer();
+
+protected:
+
+    sc_dt::uint64 m_local;       // samples written (read) by this end
+    sc_dt::uint64 m_peer;        // samples read (written) by the other end
+    bool          m_closed;      // this end is closed
+    bool          m_peer_closed; // the other end is closed
+
+    sc_event      m_peer_event;  // data_read_event (data_written_event)
+
+private:
+
+    const bool           m_writer;
+    const int            m_capacity;
+    const std::size_t    m_element_size;
+    std::string          m_segment_name;
+    sc_shm_fifo_segment* m_segment_p;
+    unsigned char*       m_slots_p;
+    sc_dt::uint64        m_published; // own count last published
+    sc_time              m_quantum;
+    sc_port_base*        m_port_p;    // used for static design rule checking
+    bool                 m_kept_alive;
+
+    friend class sc_shm_fifo_segment;
+
+private:
+
+    // disabled
+    sc_shm_fifo_base( const sc_shm_fifo_base& );
+    sc_shm_fifo_base& operator = ( const sc_shm_fifo_base& );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_fifo_writer<T>
+//
+//  The writing end of a shared memory fifo. T must be trivially copyable,
+//  and both ends must agree on its size and on the capacity.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_shm_fifo_writer
+: public sc_fifo_out_if<T>,
+  public sc_shm_fifo_base
+{
+    static_assert( std::is_trivially_copyable<T>::value,
+                   "sc_shm_fifo_writer<T> requires a trivially copyable T" );
+
+public:
+
+    // constructors
+
+    explicit sc_shm_fifo_writer( const char* segment_, int capacity_ = 1024 )
+      : sc_shm_fifo_base( sc_gen_unique_name( "shm_fifo_writer" ),
+                          segment_, sizeof( T ), capacity_, true )
+      {}
+
+    sc_shm_fifo_writer( const char* name_, const char* segment_,
+                        int capacity_ )
+      : sc_shm_fifo_base( name_, segment_, sizeof( T ), capacity_, true )
+      {}
+
+
+    // interface methods
+
+    virtual void register_port( sc_port_base& port_, const char* if_typename_ )
+    {
+        std::string nm( if_typename_ );
+        check_port( port_, nm == typeid( sc_fifo_out_if<T> ).name() ||
+                           nm == typeid( sc_fifo_blocking_out_if<T> ).name() );
+    }
+
+    // blocking write
+    virtual void write( const T& );
+
+    // non-blocking write
+    virtual bool nb_write( const T& val_ )
+        { return nb_write_n( &val_, 1 ) == 1; }
+
+    // block write: a single update is requested per call
+    virtual void write( const T*, int );
+    virtual int nb_write_n( const T*, int );
+
+
+    // get the number of free spaces
+
+    virtual int num_free() const
+	{
+	    return m_closed ? 0 : capacity() - static_cast<int>( m_local - m_peer );
+	}
+
+
+    // get the data read event
+
+    virtual const sc_event& data_read_event() const
+	{ return m_peer_event; }
+
+
+    // zero-copy access: the window is the contiguous part of the shared
+    // ring buffer holding the next free spaces; its size is returned, and
+    // the first n entries are published by commit_write( n )
+
+    int write_window( T*& );
+    void commit_write( int );
+
+
+    sc_shm_fifo_writer<T>& operator = ( const T& a )
+        { write( a ); return *this; }
+
+    virtual const char* kind() const
+        { return "sc_shm_fifo_writer"; }
+
+protected:
+
+    T* buf() const
+        { return reinterpret_cast<T*>( slots() ); }
+
+private:
+
+    // disabled
+    sc_shm_fifo_writer( const sc_shm_fifo_writer<T>& );
+    sc_shm_fifo_writer& operator = ( const sc_shm_fifo_writer<T>& );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_fifo_reader<T>
+//
+//  The reading end of a shared memory fifo.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_shm_fifo_reader
+: public sc_fifo_in_if<T>,
+  public sc_shm_fifo_base
+{
+    static_assert( std::is_trivially_copyable<T>::value,
+                   "sc_shm_fifo_reader<T> requires a trivially copyable T" );
+
+public:
+
+    // constructors
+
+    explicit sc_shm_fifo_reader( const char* segment_, int capacity_ = 1024 )
+      : sc_shm_fifo_base( sc_gen_unique_name( "shm_fifo_reader" ),
+                          segment_, sizeof( T ), capacity_, false )
+      {}
+
+    sc_shm_fifo_reader( const char* name_, const char* segment_,
+                        int capacity_ )
+      : sc_shm_fifo_base( name_, segment_, sizeof( T ), capacity_, false )
+      {}
+
+
+    // interface methods
+
+    virtual void register_port( sc_port_base& port_, const char* if_typename_ )
+    {
+        std::string nm( if_typename_ );
+        check_port( port_, nm == typeid( sc_fifo_in_if<T> ).name() ||
+                           nm == typeid( sc_fifo_blocking_in_if<T> ).name() );
+    }
+
+    // blocking read
+    virtual void read( T& );
+    virtual T read()
+        { T tmp; read( tmp ); return tmp; }
+
+    // non-blocking read
+    virtual bool nb_read( T& val_ )
+        { return nb_read_n( &val_, 1 ) == 1; }
+
+    // block read: a single update is requested per call
+    virtual void read( T*, int );
+    virtual int nb_read_n( T*, int );
+
+
+    // get the number of available samples
+
+    virtual int num_available() const
+	{ return m_closed ? 0 : static_cast<int>( m_peer - m_local ); }
+
+
+    // get the data written event
+
+    virtual const sc_event& data_written_event() const
+	{ return m_peer_event; }
+
+
+    // zero-copy access: the window is the contiguous part of the shared
+    // ring buffer holding the next readable samples; its size is returned,
+    // and the first n entries are consumed by commit_read( n )
+
+    int read_window( T*& );
+    void commit_read( int );
+
+
+    operator T ()
+	{ return read(); }
+
+    virtual const char* kind() const
+        { return "sc_shm_fifo_reader"; }
+
+protected:
+
+    T* buf() const
+        { return reinterpret_cast<T*>( slots() ); }
+
+private:
+
+    // disabled
+    sc_shm_fifo_reader( const sc_shm_fifo_reader<T>& );
+    sc_shm_fifo_reader& operator = ( const sc_shm_fifo_reader<T>& );
+};
+
+
+// IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
+
+// blocking write
+
+template <class T>
+inline
+void
+sc_shm_fifo_writer<T>::write( const T& val_ )
+{
+    write( &val_, 1 );
+}
+
+template <class T>
+inline
+void
+sc_shm_fifo_writer<T>::write( const T* buf_, int n_ )
+{
+    while( n_ > 0 ) {
+        while( num_free() == 0 ) {
+            sc_core::wait( m_peer_event );
+        }
+        int n = sc_shm_fifo_writer<T>::nb_write_n( buf_, n_ );
+        buf_ += n;
+        n_ -= n;
+    }
+}
+
+template <class T>
+inline
+int
+sc_shm_fifo_writer<T>::nb_write_n( const T* buf_, int n_ )
+{
+    int n = std::min( num_free(), n_ );
+    if( n <= 0 ) {
+        return 0;
+    }
+    // at most two contiguous chunks: up to the end of the buffer, then
+    // from its start
+    int wi = slot_index( m_local );
+    int first = std::min( n, capacity() - wi );
+    std::copy( buf_, buf_ + first, buf() + wi );
+    if( first < n ) {
+        std::copy( buf_ + first, buf_ + n, buf() );
+    }
+    m_local += n;
+    request_update();
+    return n;
+}
+
+template <class T>
+inline
+int
+sc_shm_fifo_writer<T>::write_window( T*& ptr_ )
+{
+    int wi = slot_index( m_local );
+    ptr_ = buf() + wi;
+    return std::min( num_free(), capacity() - wi );
+}
+
+template <class T>
+inline
+void
+sc_shm_fifo_writer<T>::commit_write( int n_ )
+{
+    if( n_ < 0 || n_ > num_free() ||
+        n_ > capacity() - slot_index( m_local ) ) {
+        SC_REPORT_ERROR( SC_ID_INVALID_FIFO_COMMIT_, "commit_write" );
+        return;
+    }
+    if( n_ == 0 ) {
+        return;
+    }
+    m_local += n_;
+    request_update();
+}
+
+
+// blocking read
+
+template <class T>
+inline
+void
+sc_shm_fifo_reader<T>::read( T& val_ )
+{
+    read( &val_, 1 );
+}
+
+template <class T>
+inline
+void
+sc_shm_fifo_reader<T>::read( T* buf_, int n_ )
+{
+    while( n_ > 0 ) {
+        while( num_available() == 0 ) {
+            sc_core::wait( m_peer_event );
+        }
+        int n = sc_shm_fifo_reader<T>::nb_read_n( buf_, n_ );
+        buf_ += n;
+        n_ -= n;
+    }
+}
+
+template <class T>
+inline
+int
+sc_shm_fifo_reader<T>::nb_read_n( T* buf_, int n_ )
+{
+    int n = std::min( num_available(), n_ );
+    if( n <= 0 ) {
+        return 0;
+    }
+    int ri = slot_index( m_local );
+    int first = std::min( n, capacity() - ri );
+    std::copy( buf() + ri, buf() + ri + first, buf_ );
+    if( first < n ) {
+        std::copy( buf(), buf() + ( n - first ), buf_ + first );
+    }
+    m_local += n;
+    request_update();
+    return n;
+}
+
+template <class T>
+inline
+int
+sc_shm_fifo_reader<T>::read_window( T*& ptr_ )
+{
+    int ri = slot_index( m_local );
+    ptr_ = buf() + ri;
+    return std::min( num_available(), capacity() - ri );
+}
+
+template <class T>
+inline
+void
+sc_shm_fifo_reader<T>::commit_read( int n_ )
+{
+    if( n_ < 0 || n_ > num_available() ||
+        n_ > capacity() - slot_index( m_local ) ) {
+        SC_REPORT_ERROR( SC_ID_INVALID_FIFO_COMMIT_, "commit_read" );
+        return;
+    }
+    if( n_ == 0 ) {
+        return;
+    }
+    m_local += n_;
+    request_update();
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_SHM_FIFO_H
+
+// Taf!
@@ -75,6 +75,40 @@ sc_writer_policy_check_write::only_delta()
     return sc_get_curr_simcontext()->write_check_conflicts_only();
 }
 
+// first write after a process switch (see check_write)
+
+bool
+sc_writer_policy_check_write::check_new_writer( sc_object* target )
+{
+  sc_process_b* writer_p = sc_get_curr_simcontext()->get_current_writer();
+  sc_process_b* known_p = m_writer_p; // the writer checked before
+
+  // the stamp is not recorded while a batch of isolated methods executes,
+  // they share it
+  const sc_dt::uint64 stamp = target->simcontext()->writer_stamp();
+  if( stamp != SC_WRITER_STAMP_NONE_ )
+    m_writer_stamp = stamp;
+
+  if( writer_p == known_p || writer_p == 0 )
+    return true;
+  if( !m_writer_p.valid() ) {
+    // always store first writer
+    sc_process_handle( writer_p ).swap( m_writer_p );
+  } else {
+    // Alternative option: only flag error, if either
+    //  - we enforce conflicts across multiple evaluation phases, or
+    //  - the new value is different from the previous write
+    //if( !m_delta_only || value_changed )
+    {
+      sc_signal_invalid_writer( target, m_writer_p, writer_p, m_delta_only );
+      // error has been suppressed, accept check as well,
+      // but update current writer to the last "successful" one
+      sc_process_handle( writer_p ).swap( m_writer_p );
+    }
+  }
+  return true;
+}
+
 bool
 sc_writer_policy_check_port::
   check_port( sc_object* target, sc_port_base * port_, bool is_output )
@@ -170,7 +204,27 @@ sc_signal<bool,POL>::update()
     policy_type::update();
     if( !( base_type::m_new_val == base_type::m_cur_val ) ) {
         do_update();
+    } else {
+        this->update_unchanged();
+    }
+}
+
+template< sc_writer_policy POL >
+sc_prim_channel::update_kernel
+sc_signal<bool,POL>::get_update_kernel() const
+{
+    // derived channels may override update()
+    if( typeid( *this ) == typeid( this_type ) ) {
+        return &this_type::plain_update;
     }
+    return nullptr;
+}
+
+template< sc_writer_policy POL >
+void
+sc_signal<bool,POL>::plain_update( sc_prim_channel* prim_channel_p )
+{
+    static_cast<this_type*>( prim_channel_p )->this_type::update();
 }
 
 template< sc_writer_policy POL >
@@ -234,9 +288,29 @@ sc_signal<sc_logic,POL>::update()
     policy_type::update();
     if( !( base_type::m_new_val == base_type::m_cur_val ) ) {
         do_update();
+    } else {
+        this->update_unchanged();
     }
 }
 
+template< sc_writer_policy POL >
+sc_prim_channel::update_kernel
+sc_signal<sc_logic,POL>::get_update_kernel() const
+{
+    // derived channels may override update()
+    if( typeid( *this ) == typeid( this_type ) ) {
+        return &this_type::plain_update;
+    }
+    return nullptr;
+}
+
+template< sc_writer_policy POL >
+void
+sc_signal<sc_logic,POL>::plain_update( sc_prim_channel* prim_channel_p )
+{
+    static_cast<this_type*>( prim_channel_p )->this_type::update();
+}
+
 template< sc_writer_policy POL >
 void
 sc_signal<sc_logic,POL>::do_update()
@@ -37,40 +37,39 @@
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/datatypes/bit/sc_logic.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
 #include "sysc/tracing/sc_trace.h"
+#include <string>
+#include <type_traits>
 #include <typeinfo>
 
+namespace sc_dt {
+template <int W> class sc_bv;
+template <int W> class sc_lv;
+} // namespace sc_dt
+
 namespace sc_core {
 
 inline
 bool
 sc_writer_policy_check_write::check_write( sc_object* target, bool /*value_changed*/ )
 {
-  sc_process_b* writer_p = sc_get_curr_simcontext()->get_current_writer();
-  if( SC_UNLIKELY_( !m_writer_p.valid() ) ) {
-    // always store first writer
-    sc_process_handle( writer_p ).swap( m_writer_p );
-  } else if( SC_UNLIKELY_(m_writer_p != writer_p && writer_p != 0) ) {
-    // Alternative option: only flag error, if either
-    //  - we enforce conflicts across multiple evaluation phases, or
-    //  - the new value is different from the previous write
-    //if( !m_delta_only || value_changed )
-    {
-      sc_signal_invalid_writer( target, m_writer_p, writer_p, m_delta_only );
-      // error has been suppressed, accept check as well,
-      // but update current writer to the last "successful" one
-      sc_process_handle( writer_p ).swap( m_writer_p );
-    }
-  }
-  return true;
+  // The writer is checked on its first write after a process switch, which
+  // records the writer stamp. The repeated writes of the same process
+  // activation skip the lookup of the current writer.
+  if( SC_LIKELY_( m_writer_stamp == target->simcontext()->writer_stamp() ) )
+    return true;
+  return check_new_writer( target );
 }
 
 
 inline void
 sc_writer_policy_check_write::update()
 {
-  if( m_delta_only ) // reset, if we're only checking for delta conflicts
+  if( m_delta_only ) { // reset, if we're only checking for delta conflicts
     sc_process_handle().swap( m_writer_p );
+    m_writer_stamp = 0;
+  }
 }
 
 
@@ -144,6 +143,80 @@ operator << ( ::std::ostream& os, const sc_signal_channel& a )
 }
 
 
+// ----------------------------------------------------------------------------
+//  FUNCTIONS : sc_signal_equal, sc_signal_assign (implementation-defined)
+//
+//  Comparison and copy of signal values. The overloads for the fixed-width
+//  bit and logic vectors work on whole words, without the length checks
+//  and the sign extension of the generic vector operators.
+// ----------------------------------------------------------------------------
+
+// number of sc_digit words of a w-bit vector
+inline constexpr int
+sc_signal_words( int w )
+{
+    return ( w - 1 ) / ( 8 * static_cast<int>( sizeof( sc_dt::sc_digit ) ) ) + 1;
+}
+
+template< class T >
+inline bool
+sc_signal_equal( const T& a, const T& b )
+{
+    return a == b;
+}
+
+template< class T >
+inline void
+sc_signal_assign( T& a, const T& b )
+{
+    a = b;
+}
+
+template< int W >
+inline bool
+sc_signal_equal( const sc_dt::sc_bv<W>& a, const sc_dt::sc_bv<W>& b )
+{
+    for( int i = 0; i < sc_signal_words( W ); ++ i ) {
+        if( a.get_word( i ) != b.get_word( i ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template< int W >
+inline void
+sc_signal_assign( sc_dt::sc_bv<W>& a, const sc_dt::sc_bv<W>& b )
+{
+    for( int i = 0; i < sc_signal_words( W ); ++ i ) {
+        a.set_word( i, b.get_word( i ) );
+    }
+}
+
+template< int W >
+inline bool
+sc_signal_equal( const sc_dt::sc_lv<W>& a, const sc_dt::sc_lv<W>& b )
+{
+    for( int i = 0; i < sc_signal_words( W ); ++ i ) {
+        if( a.get_word( i ) != b.get_word( i ) ||
+            a.get_cword( i ) != b.get_cword( i ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template< int W >
+inline void
+sc_signal_assign( sc_dt::sc_lv<W>& a, const sc_dt::sc_lv<W>& b )
+{
+    for( int i = 0; i < sc_signal_words( W ); ++ i ) {
+        a.set_word( i, b.get_word( i ) );
+        a.set_cword( i, b.get_cword( i ) );
+    }
+}
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_signal_t<T, POL> (implementation-defined)
 //
@@ -258,6 +331,11 @@ protected:
     virtual void update();
             void do_update();
 
+    // plain sc_signal<T,POL> channels of trivially copyable T are updated
+    // without virtual dispatch
+    virtual update_kernel get_update_kernel() const;
+    static void plain_update( sc_prim_channel* );
+
 protected:
     T m_cur_val;         // current value of object.
     T m_new_val;         // next value of object.
@@ -289,11 +367,11 @@ void
 sc_signal_t<T,POL>::write( const T& value_ )
 {
     // first write per eval phase: m_new_val == m_cur_val
-    bool value_changed = !( m_new_val == value_ );
+    bool value_changed = !sc_signal_equal( m_new_val, value_ );
     if ( !policy_type::check_write(this, value_changed) )
         return;
 
-    m_new_val = value_;
+    sc_signal_assign( m_new_val, value_ );
     if( value_changed || policy_type::needs_update() ) {
         request_update();
     }
@@ -323,8 +401,10 @@ void
 sc_signal_t<T,POL>::update()
 {
     policy_type::update();
-    if( !( m_new_val == m_cur_val ) ) {
+    if( !sc_signal_equal( m_new_val, m_cur_val ) ) {
         do_update();
+    } else {
+        update_unchanged();
     }
 }
 
@@ -333,7 +413,26 @@ inline void
 sc_signal_t<T,POL>::do_update()
 {
     base_type::do_update();
-    m_cur_val = m_new_val;
+    sc_signal_assign( m_cur_val, m_new_val );
+}
+
+template< class T, sc_writer_policy POL >
+sc_prim_channel::update_kernel
+sc_signal_t<T,POL>::get_update_kernel() const
+{
+    // derived channels may override update()
+    if( std::is_trivially_copyable<T>::value &&
+        typeid( *this ) == typeid( sc_signal<T,POL> ) ) {
+        return &this_type::plain_update;
+    }
+    return nullptr;
+}
+
+template< class T, sc_writer_policy POL >
+void
+sc_signal_t<T,POL>::plain_update( sc_prim_channel* prim_channel_p )
+{
+    static_cast<this_type*>( prim_channel_p )->this_type::update();
 }
 
 // ----------------------------------------------------------------------------
@@ -460,6 +559,9 @@ protected:
     virtual void update();
             void do_update();
 
+    virtual sc_prim_channel::update_kernel get_update_kernel() const;
+    static void plain_update( sc_prim_channel* );
+
     virtual bool is_clock() const { return false; }
 
 protected:
@@ -547,6 +649,9 @@ protected:
     virtual void update();
             void do_update();
 
+    virtual sc_prim_channel::update_kernel get_update_kernel() const;
+    static void plain_update( sc_prim_channel* );
+
 protected:
     mutable sc_event* m_negedge_event_p; // negative edge event if present.
     mutable sc_event* m_posedge_event_p; // positive edge event if present.
@@ -556,6 +661,324 @@ private:
     sc_signal( const this_type& ) /* = delete */;
 };
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_signal_vector_t<T, W, POL> (implementation-defined)
+//
+//  Common base of the sc_signal specializations for the fixed-width vectors
+//  sc_dt::sc_bv<W> and sc_dt::sc_lv<W>. The values are compared and copied
+//  word by word. In addition, processes can wait for changes of single bits:
+//  the per-bit events are created on demand, and only the watched bits are
+//  inspected in the update phase.
+// ----------------------------------------------------------------------------
+
+template< class T, int W, sc_writer_policy POL >
+class sc_signal_vector_t
+  : public sc_signal_t<T,POL>
+{
+protected:
+    typedef sc_signal_t<T,POL>            base_type;
+    typedef sc_signal_vector_t<T,W,POL>   this_type;
+    typedef sc_writer_policy_check<POL>   policy_type;
+
+    enum { words = sc_signal_words( W ),
+           digit_bits = 8 * sizeof( sc_dt::sc_digit ) };
+
+    sc_signal_vector_t( const char* name_, const T& initial_value_ )
+      : base_type( name_, initial_value_ )
+      , m_bit_events_p( 0 )
+    {
+        for( int i = 0; i < words; ++ i ) {
+            m_watched[i] = 0;
+        }
+    }
+
+public:
+
+    virtual ~sc_signal_vector_t();
+
+    // assignment
+    using base_type::operator=;
+
+    this_type& operator = ( const this_type& a )
+      { this->write( a.read() ); return *this; }
+
+    // get the event of any change of bit i
+    const sc_event& bit_changed_event( int i ) const
+        { return *bit_event( i, bit_changed ); }
+
+    // get the event of bit i changing to '1'
+    const sc_event& posedge_event( int i ) const
+        { return *bit_event( i, bit_posedge ); }
+
+    // get the event of bit i changing to '0'
+    const sc_event& negedge_event( int i ) const
+        { return *bit_event( i, bit_negedge ); }
+
+protected:
+
+    virtual void update();
+            void do_update();
+
+    virtual sc_prim_channel::update_kernel get_update_kernel() const;
+    static void plain_update( sc_prim_channel* );
+
+private:
+
+    enum bit_event_kind { bit_changed, bit_posedge, bit_negedge };
+
+    sc_event* bit_event( int i, bit_event_kind kind ) const;
+    void notify_bits( const sc_dt::sc_digit* changed ) const;
+
+    mutable sc_event**      m_bit_events_p;     // per-bit events if present.
+    mutable sc_dt::sc_digit m_watched[words];   // bits with events.
+
+private:
+    // disabled
+    sc_signal_vector_t( const this_type& ) /* = delete */;
+};
+
+// ----------------------------------------------------------------------------
+
+template< class T, int W, sc_writer_policy POL >
+sc_signal_vector_t<T,W,POL>::~sc_signal_vector_t()
+{
+    if( m_bit_events_p ) {
+        for( int i = 0; i < 3 * W; ++ i ) {
+            delete m_bit_events_p[i];
+        }
+        delete [] m_bit_events_p;
+    }
+}
+
+template< class T, int W, sc_writer_policy POL >
+sc_event*
+sc_signal_vector_t<T,W,POL>::bit_event( int i, bit_event_kind kind ) const
+{
+    static const char* const kind_names[] =
+        { "bit_changed_event_", "posedge_event_", "negedge_event_" };
+
+    if( i < 0 || i >= W ) {
+        SC_REPORT_ERROR( SC_ID_OUT_OF_BOUNDS_, this->name() );
+        return &const_cast<sc_event&>( this->value_changed_event() );
+    }
+    if( !m_bit_events_p ) {
+        m_bit_events_p = new sc_event*[3 * W]();
+    }
+    m_watched[i / digit_bits] |= sc_dt::sc_digit( 1 ) << ( i % digit_bits );
+    std::string name = kind_names[kind] + std::to_string( i );
+    return this->lazy_kernel_event( &m_bit_events_p[3 * i + kind],
+                                    name.c_str() );
+}
+
+template< class T, int W, sc_writer_policy POL >
+void
+sc_signal_vector_t<T,W,POL>::notify_bits( const sc_dt::sc_digit* changed ) const
+{
+    for( int w = 0; w < words; ++ w ) {
+        sc_dt::sc_digit bits = changed[w] & m_watched[w];
+        if( !bits ) {
+            continue;
+        }
+        // new value of the bits: '1' is (1,0), '0' is (0,0)
+        sc_dt::sc_digit data = this->m_cur_val.get_word( w );
+        sc_dt::sc_digit ctrl = this->m_cur_val.get_cword( w );
+        for( int b = 0; bits; ++ b, bits >>= 1 ) {
+            if( !( bits & 1 ) ) {
+                continue;
+            }
+            sc_event** ev_p = &m_bit_events_p[3 * ( w * digit_bits + b )];
+            this->notify_next_delta( ev_p[bit_changed] );
+            if( !( ( ctrl >> b ) & 1 ) ) {
+                this->notify_next_delta( ( ( data >> b ) & 1 )
+                                         ? ev_p[bit_posedge]
+                                         : ev_p[bit_negedge] );
+            }
+        }
+    }
+}
+
+template< class T, int W, sc_writer_policy POL >
+void
+sc_signal_vector_t<T,W,POL>::update()
+{
+    policy_type::update();
+
+    sc_dt::sc_digit changed[words];
+    sc_dt::sc_digit any = 0;
+    for( int w = 0; w < words; ++ w ) {
+        changed[w] =
+            ( this->m_new_val.get_word( w ) ^ this->m_cur_val.get_word( w ) ) |
+            ( this->m_new_val.get_cword( w ) ^ this->m_cur_val.get_cword( w ) );
+        any |= changed[w];
+    }
+    if( any ) {
+        do_update();
+        if( m_bit_events_p ) {
+            notify_bits( changed );
+        }
+    } else {
+        this->update_unchanged();
+    }
+}
+
+template< class T, int W, sc_writer_policy POL >
+inline void
+sc_signal_vector_t<T,W,POL>::do_update()
+{
+    base_type::do_update();
+}
+
+template< class T, int W, sc_writer_policy POL >
+sc_prim_channel::update_kernel
+sc_signal_vector_t<T,W,POL>::get_update_kernel() const
+{
+    // derived channels may override update()
+    if( typeid( *this ) == typeid( sc_signal<T,POL> ) ) {
+        return &this_type::plain_update;
+    }
+    return nullptr;
+}
+
+template< class T, int W, sc_writer_policy POL >
+void
+sc_signal_vector_t<T,W,POL>::plain_update( sc_prim_channel* prim_channel_p )
+{
+    static_cast<this_type*>( prim_channel_p )->this_type::update();
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_signal<sc_dt::sc_bv<W> >, sc_signal<sc_dt::sc_lv<W> >
+//
+//  Specializations of sc_signal<T> for the fixed-width vector types.
+// ----------------------------------------------------------------------------
+
+template< int W, sc_writer_policy POL >
+class sc_signal<sc_dt::sc_bv<W>,POL>
+  : public sc_signal_vector_t<sc_dt::sc_bv<W>,W,POL>
+{
+public:
+    typedef sc_signal_inout_if<sc_dt::sc_bv<W> >        if_type;
+    typedef sc_signal_vector_t<sc_dt::sc_bv<W>,W,POL>   base_type;
+    typedef sc_signal<sc_dt::sc_bv<W>,POL>              this_type;
+    typedef sc_dt::sc_bv<W>                             value_type;
+    typedef sc_writer_policy_check<POL>                 policy_type;
+
+    // constructors and destructor
+
+    sc_signal()
+      : base_type( sc_gen_unique_name( "signal" ), value_type() )
+    {}
+
+    explicit
+    sc_signal( const char* name_ )
+      : base_type( name_, value_type() )
+    {}
+
+    sc_signal( const char* name_, const value_type& initial_value_ )
+      : base_type( name_, initial_value_ )
+    {}
+
+    virtual ~sc_signal() {} /* = default; */
+
+    // assignment
+    this_type& operator = ( const value_type& a )
+      { base_type::operator=(a); return *this; }
+
+    this_type& operator = ( const sc_signal_in_if<value_type>& a )
+      { base_type::operator=(a); return *this; }
+
+    this_type& operator = ( const this_type& a )
+      { base_type::operator=(a); return *this; }
+
+private:
+    // disabled
+    sc_signal( const sc_signal& ) /* = delete */;
+};
+
+template< int W, sc_writer_policy POL >
+class sc_signal<sc_dt::sc_lv<W>,POL>
+  : public sc_signal_vector_t<sc_dt::sc_lv<W>,W,POL>
+{
+public:
+    typedef sc_signal_inout_if<sc_dt::sc_lv<W> >        if_type;
+    typedef sc_signal_vector_t<sc_dt::sc_lv<W>,W,POL>   base_type;
+    typedef sc_signal<sc_dt::sc_lv<W>,POL>              this_type;
+    typedef sc_dt::sc_lv<W>                             value_type;
+    typedef sc_writer_policy_check<POL>                 policy_type;
+
+    // constructors and destructor
+
+    sc_signal()
+      : base_type( sc_gen_unique_name( "signal" ), value_type() )
+    {}
+
+    explicit
+    sc_signal( const char* name_ )
+      : base_type( name_, value_type() )
+    {}
+
+    sc_signal( const char* name_, const value_type& initial_value_ )
+      : base_type( name_, initial_value_ )
+    {}
+
+    virtual ~sc_signal() {} /* = default; */
+
+    // assignment
+    this_type& operator = ( const value_type& a )
+      { base_type::operator=(a); return *this; }
+
+    this_type& operator = ( const sc_signal_in_if<value_type>& a )
+      { base_type::operator=(a); return *this; }
+
+    this_type& operator = ( const this_type& a )
+      { base_type::operator=(a); return *this; }
+
+private:
+    // disabled
+    sc_signal( const sc_signal& ) /* = delete */;
+};
+
+// ----------------------------------------------------------------------------
+//  FUNCTIONS : sc_signal_resolve_read, sc_signal_resolve_write
+//
+//  Port resolution (see sc_set_port_resolution()): at the end of elaboration
+//  the signal ports ask for direct access to their channel, which is granted
+//  only if its dynamic type is a plain sc_signal, i.e., neither a derived
+//  channel such as sc_buffer or sc_clock nor a user-defined one.
+//
+//  sc_signal_resolve_read() returns the current value of the channel, which
+//  stays at the same address, sc_signal_resolve_write() the channel itself
+//  if it has the default writer policy. Both return null otherwise.
+// ----------------------------------------------------------------------------
+
+template< class T >
+inline
+const T*
+sc_signal_resolve_read( const sc_signal_in_if<T>* if_p )
+{
+    if( if_p == 0 || !sc_get_curr_simcontext()->port_resolution() )
+        return 0;
+    const std::type_info& if_type = typeid( *if_p );
+    if( if_type == typeid( sc_signal<T,SC_ONE_WRITER> ) ||
+        if_type == typeid( sc_signal<T,SC_MANY_WRITERS> ) ||
+        if_type == typeid( sc_signal<T,SC_UNCHECKED_WRITERS> ) )
+        return &if_p->read();
+    return 0;
+}
+
+template< class T >
+inline
+sc_signal_t<T,SC_DEFAULT_WRITER_POLICY>*
+sc_signal_resolve_write( sc_signal_inout_if<T>* if_p )
+{
+    typedef sc_signal<T,SC_DEFAULT_WRITER_POLICY> signal_type;
+    if( if_p == 0 || !sc_get_curr_simcontext()->port_resolution() ||
+        typeid( *if_p ) != typeid( signal_type ) )
+        return 0;
+    return static_cast<signal_type*>( if_p );
+}
+
 } // namespace sc_core
 
 /*****************************************************************************
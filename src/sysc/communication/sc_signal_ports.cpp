@@ -50,6 +50,8 @@ template class SC_API sc_port<sc_signal_inout_if<sc_dt::sc_logic>,1,SC_ONE_OR_MO
 void
 sc_in<bool>::end_of_elaboration()
 {
+    m_read_p = sc_signal_resolve_read(
+        dynamic_cast<in_if_type*>( get_interface() ) );
     if( m_traces != nullptr ) {
 	for(auto p : *m_traces) {
 	    auto* iface = dynamic_cast<in_if_type*>( get_interface() );
@@ -131,6 +133,8 @@ sc_in<bool>::vbind( sc_port_base& parent_ )
 void
 sc_in<sc_dt::sc_logic>::end_of_elaboration()
 {
+    m_read_p = sc_signal_resolve_read(
+        dynamic_cast<in_if_type*>( get_interface() ) );
     if( m_traces != nullptr ) {
 	for(auto p : *m_traces) {
 	    auto* iface = dynamic_cast<in_if_type*>( get_interface() );
@@ -242,6 +246,9 @@ sc_inout<bool>::initialize( sc_core::sc_inout<bool>::data_type value_ )
 void
 sc_inout<bool>::end_of_elaboration()
 {
+    auto* iface = dynamic_cast<inout_if_type*>( get_interface() );
+    m_read_p = sc_signal_resolve_read<data_type>( iface );
+    m_write_p = sc_signal_resolve_write( iface );
     if( m_init_val != nullptr ) {
 	write( *m_init_val );
 	delete m_init_val;
@@ -332,6 +339,9 @@ sc_inout<sc_dt::sc_logic>::initialize( const data_type& value_ )
 void
 sc_inout<sc_dt::sc_logic>::end_of_elaboration()
 {
+    auto* iface = dynamic_cast<inout_if_type*>( get_interface() );
+    m_read_p = sc_signal_resolve_read<data_type>( iface );
+    m_write_p = sc_signal_resolve_write( iface );
     if( m_init_val != nullptr ) {
 	write( *m_init_val );
 	delete m_init_val;
@@ -32,6 +32,7 @@
 
 #include "sysc/communication/sc_event_finder.h"
 #include "sysc/communication/sc_port.h"
+#include "sysc/communication/sc_signal.h"
 #include "sysc/communication/sc_signal_ifs.h"
 #include "sysc/datatypes/bit/sc_logic.h"
 #include "sysc/tracing/sc_trace.h"
@@ -209,10 +210,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
 
     // was there a value changed event?
@@ -269,6 +270,9 @@ protected:
 private:
   mutable sc_event_finder* m_change_finder_p;
 
+  // channel resolved at the end of elaboration, see sc_set_port_resolution()
+  const data_type* m_read_p = nullptr;  // current value of the channel.
+
 private:
 
     // disabled
@@ -300,6 +304,8 @@ inline
 void
 sc_in<T>::end_of_elaboration()
 {
+    m_read_p = sc_signal_resolve_read(
+        dynamic_cast<in_if_type*>( this->get_interface() ) );
     if( m_traces != 0 ) {
 	for( int i = 0; i < (int)m_traces->size(); ++ i ) {
 	    sc_trace_params* p = (*m_traces)[i];
@@ -540,10 +546,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
 
     // use for positive edge sensitivity
@@ -624,6 +630,9 @@ protected:
 
 private:
   mutable sc_event_finder* m_change_finder_p;
+
+  // channel resolved at the end of elaboration, see sc_set_port_resolution()
+  const data_type* m_read_p = nullptr;  // current value of the channel.
   mutable sc_event_finder* m_neg_finder_p;
   mutable sc_event_finder* m_pos_finder_p;
 
@@ -797,10 +806,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
 
     // use for positive edge sensitivity
@@ -881,6 +890,9 @@ protected:
 
 private:
   mutable sc_event_finder* m_change_finder_p;
+
+  // channel resolved at the end of elaboration, see sc_set_port_resolution()
+  const data_type* m_read_p = nullptr;  // current value of the channel.
   mutable sc_event_finder* m_neg_finder_p;
   mutable sc_event_finder* m_pos_finder_p;
 
@@ -992,10 +1004,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
 
     // was there a value changed event?
@@ -1007,22 +1019,27 @@ public:
     // write the new value
 
     void write( const data_type& value_ )
-	{ (*this)->write( value_ ); }
+    {
+        if( m_write_p != 0 )
+            m_write_p->resolved_type::write( value_ );
+        else
+            (*this)->write( value_ );
+    }
 
     this_type& operator = ( const data_type& value_ )
-	{ (*this)->write( value_ ); return *this; }
+	{ write( value_ ); return *this; }
 
     this_type& operator = ( const in_if_type& interface_ )
-	{ (*this)->write( interface_.read() ); return *this; }
+	{ write( interface_.read() ); return *this; }
 
     this_type& operator = ( const in_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const inout_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const this_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
 
     // set initial value (can also be called when port is not bound yet)
@@ -1071,6 +1088,11 @@ protected:
 private:
   mutable sc_event_finder* m_change_finder_p;
 
+  // channel resolved at the end of elaboration, see sc_set_port_resolution()
+  typedef sc_signal_t<data_type,SC_DEFAULT_WRITER_POLICY> resolved_type;
+  const data_type* m_read_p = nullptr;  // current value of the channel.
+  resolved_type*   m_write_p = nullptr; // channel written directly.
+
 private:
 
     // disabled
@@ -1132,6 +1154,9 @@ inline
 void
 sc_inout<T>::end_of_elaboration()
 {
+    inout_if_type* iface = dynamic_cast<inout_if_type*>( this->get_interface() );
+    m_read_p = sc_signal_resolve_read<data_type>( iface );
+    m_write_p = sc_signal_resolve_write( iface );
     if( m_init_val != 0 ) {
 	write( *m_init_val );
 	delete m_init_val;
@@ -1292,10 +1317,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
 
     // use for positive edge sensitivity
@@ -1333,22 +1358,27 @@ public:
     // write the new value
 
     void write( sc_core::sc_inout<bool>::data_type value_ )
-	{ (*this)->write( value_ ); }
+    {
+        if( m_write_p != 0 )
+            m_write_p->resolved_type::write( value_ );
+        else
+            (*this)->write( value_ );
+    }
 
     this_type& operator = ( sc_core::sc_inout<bool>::data_type value_ )
-	{ (*this)->write( value_ ); return *this; }
+	{ write( value_ ); return *this; }
 
     this_type& operator = ( const in_if_type& interface_ )
-	{ (*this)->write( interface_.read() ); return *this; }
+	{ write( interface_.read() ); return *this; }
 
     this_type& operator = ( const in_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const inout_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const this_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
 
     // set initial value (can also be called when port is not bound yet)
@@ -1396,6 +1426,11 @@ protected:
 
 private:
   mutable sc_event_finder* m_change_finder_p;
+
+  // channel resolved at the end of elaboration, see sc_set_port_resolution()
+  typedef sc_signal_t<data_type,SC_DEFAULT_WRITER_POLICY> resolved_type;
+  const data_type* m_read_p = nullptr;  // current value of the channel.
+  resolved_type*   m_write_p = nullptr; // channel written directly.
   mutable sc_event_finder* m_neg_finder_p;
   mutable sc_event_finder* m_pos_finder_p;
 
@@ -1518,10 +1553,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return m_read_p ? *m_read_p : (*this)->read(); }
 
 
     // use for positive edge sensitivity
@@ -1559,22 +1594,27 @@ public:
     // write the new value
 
     void write( const data_type& value_ )
-	{ (*this)->write( value_ ); }
+    {
+        if( m_write_p != 0 )
+            m_write_p->resolved_type::write( value_ );
+        else
+            (*this)->write( value_ );
+    }
 
     this_type& operator = ( const data_type& value_ )
-	{ (*this)->write( value_ ); return *this; }
+	{ write( value_ ); return *this; }
 
     this_type& operator = ( const in_if_type& interface_ )
-	{ (*this)->write( interface_.read() ); return *this; }
+	{ write( interface_.read() ); return *this; }
 
     this_type& operator = ( const in_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const inout_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const this_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
 
     // set initial value (can also be called when port is not bound yet)
@@ -1622,6 +1662,11 @@ protected:
 
 private:
   mutable sc_event_finder* m_change_finder_p;
+
+  // channel resolved at the end of elaboration, see sc_set_port_resolution()
+  typedef sc_signal_t<data_type,SC_DEFAULT_WRITER_POLICY> resolved_type;
+  const data_type* m_read_p = nullptr;  // current value of the channel.
+  resolved_type*   m_write_p = nullptr; // channel written directly.
   mutable sc_event_finder* m_neg_finder_p;
   mutable sc_event_finder* m_pos_finder_p;
 
@@ -1713,19 +1758,19 @@ public:
     // write the new value
 
     this_type& operator = ( const data_type& value_ )
-	{ (*this)->write( value_ ); return *this; }
+	{ this->write( value_ ); return *this; }
 
     this_type& operator = ( const in_if_type& interface_ )
-	{ (*this)->write( interface_.read() ); return *this; }
+	{ this->write( interface_.read() ); return *this; }
 
     this_type& operator = ( const in_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ this->write( port_->read() ); return *this; }
 
     this_type& operator = ( const inout_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ this->write( port_->read() ); return *this; }
 
     this_type& operator = ( const this_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ this->write( port_->read() ); return *this; }
 
     virtual const char* kind() const
         { return "sc_out"; }
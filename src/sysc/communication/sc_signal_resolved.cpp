@@ -36,6 +36,8 @@
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/communication/sc_signal_resolved.h"
 
+#include <algorithm>
+
 namespace sc_core {
 
 // Note that we assume that two drivers driving the resolved signal to a 1 or
@@ -53,31 +55,92 @@ sc_logic_resolution_tbl[4][4] =
 
 
 // ----------------------------------------------------------------------------
-//  FUNCTION : sc_logic_resolve
+//  CLASS : sc_logic_resolver
 //
-//  Resolution function for sc_dt::sc_logic.
+//  Driver values of a resolved signal in bit-plane form.
 // ----------------------------------------------------------------------------
 
-// resolves sc_dt::sc_logic values and returns the resolved value
+int
+sc_logic_resolver::find( const sc_process_b* proc_ )
+{
+    // processes tend to write in the same order in every delta cycle,
+    // so try the last writer and its successor before searching
+    int sz = drivers();
+    if( m_last < sz && m_proc_vec[m_last] == proc_ ) {
+        return m_last;
+    }
+    int next = m_last + 1;
+    if( next < sz && m_proc_vec[next] == proc_ ) {
+        return m_last = next;
+    }
+    for( int i = 0; i < sz; ++ i ) {
+        if( m_proc_vec[i] == proc_ ) {
+            return m_last = i;
+        }
+    }
+    return -1;
+}
 
-static void
-sc_logic_resolve( sc_dt::sc_logic& result_,
-                  const std::vector<sc_dt::sc_logic>& values_ )
+bool
+sc_logic_resolver::drive( const sc_process_b* proc_,
+                          const sc_dt::sc_digit* data_,
+                          const sc_dt::sc_digit* ctrl_ )
 {
-    int sz = values_.size();
+    int slot = find( proc_ );
+    if( slot < 0 ) {
+        m_last = drivers();
+        m_proc_vec.push_back( proc_ );
+        m_plane_vec.insert( m_plane_vec.end(), data_, data_ + m_words );
+        m_plane_vec.insert( m_plane_vec.end(), ctrl_, ctrl_ + m_words );
+        return true;
+    }
+
+    sc_dt::sc_digit* planes = &m_plane_vec[2 * m_words * slot];
+    bool changed = false;
+    for( int w = 0; w < m_words; ++ w ) {
+        if( planes[w] != data_[w] || planes[m_words + w] != ctrl_[w] ) {
+            planes[w] = data_[w];
+            planes[m_words + w] = ctrl_[w];
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+void
+sc_logic_resolver::resolve( sc_dt::sc_digit* data_,
+                            sc_dt::sc_digit* ctrl_ ) const
+{
+    int sz = drivers();
 
     sc_assert( sz != 0 );
 
+    const sc_dt::sc_digit* planes = &m_plane_vec[0];
     if( sz == 1 ) {
-	result_ = values_[0];
-	return;
+        std::copy( planes, planes + m_words, data_ );
+        std::copy( planes + m_words, planes + 2 * m_words, ctrl_ );
+        return;
     }
 
-    sc_dt::sc_logic_value_t res = values_[0].value();
-    for( int i = sz - 1; i > 0 && res != sc_dt::Log_X; -- i ) {
-       res = sc_logic_resolution_tbl[res][values_[i].value()];
+    // per bit: X if any driver is X or if both 0 and 1 are driven,
+    // otherwise the driven 0 or 1, otherwise Z
+    int stride = 2 * m_words;
+    for( int w = 0; w < m_words; ++ w ) {
+        sc_dt::sc_digit zero = 0;
+        sc_dt::sc_digit one = 0;
+        sc_dt::sc_digit x = 0;
+        const sc_dt::sc_digit* p = planes + w;
+        for( int i = 0; i < sz; ++ i, p += stride ) {
+            sc_dt::sc_digit d = p[0];
+            sc_dt::sc_digit c = p[m_words];
+            zero |= ~d & ~c;
+            one  |= d & ~c;
+            x    |= d & c;
+        }
+        x |= zero & one;
+        data_[w] = one | x;
+        ctrl_[w] = x | ~( zero | one );
     }
-    result_ = res;
 }
 
 
@@ -92,29 +155,9 @@ sc_logic_resolve( sc_dt::sc_logic& result_,
 void
 sc_signal_resolved::write( const value_type& value_ )
 {
-    sc_process_b* cur_proc = sc_get_current_process_b();
-
-    bool value_changed = false;
-    bool found = false;
-    
-    for( int i = m_proc_vec.size() - 1; i >= 0; -- i ) {
-	if( cur_proc == m_proc_vec[i] ) {
-	    if( value_ != m_val_vec[i] ) {
-		m_val_vec[i] = value_;
-		value_changed = true;
-	    }
-	    found = true;
-	    break;
-	}
-    }
-    
-    if( ! found ) {
-	m_proc_vec.push_back( cur_proc );
-	m_val_vec.push_back( value_ );
-	value_changed = true;
-    }
-    
-    if( value_changed ) {
+    sc_dt::sc_digit data = value_.value() & 1;
+    sc_dt::sc_digit ctrl = value_.value() >> 1;
+    if( m_drivers.drive( sc_get_current_process_b(), &data, &ctrl ) ) {
 	request_update();
     }
 }
@@ -123,7 +166,10 @@ sc_signal_resolved::write( const value_type& value_ )
 void
 sc_signal_resolved::update()
 {
-    sc_logic_resolve( m_new_val, m_val_vec );
+    sc_dt::sc_digit data;
+    sc_dt::sc_digit ctrl;
+    m_drivers.resolve( &data, &ctrl );
+    m_new_val = sc_dt::sc_logic_value_t( ( data & 1 ) | ( ctrl & 1 ) << 1 );
     base_type::update();
 }
 
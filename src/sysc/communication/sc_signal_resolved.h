@@ -32,6 +32,7 @@
 
 
 #include "sysc/communication/sc_signal.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
 
 #if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
 #pragma warning(push)
@@ -45,6 +46,50 @@ class sc_process_b;
 extern SC_API const sc_dt::sc_logic_value_t sc_logic_resolution_tbl[4][4];
 
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_logic_resolver
+//
+//  Driver values of a resolved signal, kept in the bit-plane form of
+//  sc_dt::sc_lv_base (a data and a control word per 32 bits: 0 = 00,
+//  1 = 10, Z = 01, X = 11). Each writing process gets a stable slot on its
+//  first write, and the resolution runs word-parallel over all slots.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_logic_resolver
+{
+public:
+
+    explicit sc_logic_resolver( int words_ = 1 )
+      : m_words( words_ ), m_proc_vec(), m_plane_vec(), m_last( 0 )
+    {}
+
+    // store the value driven by the given process, returns true if the
+    // value of the driver changed (or the driver is new)
+    bool drive( const sc_process_b*,
+                const sc_dt::sc_digit* data_, const sc_dt::sc_digit* ctrl_ );
+
+    // resolve the values of all drivers
+    void resolve( sc_dt::sc_digit* data_, sc_dt::sc_digit* ctrl_ ) const;
+
+    int drivers() const
+        { return static_cast<int>( m_proc_vec.size() ); }
+
+    int words() const
+        { return m_words; }
+
+private:
+
+    int find( const sc_process_b* );
+
+private:
+
+    int                              m_words;     // words per plane
+    std::vector<const sc_process_b*> m_proc_vec;  // processes writing
+    std::vector<sc_dt::sc_digit>     m_plane_vec; // data/control per slot
+    int                              m_last;      // slot of last writer
+};
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_signal_resolved
 //
@@ -68,17 +113,17 @@ public:
 
     sc_signal_resolved()
       : base_type( sc_gen_unique_name( "signal_resolved" ) )
-      , m_proc_vec(), m_val_vec()
+      , m_drivers()
     {}
 
     explicit sc_signal_resolved( const char* name_ )
       : base_type( name_ )
-      , m_proc_vec(), m_val_vec()
+      , m_drivers()
     {}
 
     sc_signal_resolved( const char* name_, const value_type& initial_value_ )
       : base_type( name_, initial_value_ )
-      , m_proc_vec() , m_val_vec()
+      , m_drivers()
     {}
 
     // interface methods
@@ -110,8 +155,7 @@ protected:
     virtual void update();
 
 protected:
-    std::vector<sc_process_b*> m_proc_vec; // processes writing this signal
-    std::vector<value_type>    m_val_vec;  // new values written this signal
+    sc_logic_resolver m_drivers; // values written to this signal
 
 private:
 
@@ -30,6 +30,7 @@
 #define SC_SIGNAL_RV_H
 
 #include "sysc/communication/sc_signal.h"
+#include "sysc/communication/sc_signal_resolved.h"
 #include "sysc/datatypes/bit/sc_lv.h"
 
 namespace sc_core {
@@ -108,21 +109,20 @@ public:
 
     sc_signal_rv()
       : base_type( sc_gen_unique_name( "signal_rv" ) )
+      , m_drivers( words )
     {}
 
     explicit sc_signal_rv( const char* name_ )
       : base_type( name_, value_type() )
+      , m_drivers( words )
     {}
 
     sc_signal_rv( const char* name_, const value_type& initial_value_ )
       : base_type( name_, initial_value_ )
+      , m_drivers( words )
     {}
 
 
-    // destructor
-    virtual ~sc_signal_rv();
-
-
     // interface methods
 
     virtual void register_port( sc_port_base&, const char* )
@@ -154,8 +154,9 @@ protected:
 
 protected:
 
-    std::vector<sc_process_b*> m_proc_vec; // processes writing this signal
-    std::vector<value_type*>   m_val_vec;  // new values written this signal
+    static const int words = ( W - 1 ) / sc_dt::SC_DIGIT_SIZE + 1;
+
+    sc_logic_resolver m_drivers; // values written to this signal
 
 private:
 
@@ -167,18 +168,6 @@ private:
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
 
 
-// destructor
-
-template <int W>
-inline
-sc_signal_rv<W>::~sc_signal_rv()
-{
-    for( int i = m_val_vec.size() - 1; i >= 0; -- i ) {
-	delete m_val_vec[i];
-    }
-}
-
-
 // write the new value
 
 template <int W>
@@ -186,29 +175,13 @@ inline
 void
 sc_signal_rv<W>::write( const value_type& value_ )
 {
-    sc_process_b* cur_proc = sc_get_current_process_b();
-
-    bool value_changed = false;
-    bool found = false;
-    
-    for( int i = m_proc_vec.size() - 1; i >= 0; -- i ) {
-	if( cur_proc == m_proc_vec[i] ) {
-	    if( value_ != *m_val_vec[i] ) {
-		*m_val_vec[i] = value_;
-		value_changed = true;
-	    }
-	    found = true;
-	    break;
-	}
-    }
-    
-    if( ! found ) {
-	m_proc_vec.push_back( cur_proc );
-	m_val_vec.push_back( new value_type( value_ ) );
-	value_changed = true;
+    sc_dt::sc_digit data[words];
+    sc_dt::sc_digit ctrl[words];
+    for( int w = 0; w < words; ++ w ) {
+	data[w] = value_.get_word( w );
+	ctrl[w] = value_.get_cword( w );
     }
-    
-    if( value_changed ) {
+    if( m_drivers.drive( sc_get_current_process_b(), data, ctrl ) ) {
 	this->request_update();
     }
 }
@@ -219,7 +192,14 @@ inline
 void
 sc_signal_rv<W>::update()
 {
-    sc_lv_resolve<W>::resolve( this->m_new_val, m_val_vec );
+    sc_dt::sc_digit data[words];
+    sc_dt::sc_digit ctrl[words];
+    m_drivers.resolve( data, ctrl );
+    for( int w = 0; w < words; ++ w ) {
+	this->m_new_val.set_word( w, data[w] );
+	this->m_new_val.set_cword( w, ctrl[w] );
+    }
+    this->m_new_val.clean_tail();
     base_type::update();
 }
 
@@ -0,0 +1,159 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_waiter_queue.cpp -- FIFO queue of processes waiting for a sc_mutex or a
+                         sc_semaphore.
+
+  CHANGE LOG IS AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/communication/sc_waiter_queue.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_wait.h"
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_waiter_queue::waiter
+// ----------------------------------------------------------------------------
+
+sc_waiter_queue::waiter::waiter( sc_waiter_queue& queue_, bool front_ )
+  : m_queue( queue_ ),
+    m_process_p( sc_get_current_process_b() ),
+    m_event_p( queue_.take_event() ),
+    m_prev_p( 0 ),
+    m_next_p( 0 ),
+    m_queued( true )
+{
+    if( front_ ) {
+        m_next_p = m_queue.m_head_p;
+        if( m_next_p ) {
+            m_next_p->m_prev_p = this;
+        } else {
+            m_queue.m_tail_p = this;
+        }
+        m_queue.m_head_p = this;
+    } else {
+        m_prev_p = m_queue.m_tail_p;
+        if( m_prev_p ) {
+            m_prev_p->m_next_p = this;
+        } else {
+            m_queue.m_head_p = this;
+        }
+        m_queue.m_tail_p = this;
+    }
+}
+
+sc_waiter_queue::waiter::~waiter()
+{
+    if( m_queued ) {
+        m_queue.unlink( this );
+    }
+    m_queue.give_event( m_event_p );
+}
+
+void
+sc_waiter_queue::waiter::wait()
+{
+    sc_core::wait( *m_event_p, sc_get_curr_simcontext() );
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_waiter_queue
+// ----------------------------------------------------------------------------
+
+sc_waiter_queue::sc_waiter_queue()
+  : m_head_p( 0 ),
+    m_tail_p( 0 ),
+    m_events()
+{}
+
+sc_waiter_queue::~sc_waiter_queue()
+{
+    for( std::size_t i = 0; i < m_events.size(); ++ i ) {
+        delete m_events[i];
+    }
+}
+
+sc_event*
+sc_waiter_queue::take_event()
+{
+    if( m_events.empty() ) {
+        return new sc_event( sc_event::kernel_event );
+    }
+    sc_event* e = m_events.back();
+    m_events.pop_back();
+    return e;
+}
+
+void
+sc_waiter_queue::give_event( sc_event* e )
+{
+    e->cancel(); // a pending wake-up of an unwound process
+    m_events.push_back( e );
+}
+
+sc_process_b*
+sc_waiter_queue::wake_front( bool immediate )
+{
+    waiter* w = m_head_p;
+    if( !w ) {
+        return 0;
+    }
+    unlink( w );
+    if( immediate ) {
+        w->m_event_p->notify();
+    } else {
+        w->m_event_p->notify( SC_ZERO_TIME );
+    }
+    return w->m_process_p;
+}
+
+void
+sc_waiter_queue::unlink( waiter* w )
+{
+    if( w->m_prev_p ) {
+        w->m_prev_p->m_next_p = w->m_next_p;
+    } else {
+        m_head_p = w->m_next_p;
+    }
+    if( w->m_next_p ) {
+        w->m_next_p->m_prev_p = w->m_prev_p;
+    } else {
+        m_tail_p = w->m_prev_p;
+    }
+    w->m_prev_p = 0;
+    w->m_next_p = 0;
+    w->m_queued = false;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
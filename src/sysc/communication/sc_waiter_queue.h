@@ -0,0 +1,137 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_waiter_queue.h -- FIFO queue of processes waiting for a sc_mutex or a
+                       sc_semaphore.
+
+  CHANGE LOG IS AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_WAITER_QUEUE_H
+#define SC_WAITER_QUEUE_H
+
+#include "sysc/kernel/sc_event.h"
+
+#include <vector>
+
+namespace sc_core {
+
+class sc_process_b;
+
+// WAITER FAIRNESS POLICIES
+//
+// Policy of sc_mutex and sc_semaphore when they are released while processes
+// are waiting. In both cases only the longest waiting process is resumed.
+
+enum sc_fairness_policy
+{
+  SC_COMPETING_WAITERS = 0, ///< the resumed waiter competes with other callers
+  SC_FIFO_WAITERS      = 1  ///< ownership is handed to the longest waiter
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_waiter_queue (implementation-defined)
+//
+//  Intrusive FIFO of the thread processes blocked in a sc_mutex or a
+//  sc_semaphore. Each waiter lives on the stack of its thread and waits on
+//  its own kernel event, taken from a pool owned by the queue, so releasing
+//  the channel resumes exactly one process.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_waiter_queue
+{
+public:
+
+    class SC_API waiter
+    {
+        friend class sc_waiter_queue;
+
+    public:
+
+        // enqueue the current process, at the head if it lost the race for
+        // the channel after being woken
+        explicit waiter( sc_waiter_queue& queue_, bool front_ = false );
+
+        // dequeue the process if it is still waiting
+        ~waiter();
+
+        // suspend the process until it is woken
+        void wait();
+
+        // has the process been removed from the queue by wake_front()?
+        bool woken() const
+            { return !m_queued; }
+
+    private:
+        sc_waiter_queue& m_queue;
+        sc_process_b*    m_process_p;
+        sc_event*        m_event_p;
+        waiter*          m_prev_p;
+        waiter*          m_next_p;
+        bool             m_queued;
+
+    private:
+        // disabled
+        waiter( const waiter& );
+        waiter& operator = ( const waiter& );
+    };
+
+    sc_waiter_queue();
+    ~sc_waiter_queue();
+
+    bool empty() const
+        { return m_head_p == 0; }
+
+    // resume the longest waiting process, immediately or in the next delta
+    // cycle, and return it (null if there is none)
+    sc_process_b* wake_front( bool immediate = true );
+
+private:
+
+    sc_event* take_event();
+    void      give_event( sc_event* );
+    void      unlink( waiter* );
+
+private:
+    waiter*                m_head_p;
+    waiter*                m_tail_p;
+    std::vector<sc_event*> m_events;   // pool of free waiter events.
+
+private:
+    // disabled
+    sc_waiter_queue( const sc_waiter_queue& );
+    sc_waiter_queue& operator = ( const sc_waiter_queue& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_WAITER_QUEUE_H
@@ -39,6 +39,7 @@
 #endif
 
 #include "sysc/kernel/sc_process_handle.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
 
 #if defined(_MSC_VER) && _MSC_VER < 1800
 # pragma warning(push)
@@ -91,13 +92,15 @@ struct SC_API sc_writer_policy_check_write
 
 private:
   static bool only_delta();
+  bool check_new_writer( sc_object* target );
 
 protected:
   sc_writer_policy_check_write( bool delta_only = only_delta() )
-    : m_delta_only( delta_only ), m_writer_p() {}
+    : m_delta_only( delta_only ), m_writer_p(), m_writer_stamp( 0 ) {}
 
   const bool         m_delta_only;
   sc_process_handle  m_writer_p;
+  sc_dt::uint64      m_writer_stamp; // writer stamp of last check.
 };
 
 struct SC_API sc_writer_policy_check_delta
@@ -109,7 +112,11 @@ struct SC_API sc_writer_policy_check_delta
   bool needs_update() const { return true; }
 
   // reset current writer during update phase
-  void update() { sc_process_handle().swap( m_writer_p ); }
+  void update()
+  {
+    sc_process_handle().swap( m_writer_p );
+    m_writer_stamp = 0;
+  }
 
 protected:
   sc_writer_policy_check_delta()
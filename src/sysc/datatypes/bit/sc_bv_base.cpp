@@ -159,6 +159,44 @@ sc_bv_base::operator = ( const char* a )
 }
 
 
+// word-parallel bitwise operations (see sc_lv_base.cpp)
+
+sc_bv_base&
+sc_bv_base::and_words( const sc_bv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    const sc_digit* y_dw = y.m_data;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	x_dw[i] &= y_dw[i];
+    }
+    return *this;
+}
+
+sc_bv_base&
+sc_bv_base::or_words( const sc_bv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    const sc_digit* y_dw = y.m_data;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	x_dw[i] |= y_dw[i];
+    }
+    return *this;
+}
+
+sc_bv_base&
+sc_bv_base::xor_words( const sc_bv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    const sc_digit* y_dw = y.m_data;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	x_dw[i] ^= y_dw[i];
+    }
+    return *this;
+}
+
 // ----------------------------------------------------------------------------
 
 // convert formatted string to binary string
@@ -218,6 +218,15 @@ public:
     bool is_01() const
 	{ return true; }
 
+
+    // word-parallel forms of the bitwise operations (see sc_lv_base.h and
+    // sc_bv_base.cpp); the operands of and_words etc. have the length of
+    // this vector
+
+    sc_bv_base& and_words( const sc_bv_base& y );
+    sc_bv_base& or_words( const sc_bv_base& y );
+    sc_bv_base& xor_words( const sc_bv_base& y );
+
 protected:
 
     int     m_len;  // length in bits
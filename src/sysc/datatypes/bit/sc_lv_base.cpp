@@ -184,4 +184,103 @@ sc_lv_base::is_01() const
     return true;
 }
 
+
+// word-parallel bitwise operations
+//
+// The loops below work on the data (dw) and control (cw) words without
+// bound checks, so that the compiler can vectorize them. The results
+// follow the tables of sc_logic; the bits above m_len stay 0.
+
+sc_lv_base&
+sc_lv_base::and_words( const sc_lv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    sc_digit* x_cw = m_ctrl;
+    const sc_digit* y_dw = y.m_data;
+    const sc_digit* y_cw = y.m_ctrl;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit cw = (x_dw[i] & y_cw[i]) | (x_cw[i] & y_dw[i]) |
+	              (x_cw[i] & y_cw[i]);
+	x_dw[i] = cw | (x_dw[i] & y_dw[i]);
+	x_cw[i] = cw;
+    }
+    return *this;
+}
+
+sc_lv_base&
+sc_lv_base::and_words( const sc_bv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    sc_digit* x_cw = m_ctrl;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit y_dw = y.get_word( i );
+	sc_digit cw = x_cw[i] & y_dw;
+	x_dw[i] = cw | (x_dw[i] & y_dw);
+	x_cw[i] = cw;
+    }
+    return *this;
+}
+
+sc_lv_base&
+sc_lv_base::or_words( const sc_lv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    sc_digit* x_cw = m_ctrl;
+    const sc_digit* y_dw = y.m_data;
+    const sc_digit* y_cw = y.m_ctrl;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit cw = (x_cw[i] & y_cw[i]) | (x_cw[i] & ~y_dw[i]) |
+	              (~x_dw[i] & y_cw[i]);
+	x_dw[i] = cw | x_dw[i] | y_dw[i];
+	x_cw[i] = cw;
+    }
+    return *this;
+}
+
+sc_lv_base&
+sc_lv_base::or_words( const sc_bv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    sc_digit* x_cw = m_ctrl;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit y_dw = y.get_word( i );
+	sc_digit cw = x_cw[i] & ~y_dw;
+	x_dw[i] = cw | x_dw[i] | y_dw;
+	x_cw[i] = cw;
+    }
+    return *this;
+}
+
+sc_lv_base&
+sc_lv_base::xor_words( const sc_lv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    sc_digit* x_cw = m_ctrl;
+    const sc_digit* y_dw = y.m_data;
+    const sc_digit* y_cw = y.m_ctrl;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit cw = x_cw[i] | y_cw[i];
+	x_dw[i] = cw | (x_dw[i] ^ y_dw[i]);
+	x_cw[i] = cw;
+    }
+    return *this;
+}
+
+sc_lv_base&
+sc_lv_base::xor_words( const sc_bv_base& y )
+{
+    sc_digit* x_dw = m_data;
+    const sc_digit* x_cw = m_ctrl;
+    int sz = m_size;
+    for( int i = 0; i < sz; ++ i ) {
+	x_dw[i] = x_cw[i] | (x_dw[i] ^ y.get_word( i ));
+    }
+    return *this;
+}
+
 } // namespace sc_dt
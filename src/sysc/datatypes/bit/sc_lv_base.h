@@ -233,6 +233,18 @@ public:
 
     bool is_01() const;
 
+
+    // word-parallel forms of the bitwise operations, used by the operators
+    // for sc_lv_base and sc_bv_base operands (see sc_lv_base.cpp); the
+    // operands of and_words etc. have the length of this vector
+
+    sc_lv_base& and_words( const sc_lv_base& y );
+    sc_lv_base& and_words( const sc_bv_base& y );
+    sc_lv_base& or_words( const sc_lv_base& y );
+    sc_lv_base& or_words( const sc_bv_base& y );
+    sc_lv_base& xor_words( const sc_lv_base& y );
+    sc_lv_base& xor_words( const sc_bv_base& y );
+
 protected:
 
     int     m_len;   // length in bits
@@ -318,6 +330,35 @@ sc_lv_base::clean_tail()
 
 // bitwise operators and functions
 
+// The assignment operators for whole sc_lv_base and sc_bv_base operands of
+// equal length work directly on their data and control words instead of
+// going through the generic word accessors.
+
+#define DEFN_BITWISE_ASN_OP_WORDS(op, fn, x_type, y_type)                     \
+inline                                                                        \
+x_type&                                                                       \
+operator op ( x_type& x, const y_type& y )                                    \
+{                                                                             \
+    if( x.length() == y.length() ) {                                          \
+        return x.fn( y );                                                     \
+    }                                                                         \
+    sc_proxy<x_type>& px = x;                                                 \
+    return px op static_cast<const sc_proxy<y_type>&>( y );                   \
+}
+
+DEFN_BITWISE_ASN_OP_WORDS(&=, and_words, sc_lv_base, sc_lv_base)
+DEFN_BITWISE_ASN_OP_WORDS(&=, and_words, sc_lv_base, sc_bv_base)
+DEFN_BITWISE_ASN_OP_WORDS(&=, and_words, sc_bv_base, sc_bv_base)
+DEFN_BITWISE_ASN_OP_WORDS(|=, or_words, sc_lv_base, sc_lv_base)
+DEFN_BITWISE_ASN_OP_WORDS(|=, or_words, sc_lv_base, sc_bv_base)
+DEFN_BITWISE_ASN_OP_WORDS(|=, or_words, sc_bv_base, sc_bv_base)
+DEFN_BITWISE_ASN_OP_WORDS(^=, xor_words, sc_lv_base, sc_lv_base)
+DEFN_BITWISE_ASN_OP_WORDS(^=, xor_words, sc_lv_base, sc_bv_base)
+DEFN_BITWISE_ASN_OP_WORDS(^=, xor_words, sc_bv_base, sc_bv_base)
+
+#undef DEFN_BITWISE_ASN_OP_WORDS
+
+
 // bitwise complement
 
 template <class X>
@@ -1279,18 +1279,37 @@ reverse( const sc_proxy<X>& a );
 
 // reduce functions
 
+// The results do not depend on the order of the bits, so the words are
+// reduced as a whole: and_reduce is 0 if any bit is 0, or_reduce is 1 if
+// any bit is 1, otherwise both are X if any bit is X or Z. xor_reduce is
+// X if any bit is X or Z and the parity of the data bits otherwise.
+
 template <class X>
 inline
 typename sc_proxy<X>::value_type
 sc_proxy<X>::and_reduce() const
 {
     const X& x = back_cast();
-    value_type result = value_type( 1 );
-    int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::and_table[result][x.get_bit( i )];
+    int sz = x.size();
+    sc_digit zeros = SC_DIGIT_ZERO;
+    sc_digit unknown = SC_DIGIT_ZERO;
+    for( int i = 0; i < sz - 1; ++ i ) {
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	zeros |= ~(x_dw | x_cw);
+	unknown |= x_cw;
+    }
+    sc_digit x_dw, x_cw;
+    get_words_( x, sz - 1, x_dw, x_cw );
+    int bi = x.length() % SC_DIGIT_SIZE;
+    sc_digit mask = ( bi == 0 ) ? ~SC_DIGIT_ZERO
+                                : ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bi);
+    zeros |= ~(x_dw | x_cw) & mask;
+    unknown |= x_cw & mask;
+    if( zeros != SC_DIGIT_ZERO ) {
+	return value_type( Log_0 );
     }
-    return result;
+    return value_type( unknown != SC_DIGIT_ZERO ? Log_X : Log_1 );
 }
 
 template <class X>
@@ -1299,12 +1318,26 @@ typename sc_proxy<X>::value_type
 sc_proxy<X>::or_reduce() const
 {
     const X& x = back_cast();
-    value_type result = value_type( 0 );
-    int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::or_table[result][x.get_bit( i )];
+    int sz = x.size();
+    sc_digit ones = SC_DIGIT_ZERO;
+    sc_digit unknown = SC_DIGIT_ZERO;
+    for( int i = 0; i < sz - 1; ++ i ) {
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	ones |= x_dw & ~x_cw;
+	unknown |= x_cw;
+    }
+    sc_digit x_dw, x_cw;
+    get_words_( x, sz - 1, x_dw, x_cw );
+    int bi = x.length() % SC_DIGIT_SIZE;
+    sc_digit mask = ( bi == 0 ) ? ~SC_DIGIT_ZERO
+                                : ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bi);
+    ones |= x_dw & ~x_cw & mask;
+    unknown |= x_cw & mask;
+    if( ones != SC_DIGIT_ZERO ) {
+	return value_type( Log_1 );
     }
-    return result;
+    return value_type( unknown != SC_DIGIT_ZERO ? Log_X : Log_0 );
 }
 
 template <class X>
@@ -1313,12 +1346,30 @@ typename sc_proxy<X>::value_type
 sc_proxy<X>::xor_reduce() const
 {
     const X& x = back_cast();
-    value_type result = value_type( 0 );
-    int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::xor_table[result][x.get_bit( i )];
+    int sz = x.size();
+    sc_digit parity = SC_DIGIT_ZERO;
+    sc_digit unknown = SC_DIGIT_ZERO;
+    for( int i = 0; i < sz - 1; ++ i ) {
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	parity ^= x_dw;
+	unknown |= x_cw;
+    }
+    sc_digit x_dw, x_cw;
+    get_words_( x, sz - 1, x_dw, x_cw );
+    int bi = x.length() % SC_DIGIT_SIZE;
+    sc_digit mask = ( bi == 0 ) ? ~SC_DIGIT_ZERO
+                                : ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bi);
+    parity ^= x_dw & mask;
+    unknown |= x_cw & mask;
+    if( unknown != SC_DIGIT_ZERO ) {
+	return value_type( Log_X );
+    }
+    // fold the parity of the word into its lowest bit
+    for( int shift = SC_DIGIT_SIZE / 2; shift > 0; shift /= 2 ) {
+	parity ^= parity >> shift;
     }
-    return result;
+    return value_type( parity & SC_DIGIT_ONE );
 }
 
 
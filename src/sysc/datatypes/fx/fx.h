@@ -50,6 +50,7 @@
 
 #include "sysc/datatypes/fx/sc_fixed.h"
 #include "sysc/datatypes/fx/sc_fxcast_switch.h"
+#include "sysc/datatypes/fx/sc_fxnative.h"
 #include "sysc/datatypes/fx/sc_fxtype_params.h"
 #include "sysc/datatypes/fx/sc_ufixed.h"
 
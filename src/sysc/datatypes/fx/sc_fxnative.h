@@ -0,0 +1,841 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_fxnative.h - Fixed-point types with a word length of at most 64 bits,
+                  stored in a native integer.
+
+  sc_fixed_native<W,I,Q,O,N> and sc_ufixed_native<W,I,Q,O,N> hold the same
+  values as sc_fixed<W,I,Q,O,N> and sc_ufixed<W,I,Q,O,N> (with the cast
+  switch on), but keep them in an int64 or uint64 and apply the
+  quantization and overflow modes, which are template arguments, inline.
+  There is no scfx_rep, no observer and no cast switch.
+
+  The operators +, - and * and unary - return the exact result in a native
+  type of the required format, as sc_fxval does for sc_fixed; it is cast
+  when assigned to a variable. A result that needs more than 64 bits is a
+  compile time error: assign one of the operands to a narrower variable
+  first, or use sc_fixed. There is no division and no bit or part
+  selection; value() gives the exact value as an sc_fxval for these.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#ifndef SC_FXNATIVE_H
+#define SC_FXNATIVE_H
+
+
+#include "sysc/datatypes/fx/sc_fix.h"
+#include "sysc/datatypes/fx/sc_ufix.h"
+
+#include <cmath>
+#include <type_traits>
+
+
+namespace sc_dt
+{
+
+// classes defined in this module
+template <int W, int I, bool S, sc_q_mode Q, sc_o_mode O, int N>
+class sc_fxnative;
+
+
+// signed and unsigned fixed-point types with native storage
+
+template <int W, int I,
+	  sc_q_mode Q = SC_DEFAULT_Q_MODE_,
+	  sc_o_mode O = SC_DEFAULT_O_MODE_, int N = SC_DEFAULT_N_BITS_>
+using sc_fixed_native = sc_fxnative<W,I,true,Q,O,N>;
+
+template <int W, int I,
+	  sc_q_mode Q = SC_DEFAULT_Q_MODE_,
+	  sc_o_mode O = SC_DEFAULT_O_MODE_, int N = SC_DEFAULT_N_BITS_>
+using sc_ufixed_native = sc_fxnative<W,I,false,Q,O,N>;
+
+
+// ----------------------------------------------------------------------------
+//  Functions on the raw values of sc_fxnative: an int64 for the signed and
+//  an uint64 for the unsigned types. v * 2^e is the exact value in units
+//  of the least significant bit of the target format, with e >= 0.
+// ----------------------------------------------------------------------------
+
+inline
+bool
+scfx_native_is_neg( int64 v )
+{
+    return v < 0;
+}
+
+inline
+bool
+scfx_native_is_neg( uint64 )
+{
+    return false;
+}
+
+// the mask of the n least significant bits, 0 <= n <= 64
+
+inline
+uint64
+scfx_native_mask( int n )
+{
+    return ( n <= 0 ) ? 0 : ~UINT64_ZERO >> ( 64 - n );
+}
+
+// bit i of v * 2^e in two's complement
+
+template <class V>
+inline
+bool
+scfx_native_bit( V v, int e, int i )
+{
+    if( i < e )
+	return false;
+    if( i - e >= 64 )
+	return scfx_native_is_neg( v );
+    return ( ( static_cast<uint64>( v ) >> ( i - e ) ) & UINT64_ONE ) != 0;
+}
+
+// v * 2^e >= 2^k
+
+inline
+bool
+scfx_native_ge( int64 v, int e, int k )
+{
+    if( v <= 0 )
+	return false;
+    if( k < e )
+	return true;
+    return k - e < 63 && v >= ( static_cast<int64>( 1 ) << ( k - e ) );
+}
+
+inline
+bool
+scfx_native_ge( uint64 v, int e, int k )
+{
+    if( v == 0 )
+	return false;
+    if( k < e )
+	return true;
+    return k - e < 64 && v >= ( UINT64_ONE << ( k - e ) );
+}
+
+// v * 2^e < -2^k and v * 2^e <= -2^k
+
+inline
+bool
+scfx_native_lt_neg( int64 v, int e, int k )
+{
+    if( v >= 0 )
+	return false;
+    if( k < e )
+	return true;
+    return k - e < 63 && v < -( static_cast<int64>( 1 ) << ( k - e ) );
+}
+
+inline
+bool
+scfx_native_lt_neg( uint64, int, int )
+{
+    return false;
+}
+
+inline
+bool
+scfx_native_le_neg( int64 v, int e, int k )
+{
+    if( v >= 0 )
+	return false;
+    if( k < e )
+	return true;
+    if( k - e >= 63 )
+	return k - e == 63 && v == static_cast<int64>( UINT64_ONE << 63 );
+    return v <= -( static_cast<int64>( 1 ) << ( k - e ) );
+}
+
+inline
+bool
+scfx_native_le_neg( uint64, int, int )
+{
+    return false;
+}
+
+
+// ----------------------------------------------------------------------------
+//  Formats of the exact results of the operators: the fraction is the
+//  longer one of the operands (the sum of both for *), the integer part is
+//  one bit longer than the longer one (the sum of both for *), and an
+//  unsigned operand gets a sign bit if the result is signed.
+// ----------------------------------------------------------------------------
+
+template <int W1, int I1, bool S1, int W2, int I2, bool S2>
+struct sc_fxnative_add_type
+{
+    static const int F1 = W1 - I1;
+    static const int F2 = W2 - I2;
+    static const bool S = S1 || S2;
+    static const int IA = ( S && ! S1 ) ? I1 + 1 : I1;
+    static const int IB = ( S && ! S2 ) ? I2 + 1 : I2;
+    static const int F = ( F1 > F2 ) ? F1 : F2;
+    static const int I = ( ( IA > IB ) ? IA : IB ) + 1;
+    static_assert( I + F <= 64, "sc_fxnative: the exact result of + needs "
+		   "more than 64 bits" );
+    typedef sc_fxnative<I + F, I, S, SC_TRN, SC_WRAP, 0> type;
+};
+
+template <int W1, int I1, bool S1, int W2, int I2, bool S2>
+struct sc_fxnative_sub_type
+{
+    static const int F1 = W1 - I1;
+    static const int F2 = W2 - I2;
+    static const int IA = S1 ? I1 : I1 + 1;
+    static const int IB = S2 ? I2 : I2 + 1;
+    static const int F = ( F1 > F2 ) ? F1 : F2;
+    static const int I = ( ( IA > IB ) ? IA : IB ) + 1;
+    static_assert( I + F <= 64, "sc_fxnative: the exact result of - needs "
+		   "more than 64 bits" );
+    typedef sc_fxnative<I + F, I, true, SC_TRN, SC_WRAP, 0> type;
+};
+
+template <int W1, int I1, bool S1, int W2, int I2, bool S2>
+struct sc_fxnative_mul_type
+{
+    static_assert( W1 + W2 <= 64, "sc_fxnative: the exact result of * needs "
+		   "more than 64 bits" );
+    typedef sc_fxnative<W1 + W2, I1 + I2, S1 || S2, SC_TRN, SC_WRAP, 0> type;
+};
+
+
+// ----------------------------------------------------------------------------
+//  TEMPLATE CLASS : sc_fxnative
+//
+//  Constrained fixed-point class with a word length of at most 64 bits;
+//  S selects the signed (two's complement) or unsigned encoding.
+// ----------------------------------------------------------------------------
+
+template <int W, int I, bool S, sc_q_mode Q, sc_o_mode O, int N>
+class sc_fxnative
+{
+    static_assert( W > 0 && W <= 64,
+		   "sc_fxnative: the word length must be in 1..64, "
+		   "use sc_fixed or sc_ufixed for longer ones" );
+    static_assert( N >= 0, "sc_fxnative: the number of saturated bits "
+		   "must not be negative" );
+
+public:
+
+    typedef typename std::conditional<S,int64,uint64>::type raw_type;
+
+    // number of fraction bits
+    static const int F = W - I;
+
+
+    // constructors
+
+    sc_fxnative()
+	: m_raw( 0 )
+	{}
+
+#define DECL_CTORS_T_A(tp)                                                    \
+    sc_fxnative( tp );
+
+#define DECL_CTORS_T_B(tp)                                                    \
+    explicit sc_fxnative( tp );
+
+    DECL_CTORS_T_A(int)
+    DECL_CTORS_T_A(unsigned int)
+    DECL_CTORS_T_A(long)
+    DECL_CTORS_T_A(unsigned long)
+    DECL_CTORS_T_A(float)
+    DECL_CTORS_T_A(double)
+    DECL_CTORS_T_A(const char*)
+    DECL_CTORS_T_A(const sc_fxval&)
+    DECL_CTORS_T_A(const sc_fxnum&)
+    DECL_CTORS_T_B(int64)
+    DECL_CTORS_T_B(uint64)
+
+#undef DECL_CTORS_T_A
+#undef DECL_CTORS_T_B
+
+    // conversion from other formats (quantization and overflow as in the
+    // assignment of sc_fixed to sc_fixed)
+
+    template <int W2, int I2, bool S2, sc_q_mode Q2, sc_o_mode O2, int N2>
+    sc_fxnative( const sc_fxnative<W2,I2,S2,Q2,O2,N2>& a )
+	: m_raw( cast( a.raw(), W2 - I2 ) )
+	{}
+
+
+    // assignment operators
+
+#define DECL_ASN_OP_T(tp)                                                     \
+    sc_fxnative& operator = ( tp a )                                          \
+	{ *this = sc_fxnative( a ); return *this; }
+
+    DECL_ASN_OP_T(int)
+    DECL_ASN_OP_T(unsigned int)
+    DECL_ASN_OP_T(long)
+    DECL_ASN_OP_T(unsigned long)
+    DECL_ASN_OP_T(float)
+    DECL_ASN_OP_T(double)
+    DECL_ASN_OP_T(const char*)
+    DECL_ASN_OP_T(const sc_fxval&)
+    DECL_ASN_OP_T(const sc_fxnum&)
+    DECL_ASN_OP_T(int64)
+    DECL_ASN_OP_T(uint64)
+
+#undef DECL_ASN_OP_T
+
+    template <int W2, int I2, bool S2, sc_q_mode Q2, sc_o_mode O2, int N2>
+    sc_fxnative& operator += ( const sc_fxnative<W2,I2,S2,Q2,O2,N2>& );
+
+    template <int W2, int I2, bool S2, sc_q_mode Q2, sc_o_mode O2, int N2>
+    sc_fxnative& operator -= ( const sc_fxnative<W2,I2,S2,Q2,O2,N2>& );
+
+    template <int W2, int I2, bool S2, sc_q_mode Q2, sc_o_mode O2, int N2>
+    sc_fxnative& operator *= ( const sc_fxnative<W2,I2,S2,Q2,O2,N2>& );
+
+    sc_fxnative& operator <<= ( int n )
+	{ m_raw = cast( m_raw, F - n ); return *this; }
+
+    sc_fxnative& operator >>= ( int n )
+	{ m_raw = cast( m_raw, F + n ); return *this; }
+
+
+    // implicit conversion
+
+    int           to_int() const
+	{ return static_cast<int>( to_uint64() ); }
+    unsigned int  to_uint() const
+	{ return static_cast<unsigned int>( to_uint64() ); }
+    long          to_long() const
+	{ return static_cast<long>( to_uint64() ); }
+    unsigned long to_ulong() const
+	{ return static_cast<unsigned long>( to_uint64() ); }
+    int64         to_int64() const
+	{ return static_cast<int64>( to_uint64() ); }
+    uint64        to_uint64() const;
+    float         to_float() const
+	{ return static_cast<float>( to_double() ); }
+    double        to_double() const;
+
+    const sc_fxval value() const;
+
+    const std::string to_string() const;
+    const std::string to_string( sc_numrep ) const;
+
+    void print( ::std::ostream& = ::std::cout ) const;
+
+
+    // the stored integer, value() * 2^F; from_raw() expects one that fits
+    // into W bits
+
+    raw_type raw() const
+	{ return m_raw; }
+
+    static sc_fxnative from_raw( raw_type r )
+	{ sc_fxnative a; a.m_raw = r; return a; }
+
+
+    // type parameters
+
+    int wl() const { return W; }
+    int iwl() const { return I; }
+    sc_q_mode q_mode() const { return Q; }
+    sc_o_mode o_mode() const { return O; }
+    int n_bits() const { return N; }
+
+private:
+
+    template <class V> static raw_type cast( V, int );
+    template <class V> static raw_type overflow( V, int );
+    template <class T> static raw_type cast_fx( const T& );
+    static raw_type cast_double( double );
+
+    static raw_type max_raw()
+	{ return static_cast<raw_type>( scfx_native_mask( S ? W - 1 : W ) ); }
+    static raw_type min_raw()
+	{ return S ? static_cast<raw_type>( -1 ) - max_raw() : 0; }
+
+private:
+
+    raw_type m_raw;
+
+};
+
+
+// IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
+
+// ----------------------------------------------------------------------------
+//  TEMPLATE CLASS : sc_fxnative
+//
+//  Constrained fixed-point class with a word length of at most 64 bits.
+// ----------------------------------------------------------------------------
+
+#define SC_FXNATIVE_TPL_                                                      \
+template <int W, int I, bool S, sc_q_mode Q, sc_o_mode O, int N>
+
+#define SC_FXNATIVE_TPL2_                                                     \
+template <int W2, int I2, bool S2, sc_q_mode Q2, sc_o_mode O2, int N2>
+
+#define SC_FXNATIVE_TPL_PAIR_                                                 \
+template <int W, int I, bool S, sc_q_mode Q, sc_o_mode O, int N,              \
+	  int W2, int I2, bool S2, sc_q_mode Q2, sc_o_mode O2, int N2>
+
+// cast v * 2^-fs to the format, as scfx_rep::cast() does
+
+SC_FXNATIVE_TPL_
+template <class V>
+inline
+typename sc_fxnative<W,I,S,Q,O,N>::raw_type
+sc_fxnative<W,I,S,Q,O,N>::cast( V v, int fs )
+{
+    int d = fs - F;
+    if( d <= 0 ) {
+	return overflow( v, -d );
+    }
+
+    // quantization: v = t * 2^d + r with 0 <= r < 2^d; cmp is the sign of
+    // r - 2^(d-1), the remainder compared to one half lsb
+    bool neg = scfx_native_is_neg( v );
+    V t;
+    int cmp;
+    bool r_zero;
+    if( d <= 64 ) {
+	uint64 r = static_cast<uint64>( v ) & scfx_native_mask( d );
+	uint64 half = UINT64_ONE << ( d - 1 );
+	t = ( d == 64 ) ? ( neg ? static_cast<V>( -1 ) : 0 ) : ( v >> d );
+	cmp = ( r < half ) ? -1 : ( r > half ? 1 : 0 );
+	r_zero = ( r == 0 );
+    } else {
+	t = neg ? static_cast<V>( -1 ) : 0;
+	cmp = neg ? 1 : -1;
+	r_zero = ( v == 0 );
+    }
+
+    bool incr = false;
+    switch( Q ) {
+	case SC_RND:			// rounding to plus infinity
+	    incr = ( cmp >= 0 );
+	    break;
+	case SC_RND_ZERO:		// rounding to zero
+	    incr = neg ? ( cmp >= 0 ) : ( cmp > 0 );
+	    break;
+	case SC_RND_MIN_INF:		// rounding to minus infinity
+	    incr = ( cmp > 0 );
+	    break;
+	case SC_RND_INF:		// rounding to infinity
+	    incr = neg ? ( cmp > 0 ) : ( cmp >= 0 );
+	    break;
+	case SC_RND_CONV:		// convergent rounding
+	    incr = ( cmp > 0 || ( cmp == 0 && ( t & 1 ) != 0 ) );
+	    break;
+	case SC_TRN:			// truncation
+	    break;
+	case SC_TRN_ZERO:		// truncation to zero
+	    incr = ( neg && ! r_zero );
+	    break;
+    }
+    return overflow( static_cast<V>( t + ( incr ? 1 : 0 ) ), 0 );
+}
+
+// overflow handling of v * 2^e, as scfx_rep::overflow() does
+
+SC_FXNATIVE_TPL_
+template <class V>
+inline
+typename sc_fxnative<W,I,S,Q,O,N>::raw_type
+sc_fxnative<W,I,S,Q,O,N>::overflow( V v, int e )
+{
+    bool neg = scfx_native_is_neg( v );
+    bool over;
+    bool under;
+    if( S ) {
+	over = scfx_native_ge( v, e, W - 1 );
+	under = ( O == SC_SAT_SYM ) ? scfx_native_le_neg( v, e, W - 1 )
+	                            : scfx_native_lt_neg( v, e, W - 1 );
+    } else {
+	over = scfx_native_ge( v, e, W );
+	under = neg;
+    }
+
+    // the W least significant bits of the result
+    uint64 bits = ( e >= 64 ) ? 0 : static_cast<uint64>( v ) << e;
+
+    if( over || under ) {
+	// the n_bits most significant bits, which SC_WRAP and SC_WRAP_SM
+	// saturate
+	uint64 high = scfx_native_mask( W ) & ~scfx_native_mask( W - N );
+	switch( O ) {
+	    case SC_SAT:		// saturation
+		return under ? min_raw() : max_raw();
+	    case SC_SAT_ZERO:		// saturation to zero
+		return 0;
+	    case SC_SAT_SYM:		// symmetrical saturation
+		return ( under && S ) ? static_cast<raw_type>( 0 ) - max_raw()
+		                      : ( under ? 0 : max_raw() );
+	    case SC_WRAP:		// wrap-around
+		if( N >= W ) {
+		    return under ? min_raw() : max_raw();
+		}
+		if( N > 0 ) {
+		    bits = under ? ( bits & ~high ) : ( bits | high );
+		    if( S ) {
+			bits ^= UINT64_ONE << ( W - 1 );
+		    }
+		}
+		break;
+	    case SC_WRAP_SM:		// sign magnitude wrap-around
+		SC_ERROR_IF_( ! S, sc_core::SC_ID_WRAP_SM_NOT_DEFINED_ );
+		if( N >= W ) {
+		    return under ? min_raw() : max_raw();
+		}
+		// the bits below W are read from bits, which also keeps
+		// g++ 12 from mis-threading the comparisons with neg
+		bool msb = ( ( bits >> ( W - 1 ) ) & UINT64_ONE ) != 0;
+		if( N == 0 ) {
+		    if( scfx_native_bit( v, e, W ) != msb ) {
+			bits = ~bits;
+		    }
+		} else if( N == 1 ) {
+		    if( neg != msb ) {
+			bits = ~bits;
+		    }
+		} else {
+		    if( neg == ( ( ( bits >> ( W - N ) ) & UINT64_ONE ) != 0 ) ) {
+			bits = ~bits;
+		    }
+		    bits = under ? ( bits & ~high ) : ( bits | high );
+		    bits ^= UINT64_ONE << ( W - 1 );
+		}
+		break;
+	}
+    }
+
+    if( S ) {
+	// sign extension of the W bits
+	return static_cast<raw_type>(
+	    static_cast<int64>( bits << ( 64 - W ) ) >> ( 64 - W ) );
+    }
+    return static_cast<raw_type>( bits & scfx_native_mask( W ) );
+}
+
+// cast of the values that only sc_fix and sc_ufix can hold exactly
+
+SC_FXNATIVE_TPL_
+template <class T>
+inline
+typename sc_fxnative<W,I,S,Q,O,N>::raw_type
+sc_fxnative<W,I,S,Q,O,N>::cast_fx( const T& a )
+{
+    sc_fxcast_switch cast_sw( SC_ON );
+    sc_fxval v = S ? sc_fix( a, W, I, Q, O, N, cast_sw ).value()
+                   : sc_ufix( a, W, I, Q, O, N, cast_sw ).value();
+    v <<= F;
+    return static_cast<raw_type>( v.to_uint64() );
+}
+
+SC_FXNATIVE_TPL_
+inline
+typename sc_fxnative<W,I,S,Q,O,N>::raw_type
+sc_fxnative<W,I,S,Q,O,N>::cast_double( double a )
+{
+    SC_ERROR_IF_( ! std::isfinite( a ), sc_core::SC_ID_INVALID_FX_VALUE_ );
+    // a = m * 2^(ex - 53) exactly, with an integer m
+    int ex;
+    double m = std::frexp( a, &ex );
+    return cast( static_cast<int64>( std::ldexp( m, 53 ) ), 53 - ex );
+}
+
+
+// constructors
+
+#define DEFN_CTORS_T(tp,expr)                                                 \
+SC_FXNATIVE_TPL_                                                              \
+inline                                                                        \
+sc_fxnative<W,I,S,Q,O,N>::sc_fxnative( tp a )                                 \
+: m_raw( expr )                                                               \
+{}
+
+DEFN_CTORS_T(int, cast( static_cast<int64>( a ), 0 ))
+DEFN_CTORS_T(unsigned int, cast( static_cast<uint64>( a ), 0 ))
+DEFN_CTORS_T(long, cast( static_cast<int64>( a ), 0 ))
+DEFN_CTORS_T(unsigned long, cast( static_cast<uint64>( a ), 0 ))
+DEFN_CTORS_T(float, cast_double( a ))
+DEFN_CTORS_T(double, cast_double( a ))
+DEFN_CTORS_T(const char*, cast_fx( a ))
+DEFN_CTORS_T(const sc_fxval&, cast_fx( a ))
+DEFN_CTORS_T(const sc_fxnum&, cast_fx( a ))
+DEFN_CTORS_T(int64, cast( a, 0 ))
+DEFN_CTORS_T(uint64, cast( a, 0 ))
+
+#undef DEFN_CTORS_T
+
+
+// arithmetic assignment operators
+
+#define DEFN_ASN_OP(op,bin_op)                                                \
+SC_FXNATIVE_TPL_                                                              \
+SC_FXNATIVE_TPL2_                                                             \
+inline                                                                        \
+sc_fxnative<W,I,S,Q,O,N>&                                                     \
+sc_fxnative<W,I,S,Q,O,N>::operator op (                                       \
+    const sc_fxnative<W2,I2,S2,Q2,O2,N2>& b )                                 \
+{                                                                             \
+    return *this = *this bin_op b;                                            \
+}
+
+DEFN_ASN_OP(+=,+)
+DEFN_ASN_OP(-=,-)
+DEFN_ASN_OP(*=,*)
+
+#undef DEFN_ASN_OP
+
+
+// implicit conversion
+
+// truncation towards zero, then wrap-around, as scfx_rep::to_uint64()
+
+SC_FXNATIVE_TPL_
+inline
+uint64
+sc_fxnative<W,I,S,Q,O,N>::to_uint64() const
+{
+    uint64 u = static_cast<uint64>( m_raw );
+    int f = F;
+    if( f <= 0 ) {
+	return ( -f >= 64 ) ? 0 : u << -f;
+    }
+    if( f >= 64 ) {
+	return 0;
+    }
+    if( scfx_native_is_neg( m_raw ) ) {
+	return 0 - ( ( 0 - u ) >> f );
+    }
+    return u >> f;
+}
+
+SC_FXNATIVE_TPL_
+inline
+double
+sc_fxnative<W,I,S,Q,O,N>::to_double() const
+{
+    // exact if the value has at most 53 significant bits and neither
+    // overflows nor underflows; otherwise scfx_rep does the rounding
+    if( W <= 53 && F <= 1022 && I <= 1023 ) {
+	return std::ldexp( static_cast<double>( m_raw ), -F );
+    }
+    return value().to_double();
+}
+
+SC_FXNATIVE_TPL_
+inline
+const sc_fxval
+sc_fxnative<W,I,S,Q,O,N>::value() const
+{
+    // m_raw = hi * 2^32 + lo, each half is exact in an sc_fxval
+    sc_fxval v = S ? sc_fxval( static_cast<int>(
+			 static_cast<int64>( m_raw ) >> 32 ) )
+		   : sc_fxval( static_cast<unsigned int>(
+			 static_cast<uint64>( m_raw ) >> 32 ) );
+    v <<= 32;
+    v += sc_fxval( static_cast<unsigned int>(
+	     static_cast<uint64>( m_raw ) & UINT64_32ONES ) );
+    v >>= F;
+    return v;
+}
+
+SC_FXNATIVE_TPL_
+inline
+const std::string
+sc_fxnative<W,I,S,Q,O,N>::to_string() const
+{
+    return S ? sc_fix( value(), W, I, Q, O, N ).to_string()
+             : sc_ufix( value(), W, I, Q, O, N ).to_string();
+}
+
+SC_FXNATIVE_TPL_
+inline
+const std::string
+sc_fxnative<W,I,S,Q,O,N>::to_string( sc_numrep numrep ) const
+{
+    return S ? sc_fix( value(), W, I, Q, O, N ).to_string( numrep )
+             : sc_ufix( value(), W, I, Q, O, N ).to_string( numrep );
+}
+
+SC_FXNATIVE_TPL_
+inline
+void
+sc_fxnative<W,I,S,Q,O,N>::print( ::std::ostream& os ) const
+{
+    os << to_string();
+}
+
+SC_FXNATIVE_TPL_
+inline
+::std::ostream&
+operator << ( ::std::ostream& os, const sc_fxnative<W,I,S,Q,O,N>& a )
+{
+    a.print( os );
+    return os;
+}
+
+
+// arithmetic operators, returning the exact result
+
+SC_FXNATIVE_TPL_
+inline
+const sc_fxnative<W,I,S,Q,O,N>&
+operator + ( const sc_fxnative<W,I,S,Q,O,N>& a )
+{
+    return a;
+}
+
+SC_FXNATIVE_TPL_
+inline
+const sc_fxnative<W + 1,I + 1,true,SC_TRN,SC_WRAP,0>
+operator - ( const sc_fxnative<W,I,S,Q,O,N>& a )
+{
+    static_assert( W < 64, "sc_fxnative: the exact result of - needs more "
+		   "than 64 bits" );
+    return sc_fxnative<W + 1,I + 1,true,SC_TRN,SC_WRAP,0>::from_raw(
+	static_cast<int64>( 0 - static_cast<uint64>( a.raw() ) ) );
+}
+
+#define DEFN_BIN_OP(op,traits)                                              \
+SC_FXNATIVE_TPL_PAIR_                                                         \
+inline                                                                        \
+const typename traits<W,I,S,W2,I2,S2>::type                                     \
+operator op ( const sc_fxnative<W,I,S,Q,O,N>& a,                              \
+	      const sc_fxnative<W2,I2,S2,Q2,O2,N2>& b )                       \
+{                                                                             \
+    typedef typename traits<W,I,S,W2,I2,S2>::type result_type;                  \
+    typedef typename result_type::raw_type raw_type;                          \
+    uint64 ua = static_cast<uint64>( a.raw() ) << ( result_type::F - W + I ); \
+    uint64 ub = static_cast<uint64>( b.raw() ) << ( result_type::F - W2 + I2 );\
+    return result_type::from_raw( static_cast<raw_type>( ua op ub ) );        \
+}
+
+DEFN_BIN_OP(+,sc_fxnative_add_type)
+DEFN_BIN_OP(-,sc_fxnative_sub_type)
+
+#undef DEFN_BIN_OP
+
+SC_FXNATIVE_TPL_PAIR_
+inline
+const typename sc_fxnative_mul_type<W,I,S,W2,I2,S2>::type
+operator * ( const sc_fxnative<W,I,S,Q,O,N>& a,
+	     const sc_fxnative<W2,I2,S2,Q2,O2,N2>& b )
+{
+    typedef typename sc_fxnative_mul_type<W,I,S,W2,I2,S2>::type result_type;
+    typedef typename result_type::raw_type raw_type;
+    return result_type::from_raw( static_cast<raw_type>( a.raw() ) *
+				  static_cast<raw_type>( b.raw() ) );
+}
+
+
+// relational (including equality) operators
+
+// the sign of a * 2^-fa - b * 2^-fb; the raw values compare by sign first,
+// then by magnitude, shifting the one with fewer fraction bits left unless
+// that overflows (then it is the larger one)
+
+inline
+uint64
+scfx_native_magnitude( int64 v )
+{
+    return ( v < 0 ) ? 0 - static_cast<uint64>( v ) : static_cast<uint64>( v );
+}
+
+inline
+uint64
+scfx_native_magnitude( uint64 v )
+{
+    return v;
+}
+
+// the sign of ma - mb * 2^d, d >= 0
+
+inline
+int
+scfx_native_compare_mag( uint64 ma, uint64 mb, int d )
+{
+    if( mb == 0 )
+	return ( ma != 0 ) ? 1 : 0;
+    if( d >= 64 || mb > ( ~UINT64_ZERO >> d ) )
+	return -1;
+    mb <<= d;
+    return ( ma < mb ) ? -1 : ( ma > mb ? 1 : 0 );
+}
+
+template <class A, class B>
+inline
+int
+scfx_native_compare( A a, int fa, B b, int fb )
+{
+    bool na = scfx_native_is_neg( a );
+    bool nb = scfx_native_is_neg( b );
+    if( na != nb )
+	return na ? -1 : 1;
+    uint64 ma = scfx_native_magnitude( a );
+    uint64 mb = scfx_native_magnitude( b );
+    int c = ( fa >= fb ) ? scfx_native_compare_mag( ma, mb, fa - fb )
+			 : -scfx_native_compare_mag( mb, ma, fb - fa );
+    return na ? -c : c;
+}
+
+#define DEFN_REL_OP(op)                                                       \
+SC_FXNATIVE_TPL_PAIR_                                                         \
+inline                                                                        \
+bool                                                                          \
+operator op ( const sc_fxnative<W,I,S,Q,O,N>& a,                              \
+	      const sc_fxnative<W2,I2,S2,Q2,O2,N2>& b )                       \
+{                                                                             \
+    return scfx_native_compare( a.raw(), W - I, b.raw(), W2 - I2 ) op 0;     \
+}
+
+DEFN_REL_OP(<)
+DEFN_REL_OP(<=)
+DEFN_REL_OP(>)
+DEFN_REL_OP(>=)
+DEFN_REL_OP(==)
+DEFN_REL_OP(!=)
+
+#undef DEFN_REL_OP
+
+#undef SC_FXNATIVE_TPL_
+#undef SC_FXNATIVE_TPL2_
+#undef SC_FXNATIVE_TPL_PAIR_
+
+} // namespace sc_dt
+
+
+#endif
+
+// Taf!
@@ -932,9 +932,11 @@ scfx_rep::to_uint64() const
 
     // Ignore bits off the top; they modulo out.
     // Ignore bits off the bottom; we're truncating.
-    while (shift < 64 && m_msw >= idx && idx >= m_lsw)
+    // Words below m_lsw are zero, even above the binary point.
+    while (shift < 64 && m_msw >= idx)
     {
-        result += static_cast<uint64>(m_mant[idx]) << shift;
+        if (idx >= m_lsw)
+            result += static_cast<uint64>(m_mant[idx]) << shift;
         shift += bits_in_word;
         idx += 1;
     }
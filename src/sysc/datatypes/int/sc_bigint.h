@@ -92,90 +92,90 @@ public:
     // constructors
 
     sc_bigint()
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{}
 
     sc_bigint( const sc_bigint<W>& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( const sc_signed& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( const sc_signed_subref& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     template< class T >
     sc_bigint( const sc_generic_base<T>& a )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ a->to_sc_signed(*this); }
 
     sc_bigint( const sc_unsigned& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( const sc_unsigned_subref& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( const char* v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( int64 v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( uint64 v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( long v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( unsigned long v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( int v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( unsigned int v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( double v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
   
     sc_bigint( const sc_bv_base& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     sc_bigint( const sc_lv_base& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
 #ifdef SC_INCLUDE_FX
 
     explicit sc_bigint( const sc_fxval& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     explicit sc_bigint( const sc_fxval_fast& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     explicit sc_bigint( const sc_fxnum& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
     explicit sc_bigint( const sc_fxnum_fast& v )
-	: sc_signed( W )
+	: sc_signed( W, m_digits )
 	{ *this = v; }
 
 #endif
@@ -186,7 +186,7 @@ public:
     // destructor
 
     ~sc_bigint()
-	{}
+	{ release_digits(); }
 
 #endif
  
@@ -263,9 +263,20 @@ public:
 	{ sc_signed::operator = ( v ); return *this; }
 
 #endif
+
+private:
+
+    // The digits of the sc_signed base live in the object itself, so
+    // neither construction nor copying of a sc_bigint<W> allocates.
+#ifndef SC_MAX_NBITS
+    sc_digit m_digits[DIV_CEIL(W)];
+#else
+    static constexpr sc_digit* m_digits = nullptr;
+#endif
 };
 
 } // namespace sc_dt
 
+#include "sysc/datatypes/int/sc_nbexpr.h"
 
 #endif
@@ -92,90 +92,90 @@ public:
     // constructors
 
     sc_biguint()
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{}
 
     sc_biguint( const sc_biguint<W>& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( const sc_unsigned& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( const sc_unsigned_subref& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     template< class T >
     sc_biguint( const sc_generic_base<T>& a )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ a->to_sc_unsigned(*this); }
 
     sc_biguint( const sc_signed& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( const sc_signed_subref& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( const char* v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; } 
 
     sc_biguint( int64 v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( uint64 v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( long v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( unsigned long v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( int v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; } 
 
     sc_biguint( unsigned int v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( double v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
   
     sc_biguint( const sc_bv_base& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     sc_biguint( const sc_lv_base& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
 #ifdef SC_INCLUDE_FX
 
     explicit sc_biguint( const sc_fxval& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     explicit sc_biguint( const sc_fxval_fast& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     explicit sc_biguint( const sc_fxnum& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
     explicit sc_biguint( const sc_fxnum_fast& v )
-	: sc_unsigned( W )
+	: sc_unsigned( W, m_digits )
 	{ *this = v; }
 
 #endif
@@ -186,7 +186,7 @@ public:
     // destructor
 
     ~sc_biguint()
-	{}
+	{ release_digits(); }
 
 #endif
  
@@ -264,9 +264,20 @@ public:
 	{ sc_unsigned::operator = ( v ); return *this; }
 
 #endif
+
+private:
+
+    // The digits of the sc_unsigned base live in the object itself, so
+    // neither construction nor copying of a sc_biguint<W> allocates.
+#ifndef SC_MAX_NBITS
+    sc_digit m_digits[DIV_CEIL(W + 1)];
+#else
+    static constexpr sc_digit* m_digits = nullptr;
+#endif
 };
 
 } // namespace sc_dt
 
+#include "sysc/datatypes/int/sc_nbexpr.h"
 
 #endif
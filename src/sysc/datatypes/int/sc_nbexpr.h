@@ -0,0 +1,286 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_nbexpr.h -- Exact +, - and * for sc_bigint<W> and sc_biguint<W>.
+
+  The operators +, - and * on sc_bigint<W> and sc_biguint<W> operands
+  return an sc_bigint (or an sc_biguint if both operands are unsigned,
+  except for -) of the exact width that holds every possible value, e.g.
+
+      sc_biguint<256> a, b;
+      sc_biguint<512> p = a * b;
+      sc_bigint<257>  d = a - b;
+
+  The result is evaluated when the operator is called: the terms are
+  accumulated in 2's complement directly into the digits of the result,
+  which live in the object itself, and converted to sign-magnitude once.
+  So neither the result nor any temporary is allocated on the heap, and
+  nested operations such as a*b + c*d - e only use results on the stack.
+
+  The results are ordinary values, so they may be kept, e.g. in an auto
+  variable, bound to a const sc_signed& (const sc_unsigned&), or used
+  with other types, e.g. sc_signed, sc_unsigned or int, which use the
+  operators of sc_signed and sc_unsigned.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#ifndef SC_NBEXPR_H
+#define SC_NBEXPR_H
+
+
+#include "sysc/datatypes/int/sc_bigint.h"
+#include "sysc/datatypes/int/sc_biguint.h"
+
+
+namespace sc_dt
+{
+
+// classes defined in this module
+class sc_nbexpr_acc;
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_nbexpr_acc
+//
+//  Accumulator of the terms of an expression in the digits of an
+//  sc_signed or sc_unsigned, in 2's complement.
+// ----------------------------------------------------------------------------
+
+class sc_nbexpr_acc
+{
+public:
+
+    // Start with zero in the digits of a.
+
+    explicit sc_nbexpr_acc( sc_signed& a )
+	: m_nd( a.ndigits ), m_d( a.digit )
+	{ vec_zero( m_nd, m_d ); }
+
+    explicit sc_nbexpr_acc( sc_unsigned& a )
+	: m_nd( a.ndigits ), m_d( a.digit )
+	{ vec_zero( m_nd, m_d ); }
+
+
+    // Add a, or subtract it if negate is true.
+
+    template <class A>
+    void add( const A& a, bool negate )
+	{
+	    static const sc_digit one = 1;
+	    add_product( a.sgn, a.ndigits, a.digit, SC_POS, 1, &one, negate );
+	}
+
+    // Add a * b, or subtract it if negate is true.
+
+    template <class A, class B>
+    void add_product( const A& a, const B& b, bool negate )
+	{
+	    add_product( a.sgn, a.ndigits, a.digit,
+			 b.sgn, b.ndigits, b.digit, negate );
+	}
+
+
+    // Convert the sum in the digits of a to sign-magnitude, wrapping it
+    // around to the width of a.
+
+    static void finish( sc_signed& a )
+	{ a.sgn = convert_signed_2C_to_SM( a.nbits, a.ndigits, a.digit ); }
+
+    static void finish( sc_unsigned& a )
+	{ a.sgn = convert_unsigned_2C_to_SM( a.nbits, a.ndigits, a.digit ); }
+
+private:
+
+    void add_product( small_type as, int an, const sc_digit* ad,
+		      small_type bs, int bn, const sc_digit* bd,
+		      bool negate )
+	{
+	    if( as == SC_ZERO || bs == SC_ZERO )
+		return;
+	    vec_mac_on( vec_skip_leading_zeros( an, ad ), ad,
+			vec_skip_leading_zeros( bn, bd ), bd,
+			m_nd, m_d, negate != ( mul_signs( as, bs ) == SC_NEG ) );
+	}
+
+private:
+
+    int       m_nd;
+    sc_digit* m_d;
+};
+
+
+// ----------------------------------------------------------------------------
+//  Operands of the operators: sc_bigint<W> and sc_biguint<W>. width is
+//  the number of bits of the signed (2's complement) or unsigned value,
+//  swidth the number of bits of a signed value that holds it.
+// ----------------------------------------------------------------------------
+
+template <class T>
+struct sc_nbexpr_traits
+{ static const bool is_operand = false; };
+
+template <int W>
+struct sc_nbexpr_traits< sc_bigint<W> >
+{
+    static const bool is_operand = true;
+    static const bool is_signed = true;
+    static const int  width = W;
+    static const int  swidth = W;
+};
+
+template <int W>
+struct sc_nbexpr_traits< sc_biguint<W> >
+{
+    static const bool is_operand = true;
+    static const bool is_signed = false;
+    static const int  width = W;
+    static const int  swidth = W + 1;
+};
+
+
+// the type that holds every value of a result
+
+template <bool S, int W>
+struct sc_nbexpr_result
+{ typedef sc_bigint<W> type; };
+
+template <int W>
+struct sc_nbexpr_result<false,W>
+{ typedef sc_biguint<W> type; };
+
+
+// the types of the results of l + r, l - r and l * r
+
+template <class L, class R>
+struct sc_nbexpr_add_format
+{
+    typedef sc_nbexpr_traits<L> l_traits;
+    typedef sc_nbexpr_traits<R> r_traits;
+
+    static const bool is_signed = l_traits::is_signed || r_traits::is_signed;
+    static const int  width = is_signed
+	? ( l_traits::swidth > r_traits::swidth ? l_traits::swidth
+						: r_traits::swidth ) + 1
+	: ( l_traits::width > r_traits::width ? l_traits::width
+					      : r_traits::width ) + 1;
+    typedef typename sc_nbexpr_result<is_signed,width>::type result_type;
+};
+
+template <class L, class R>
+struct sc_nbexpr_sub_format
+{
+    typedef sc_nbexpr_traits<L> l_traits;
+    typedef sc_nbexpr_traits<R> r_traits;
+
+    static const bool is_signed = true;
+    static const int  width = ( l_traits::swidth > r_traits::swidth
+				? l_traits::swidth : r_traits::swidth ) + 1;
+    typedef typename sc_nbexpr_result<is_signed,width>::type result_type;
+};
+
+template <class L, class R>
+struct sc_nbexpr_mul_format
+{
+    typedef sc_nbexpr_traits<L> l_traits;
+    typedef sc_nbexpr_traits<R> r_traits;
+
+    static const bool is_signed = l_traits::is_signed || r_traits::is_signed;
+    static const int  width = is_signed
+	? l_traits::swidth + r_traits::swidth
+	: l_traits::width + r_traits::width;
+    typedef typename sc_nbexpr_result<is_signed,width>::type result_type;
+};
+
+// the result type of an operator, if both operands are sc_bigint<W> or
+// sc_biguint<W>; other operand types do not match and use the operators
+// of sc_signed and sc_unsigned
+
+template <bool B, class L, class R, template <class,class> class F>
+struct sc_nbexpr_enable_if
+{};
+
+template <class L, class R, template <class,class> class F>
+struct sc_nbexpr_enable_if<true,L,R,F>
+{ typedef typename F<L,R>::result_type type; };
+
+template <class L, class R, template <class,class> class F>
+struct sc_nbexpr_enable
+    : public sc_nbexpr_enable_if< sc_nbexpr_traits<L>::is_operand &&
+				  sc_nbexpr_traits<R>::is_operand, L, R, F >
+{};
+
+
+// ----------------------------------------------------------------------------
+//  Operators
+// ----------------------------------------------------------------------------
+
+template <class L, class R>
+inline
+typename sc_nbexpr_enable<L,R,sc_nbexpr_add_format>::type
+operator + ( const L& l, const R& r )
+{
+    typename sc_nbexpr_add_format<L,R>::result_type w;
+    sc_nbexpr_acc acc( w );
+    acc.add( l, false );
+    acc.add( r, false );
+    sc_nbexpr_acc::finish( w );
+    return w;
+}
+
+template <class L, class R>
+inline
+typename sc_nbexpr_enable<L,R,sc_nbexpr_sub_format>::type
+operator - ( const L& l, const R& r )
+{
+    typename sc_nbexpr_sub_format<L,R>::result_type w;
+    sc_nbexpr_acc acc( w );
+    acc.add( l, false );
+    acc.add( r, true );
+    sc_nbexpr_acc::finish( w );
+    return w;
+}
+
+template <class L, class R>
+inline
+typename sc_nbexpr_enable<L,R,sc_nbexpr_mul_format>::type
+operator * ( const L& l, const R& r )
+{
+    typename sc_nbexpr_mul_format<L,R>::result_type w;
+    sc_nbexpr_acc acc( w );
+    acc.add_product( l, r, false );
+    sc_nbexpr_acc::finish( w );
+    return w;
+}
+
+} // namespace sc_dt
+
+
+#endif
@@ -58,6 +58,12 @@
 namespace sc_dt
 {
 
+#ifndef SC_MAX_NBITS
+// Products of up to this many digits are formed on the stack by
+// mul_on_help_signed/unsigned (the digits of two 960-bit operands).
+static const int MUL_ON_STACK_DIGITS = 64;
+#endif
+
 // ----------------------------------------------------------------------------
 //  SECTION: External functions for PLUS operators.
 // ----------------------------------------------------------------------------
@@ -170,7 +176,8 @@ mul_on_help_signed(small_type &us,
 #ifdef SC_MAX_NBITS
     sc_digit d[MAX_NDIGITS];
 #else
-    auto *d = new sc_digit[nd];
+    sc_digit small_d[MUL_ON_STACK_DIGITS];
+    sc_digit *d = (nd <= MUL_ON_STACK_DIGITS) ? small_d : vec_new(nd);
 #endif
   
     vec_zero(nd, d);
@@ -190,7 +197,8 @@ mul_on_help_signed(small_type &us,
     COPY_DIGITS(us, unb, old_und, ud, unb + vnb, nd, d);
     
 #ifndef SC_MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      delete [] d;
 #endif
     
   }
@@ -245,7 +253,8 @@ mul_on_help_unsigned(small_type &us,
 #ifdef SC_MAX_NBITS
     sc_digit d[MAX_NDIGITS];
 #else
-    auto *d = new sc_digit[nd];
+    sc_digit small_d[MUL_ON_STACK_DIGITS];
+    sc_digit *d = (nd <= MUL_ON_STACK_DIGITS) ? small_d : vec_new(nd);
 #endif
   
     vec_zero(nd, d);
@@ -265,7 +274,8 @@ mul_on_help_unsigned(small_type &us,
     COPY_DIGITS(us, unb, old_und, ud, unb + vnb, nd, d);
     
 #ifndef SC_MAX_NBITS
-    delete [] d;
+    if (d != small_d)
+      delete [] d;
 #endif
     
   }
@@ -318,7 +328,7 @@ div_on_help_signed(small_type &us,
 #ifdef SC_MAX_NBITS
     sc_digit d[MAX_NDIGITS + 1];
 #else
-    auto *d = new sc_digit[nd];
+    auto *d = vec_new(nd);
 #endif
     
     vec_zero(nd, d);
@@ -388,7 +398,7 @@ div_on_help_unsigned(small_type &us,
 #ifdef SC_MAX_NBITS
     sc_digit d[MAX_NDIGITS + 1];
 #else
-    auto *d = new sc_digit[nd];
+    auto *d = vec_new(nd);
 #endif
     
     vec_zero(nd, d);
@@ -470,7 +480,7 @@ mod_on_help_signed(small_type &us,
 #ifdef SC_MAX_NBITS
     sc_digit d[MAX_NDIGITS + 1];
 #else
-    auto *d = new sc_digit[nd];
+    auto *d = vec_new(nd);
 #endif
     
     vec_zero(nd, d);
@@ -548,7 +558,7 @@ mod_on_help_unsigned(small_type &us,
 #ifdef SC_MAX_NBITS
     sc_digit d[MAX_NDIGITS + 1];
 #else
-    auto *d = new sc_digit[nd];
+    auto *d = vec_new(nd);
 #endif
     
     vec_zero(nd, d);
@@ -56,10 +56,13 @@
 // source.
 //
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstdio>
 #include <cstring>
 #include <sstream>
+#include <vector>
 
 #include "sysc/datatypes/int/sc_int_ids.h"
 #include "sysc/datatypes/int/sc_nbutils.h"
@@ -1016,6 +1019,8 @@ vec_sub_small_on(int ulen, sc_digit *u, sc_digit v)
 
 }
 
+#if !defined(SC_ENABLE_WIDE_BIGINT_KERNELS)
+
 // Compute w = u * v, where w, u, and v are vectors.
 void
 vec_mul(int ulen, const sc_digit *u,
@@ -1637,6 +1642,490 @@ vec_rem_on_small(int ulen, sc_digit *u, sc_digit v)
 
 }
 
+#else // SC_ENABLE_WIDE_BIGINT_KERNELS
+
+// ----------------------------------------------------------------------------
+//  Wide kernels for multiplication and division (SC_ENABLE_WIDE_BIGINT_KERNELS)
+//
+//  The digits keep their BITS_PER_DIGIT bits, so the results are the same as
+//  those of the kernels above. But a product of two digits is formed with a
+//  single 64-bit multiplication instead of four half-digit ones, the long
+//  division works on whole digits instead of bytes and long multiplications
+//  are split with the Karatsuba method.
+// ----------------------------------------------------------------------------
+
+// Operands with at least this many digits are multiplied with the Karatsuba
+// method, below it the schoolbook method is faster.
+static const int SC_KARATSUBA_THRESHOLD = 32;
+
+// w += u * v, where w has at least ulen + vlen digits.
+static void
+vec_mul_school(int ulen, const sc_digit *u,
+               int vlen, const sc_digit *v,
+               sc_digit *w)
+{
+  for (int i = 0; i < ulen; ++i) {
+    const uint64 ui = u[i];
+    if (ui == 0)
+      continue;
+    uint64 carry = 0;
+    sc_digit *wi = w + i;
+    for (int j = 0; j < vlen; ++j) {
+      // ui * v[j] + wi[j] + carry < DIGIT_RADIX^2
+      uint64 t = ui * v[j] + wi[j] + carry;
+      wi[j] = (sc_digit)(t & DIGIT_MASK);
+      carry = t >> BITS_PER_DIGIT;
+    }
+    for (int j = vlen; carry != 0; ++j) {
+      uint64 t = wi[j] + carry;
+      wi[j] = (sc_digit)(t & DIGIT_MASK);
+      carry = t >> BITS_PER_DIGIT;
+    }
+  }
+}
+
+// w += u, returns the carry out of the wlen digits of w.
+static sc_digit
+vec_add_to(int wlen, sc_digit *w, int ulen, const sc_digit *u)
+{
+  sc_digit carry = 0;
+  int i = 0;
+  for (; i < ulen; ++i) {
+    carry += w[i] + u[i];
+    w[i] = carry & DIGIT_MASK;
+    carry >>= BITS_PER_DIGIT;
+  }
+  for (; carry != 0 && i < wlen; ++i) {
+    carry += w[i];
+    w[i] = carry & DIGIT_MASK;
+    carry >>= BITS_PER_DIGIT;
+  }
+  return carry;
+}
+
+// w -= u, where w >= u.
+static void
+vec_sub_from(int wlen, sc_digit *w, int ulen, const sc_digit *u)
+{
+  sc_digit borrow = 0;
+  int i = 0;
+  for (; i < ulen; ++i) {
+    sc_digit d = (w[i] + DIGIT_RADIX) - u[i] - borrow;
+    w[i] = d & DIGIT_MASK;
+    borrow = 1 - (d >> BITS_PER_DIGIT);
+  }
+  for (; borrow != 0 && i < wlen; ++i) {
+    sc_digit d = (w[i] + DIGIT_RADIX) - borrow;
+    w[i] = d & DIGIT_MASK;
+    borrow = 1 - (d >> BITS_PER_DIGIT);
+  }
+}
+
+// w = u * v, where u and v have n digits and w has 2 * n zeroed digits.
+static void
+vec_mul_karatsuba(int n, const sc_digit *u, const sc_digit *v, sc_digit *w)
+{
+  if (n < SC_KARATSUBA_THRESHOLD) {
+    vec_mul_school(n, u, n, v, w);
+    return;
+  }
+
+  // u = u1 * x + u0 and v = v1 * x + v0 with x = DIGIT_RADIX^m. Then
+  // u * v = z2 * x^2 + z1 * x + z0 with z0 = u0 * v0, z2 = u1 * v1 and
+  // z1 = (u0 + u1) * (v0 + v1) - z0 - z2.
+
+  const int m = n / 2;
+  const int h = n - m;
+
+  std::vector<sc_digit> s(4 * (h + 1), 0);
+  sc_digit *su = &s[0];          // u0 + u1, h + 1 digits
+  sc_digit *sv = su + (h + 1);   // v0 + v1, h + 1 digits
+  sc_digit *z1 = sv + (h + 1);   // 2 * (h + 1) digits
+
+  vec_copy(h, su, u + m);
+  su[h] = vec_add_to(h, su, m, u);
+  vec_copy(h, sv, v + m);
+  sv[h] = vec_add_to(h, sv, m, v);
+
+  vec_mul_karatsuba(m, u, v, w);                   // z0 -> w[0, 2m)
+  vec_mul_karatsuba(h, u + m, v + m, w + 2 * m);   // z2 -> w[2m, 2n)
+  vec_mul_karatsuba(h + 1, su, sv, z1);
+
+  vec_sub_from(2 * (h + 1), z1, 2 * m, w);
+  vec_sub_from(2 * (h + 1), z1, 2 * h, w + 2 * m);
+
+  // z1 < DIGIT_RADIX^(2h+1), its top digit is zero
+  vec_add_to(2 * n - m, w + m, 2 * h + 1, z1);
+}
+
+// Compute w = u * v, where w, u, and v are vectors.
+// - w has ulen + vlen digits that are zero on entry.
+void
+vec_mul(int ulen, const sc_digit *u,
+        int vlen, const sc_digit *v,
+        sc_digit *w)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert((vlen > 0) && (v != NULL));
+  sc_assert(w != NULL);
+#endif
+
+  if (ulen < vlen) {
+    std::swap(ulen, vlen);
+    std::swap(u, v);
+  }
+
+  if (vlen < SC_KARATSUBA_THRESHOLD) {
+    vec_mul_school(ulen, u, vlen, v, w);
+    return;
+  }
+
+  // Multiply slices of u with the length of v, and add up the products.
+  std::vector<sc_digit> p(2 * vlen);
+  for (int i = 0; i < ulen; i += vlen) {
+    int n = sc_min(vlen, ulen - i);
+    std::fill(p.begin(), p.end(), 0);
+    if (n == vlen)
+      vec_mul_karatsuba(vlen, u + i, v, &p[0]);
+    else
+      vec_mul(vlen, v, n, u + i, &p[0]);
+    vec_add_to(ulen + vlen - i, w + i, n + vlen, &p[0]);
+  }
+}
+
+// Compute w = u * v, where w and u are vectors, and v is a scalar.
+// - 0 < v < HALF_DIGIT_RADIX.
+void
+vec_mul_small(int ulen, const sc_digit *u,
+              sc_digit v, sc_digit *w)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert(w != NULL);
+  sc_assert((0 < v) && (v < HALF_DIGIT_RADIX));
+#endif
+
+  uint64 carry = 0;
+  for (int i = 0; i < ulen; ++i) {
+    uint64 t = (uint64)u[i] * v + carry;
+    w[i] = (sc_digit)(t & DIGIT_MASK);
+    carry = t >> BITS_PER_DIGIT;
+  }
+  w[ulen] = (sc_digit)carry;
+}
+
+// Compute u = u * v, where u is a vector, and v is a scalar.
+// - 0 < v < HALF_DIGIT_RADIX.
+void
+vec_mul_small_on(int ulen, sc_digit *u, sc_digit v)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert((0 < v) && (v < HALF_DIGIT_RADIX));
+#endif
+
+  uint64 carry = 0;
+  for (int i = 0; i < ulen; ++i) {
+    uint64 t = (uint64)u[i] * v + carry;
+    u[i] = (sc_digit)(t & DIGIT_MASK);
+    carry = t >> BITS_PER_DIGIT;
+  }
+
+#ifdef DEBUG_SYSTEMC
+  if( carry != 0 ) {
+      SC_REPORT_WARNING( sc_core::SC_ID_WITHOUT_MESSAGE_,
+                         "vec_mul_small_on( int, sc_digit*, unsigned "
+			 "long ) : "
+			 "result of multiplication is wrapped around" );
+  }
+#endif
+}
+
+// q = u / v, where v is a single digit. Returns the remainder, q may be u.
+static sc_digit
+vec_div_digit(int ulen, const sc_digit *u, sc_digit v, sc_digit *q)
+{
+  uint64 r = 0;
+  for (int i = ulen - 1; i >= 0; --i) {
+    uint64 num = (r << BITS_PER_DIGIT) | u[i];
+    q[i] = (sc_digit)(num / v);
+    r = num % v;
+  }
+  return (sc_digit)r;
+}
+
+// Long division of u by v (Knuth, TAOCP vol. 2, 4.3.1, algorithm D) in
+// DIGIT_RADIX. The quotient is stored in q (ulen digits, if q is not null)
+// and the remainder in r (ulen digits, if r is not null).
+// - v has at least two digits and no leading zero digit.
+static void
+vec_div_knuth(int ulen, const sc_digit *u,
+              int vlen, const sc_digit *v,
+              sc_digit *q, sc_digit *r)
+{
+  if (q)
+    vec_zero(ulen, q);
+  if (r)
+    vec_zero(ulen, r);
+
+  ulen = vec_skip_leading_zeros(ulen, u);
+  if (ulen < vlen) {    // u < v
+    if (r)
+      vec_copy(ulen, r, u);
+    return;
+  }
+
+#ifdef SC_MAX_NBITS
+  sc_digit un[MAX_NDIGITS + 1];
+  sc_digit vn[MAX_NDIGITS];
+#else
+  auto *un = vec_new(ulen + 1);
+  auto *vn = vec_new(vlen);
+#endif
+
+  // Normalize, so that the top bit of the top digit of v is set.
+  int s = 0;
+  while ((v[vlen - 1] << s) < (DIGIT_RADIX >> 1))
+    ++s;
+
+  sc_digit carry = 0;
+  for (int i = 0; i < vlen; ++i) {
+    sc_digit d = (v[i] << s) | carry;
+    vn[i] = d & DIGIT_MASK;
+    carry = v[i] >> (BITS_PER_DIGIT - s);
+  }
+  carry = 0;
+  for (int i = 0; i < ulen; ++i) {
+    sc_digit d = (u[i] << s) | carry;
+    un[i] = d & DIGIT_MASK;
+    carry = u[i] >> (BITS_PER_DIGIT - s);
+  }
+  un[ulen] = carry;
+
+  const uint64 vtop = vn[vlen - 1];
+  const uint64 vnext = vn[vlen - 2];
+
+  for (int j = ulen - vlen; j >= 0; --j) {
+
+    // Estimate the quotient digit from the top two digits of the
+    // remainder, the estimate is at most one too large.
+    uint64 num = ((uint64)un[j + vlen] << BITS_PER_DIGIT) | un[j + vlen - 1];
+    uint64 qhat = num / vtop;
+    uint64 rhat = num % vtop;
+    while (qhat >= DIGIT_RADIX ||
+           qhat * vnext > ((rhat << BITS_PER_DIGIT) | un[j + vlen - 2])) {
+      --qhat;
+      rhat += vtop;
+      if (rhat >= DIGIT_RADIX)
+        break;
+    }
+
+    // un[j, j + vlen] -= qhat * vn
+    int64 borrow = 0;
+    uint64 pcarry = 0;
+    for (int i = 0; i < vlen; ++i) {
+      uint64 p = qhat * vn[i] + pcarry;
+      pcarry = p >> BITS_PER_DIGIT;
+      int64 t = (int64)un[i + j] - (int64)(p & DIGIT_MASK) + borrow;
+      un[i + j] = (sc_digit)(t & DIGIT_MASK);
+      borrow = t >> BITS_PER_DIGIT;
+    }
+    int64 t = (int64)un[j + vlen] - (int64)pcarry + borrow;
+    un[j + vlen] = (sc_digit)(t & DIGIT_MASK);
+
+    if (t < 0) {
+      // qhat was one too large, add v back.
+      --qhat;
+      vec_add_to(vlen, un + j, vlen, vn);
+      un[j + vlen] = 0;
+    }
+
+    if (q)
+      q[j] = (sc_digit)qhat;
+  }
+
+  if (r) {
+    // Denormalize the remainder.
+    for (int i = 0; i < vlen; ++i) {
+      sc_digit d = un[i] >> s;
+      if (s && i + 1 < vlen)
+        d |= (un[i + 1] << (BITS_PER_DIGIT - s)) & DIGIT_MASK;
+      r[i] = d;
+    }
+  }
+
+#ifndef SC_MAX_NBITS
+  delete [] un;
+  delete [] vn;
+#endif
+}
+
+// Compute w = u / v, where w, u, and v are vectors.
+// - w has at least ulen digits.
+void
+vec_div_large(int ulen, const sc_digit *u,
+              int vlen, const sc_digit *v,
+              sc_digit *w)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert((vlen > 0) && (v != NULL));
+  sc_assert(w != NULL);
+#endif
+
+  vlen = vec_skip_leading_zeros(vlen, v);
+
+  if (vlen == 1) {
+    vec_div_digit(ulen, u, v[0], w);
+    return;
+  }
+
+  vec_div_knuth(ulen, u, vlen, v, w, 0);
+}
+
+// Compute w = u / v, where u and w are vectors, and v is a scalar.
+// - 0 < v < HALF_DIGIT_RADIX. Below, we rename w to q.
+void
+vec_div_small(int ulen, const sc_digit *u,
+              sc_digit v, sc_digit *q)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert(q != NULL);
+  sc_assert((0 < v) && (v < HALF_DIGIT_RADIX));
+#endif
+
+  vec_div_digit(ulen, u, v, q);
+}
+
+// Compute w = u % v, where w, u, and v are vectors.
+// - w has at least ulen digits.
+void
+vec_rem_large(int ulen, const sc_digit *u,
+              int vlen, const sc_digit *v,
+              sc_digit *w)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert((vlen > 0) && (v != NULL));
+  sc_assert(w != NULL);
+#endif
+
+  vlen = vec_skip_leading_zeros(vlen, v);
+
+  if (vlen == 1) {
+    vec_zero(ulen, w);
+    uint64 r = 0;
+    for (int i = ulen - 1; i >= 0; --i)
+      r = ((r << BITS_PER_DIGIT) | u[i]) % v[0];
+    w[0] = (sc_digit)r;
+    return;
+  }
+
+  vec_div_knuth(ulen, u, vlen, v, 0, w);
+}
+
+// Compute r = u % v, where u is a vector, and r and v are scalars.
+// - 0 < v < HALF_DIGIT_RADIX.
+// - The remainder r is returned.
+sc_digit
+vec_rem_small(int ulen, const sc_digit *u, sc_digit v)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert((0 < v) && (v < HALF_DIGIT_RADIX));
+#endif
+
+  uint64 r = 0;
+  for (int i = ulen - 1; i >= 0; --i)
+    r = ((r << BITS_PER_DIGIT) | u[i]) % v;
+  return (sc_digit)r;
+}
+
+// u = u / v, r = u % v.
+sc_digit
+vec_rem_on_small(int ulen, sc_digit *u, sc_digit v)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert(v > 0);
+#endif
+
+  return vec_div_digit(ulen, u, v, u);
+}
+
+#endif // SC_ENABLE_WIDE_BIGINT_KERNELS
+
+// Compute w += u * v, or w -= u * v if negate is true, modulo
+// DIGIT_RADIX^wlen, where w is in 2's complement representation.
+// - u and v are magnitudes; w may be shorter than the product.
+void
+vec_mac_on(int ulen, const sc_digit *u,
+           int vlen, const sc_digit *v,
+           int wlen, sc_digit *w, bool negate)
+{
+
+#ifdef DEBUG_SYSTEMC
+  sc_assert((ulen > 0) && (u != NULL));
+  sc_assert((vlen > 0) && (v != NULL));
+  sc_assert((wlen > 0) && (w != NULL));
+#endif
+
+  const int64 sign = negate ? -1 : 1;
+
+  for (int i = 0; i < ulen && i < wlen; ++i) {
+
+    if (u[i] == 0)
+      continue;
+
+    // |carry| <= DIGIT_RADIX, so that w + sign * u * v + carry never
+    // overflows an int64; the shifts of a negative carry are arithmetic.
+    sc_digit *wi = w + i;
+    int n = sc_min(vlen, wlen - i);
+    int64 carry = 0;
+
+    for (int j = 0; j < n; ++j) {
+      carry += (int64) wi[j] + sign * (int64) ((uint64) u[i] * v[j]);
+      wi[j] = (sc_digit) (carry & DIGIT_MASK);
+      carry >>= BITS_PER_DIGIT;
+    }
+
+    for (int j = n; (carry != 0) && (j < wlen - i); ++j) {
+      carry += (int64) wi[j];
+      wi[j] = (sc_digit) (carry & DIGIT_MASK);
+      carry >>= BITS_PER_DIGIT;
+    }
+
+  }
+
+}
+
+static std::atomic<uint64> vec_new_counter(0);
+
+// Allocate n digits, counting the allocation.
+sc_digit *
+vec_new(int n)
+{
+  vec_new_counter.fetch_add(1, std::memory_order_relaxed);
+  return new sc_digit[n];
+}
+
+// Return the number of vec_new() calls so far.
+uint64
+vec_new_count()
+{
+  return vec_new_counter.load(std::memory_order_relaxed);
+}
+
 // Set (uchar) v = (sc_digit) u. Return the new vlen.
 int
 vec_to_char(int ulen, const sc_digit *u,
@@ -1883,7 +2372,7 @@ vec_reverse(int unb, int und, sc_digit *ud,
 #ifdef SC_MAX_NBITS
   sc_digit d[MAX_NDIGITS];
 #else
-  auto *d = new sc_digit[und];
+  auto *d = vec_new(und);
 #endif
 
   // d is a copy of ud.
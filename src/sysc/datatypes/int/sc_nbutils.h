@@ -171,6 +171,22 @@ vec_from_str(int unb, int und, sc_digit *u,
 //    Xlen             : the number of digits in X.
 // ----------------------------------------------------------------------------
 
+// ----------------------------------------------------------------------------
+//  Allocation of digit vectors on the heap: vec_new(n) returns a vector
+//  of n digits to be deleted with delete [], and vec_new_count() the
+//  number of vectors sc_signed, sc_unsigned and their operators have
+//  allocated so far, to measure the temporaries of an expression.
+// ----------------------------------------------------------------------------
+
+extern
+SC_API sc_digit *
+vec_new(int n);
+
+extern
+SC_API uint64
+vec_new_count();
+
+
 // ----------------------------------------------------------------------------
 //  Functions for vector addition: w = u + v or u += v.
 // ----------------------------------------------------------------------------
@@ -247,6 +263,12 @@ extern
 SC_API void
 vec_mul_small_on(int ulen, sc_digit *u, sc_digit v);
 
+extern
+SC_API void
+vec_mac_on(int ulen, const sc_digit *u,
+           int vlen, const sc_digit *v,
+           int wlen, sc_digit *w, bool negate);
+
 
 // ----------------------------------------------------------------------------
 //  Functions for vector division: w = u / v.
@@ -115,6 +115,7 @@ class sc_concatref;
 class sc_signed;
 
 // forward class declarations
+class sc_nbexpr_acc;
 class sc_bv_base;
 class sc_lv_base;
 class sc_int_base;
@@ -1101,6 +1102,7 @@ class SC_API sc_signed : public sc_value_base
     friend class sc_signed_subref;
     friend class sc_unsigned;
     friend class sc_unsigned_subref;
+    friend class sc_nbexpr_acc;
 
     // Needed for types using sc_signed.
     typedef bool elemtype;
@@ -2166,6 +2168,19 @@ public:
                                      int vnd,
                                      const sc_digit *vd);
 
+protected:
+
+  // Create a number with nb bits whose DIV_CEIL(nb) digits are kept in the
+  // given storage, which must stay valid as long as the number does
+  // (see sc_bigint<W>).
+  sc_signed( int nb, sc_digit* digits_p );
+
+#ifndef SC_MAX_NBITS
+  // Detach the storage given to the constructor above.
+  void release_digits()
+    { digit = 0; }
+#endif
+
 private:
 
   small_type  sgn;         // Shortened as s.
@@ -2359,7 +2374,7 @@ sc_signed::sc_signed( const sc_generic_base<T>& v )
 #   ifdef SC_MAX_NBITS
         test_bound(nb);
 #    else
-        digit = new sc_digit[ndigits];
+        digit = vec_new(ndigits);
 #    endif
     makezero();
     v->to_sc_signed(*this);
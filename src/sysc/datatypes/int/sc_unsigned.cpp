@@ -2044,7 +2044,7 @@ compare_unsigned(small_type us,
 #ifdef SC_MAX_NBITS
     sc_digit d[MAX_NDIGITS];
 #else
-    auto *d = new sc_digit[nd];
+    auto *d = vec_new(nd);
 #endif
 
     if (us == SC_NEG) {
@@ -2090,7 +2090,7 @@ sc_unsigned::iszero() const
 #ifdef SC_MAX_NBITS
     sc_digit d[MAX_NDIGITS];
 #else
-    auto *d = new sc_digit[ndigits];
+    auto *d = vec_new(ndigits);
 #endif
 
     vec_copy(ndigits, d, digit);
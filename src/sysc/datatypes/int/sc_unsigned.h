@@ -122,6 +122,7 @@ class sc_concatref;
 class sc_unsigned;
 
 // forward class declarations
+class sc_nbexpr_acc;
 class sc_bv_base;
 class sc_lv_base;
 class sc_int_base;
@@ -1004,6 +1005,7 @@ class SC_API sc_unsigned : public sc_value_base
     friend class sc_signed;
     friend class sc_signed_subref;
     friend class sc_signed_subref_r;
+    friend class sc_nbexpr_acc;
 
     // Needed for types using sc_unsigned.
     typedef bool elemtype;
@@ -1957,6 +1959,19 @@ public:
 public:
   static sc_core::sc_vpool<sc_unsigned> m_pool;
 
+protected:
+
+  // Create a number with nb bits whose DIV_CEIL(nb + 1) digits are
+  // kept in the given storage, which must stay valid as long as the
+  // number does (see sc_biguint<W>).
+  sc_unsigned( int nb, sc_digit* digits_p );
+
+#ifndef SC_MAX_NBITS
+  // Detach the storage given to the constructor above.
+  void release_digits()
+    { digit = 0; }
+#endif
+
 private:
 
   small_type  sgn;         // Shortened as s.
@@ -2171,7 +2186,7 @@ sc_unsigned::sc_unsigned( const sc_generic_base<T>& v )
 #   ifdef SC_MAX_NBITS
         test_bound(nb);
 #    else
-        digit = new sc_digit[ndigits];
+        digit = vec_new(ndigits);
 #    endif
     makezero();
     v->to_sc_unsigned(*this);
@@ -98,6 +98,7 @@
 //   201103L (C++11, ISO/IEC 14882:2011)
 //   201402L (C++14, ISO/IEC 14882:2014)
 //   201703L (C++17, ISO/IEC 14882:2017)
+//   202002L (C++20, ISO/IEC 14882:2020)
 //
 // This macro can be used inside the library sources to make certain assumptions
 // on the available features in the underlying C++ implementation.
@@ -183,6 +183,24 @@ sc_cor_pkg_fiber::get_main()
     return &main_cor;
 }
 
+// the stacks are managed by the fiber package, they are not pooled
+
+SC_API void
+sc_set_stack_pool_limit( std::size_t )
+{}
+
+SC_API std::size_t
+sc_get_stack_pool_limit()
+{
+    return 0;
+}
+
+SC_API sc_stack_pool_stats
+sc_get_stack_pool_stats()
+{
+    return sc_stack_pool_stats();
+}
+
 } // namespace sc_core
 
 
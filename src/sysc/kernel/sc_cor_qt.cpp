@@ -35,6 +35,9 @@
 #include <cstring>
 #include <cstdlib>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "sysc/kernel/sc_cor_qt.h"
 #include "sysc/kernel/sc_simcontext.h"
@@ -73,59 +76,91 @@ static std::size_t sc_pagesize()
 }
 
 // ----------------------------------------------------------------------------
-//  CLASS : sc_cor_qt
+//  CLASS : sc_cor_qt_stack_pool
 //
-//  Coroutine class implemented with QuickThreads.
+//  Pool of coroutine stacks. Each stack is mapped with an additional red
+//  zone page, which is protected once when the stack is mapped. The pages
+//  of the stack are committed by the system when they are first touched.
+//  The stacks of deleted coroutines are kept per size for reuse, until the
+//  pooled stacks exceed the pool limit.
 // ----------------------------------------------------------------------------
 
-sc_cor_qt::~sc_cor_qt()
+class sc_cor_qt_stack_pool
 {
-    std::free( m_stack );
-}
+public:
 
-// switch stack protection on/off
+    sc_cor_qt_stack_pool()
+      : m_limit( 64 * 1024 * 1024 ), m_free(), m_in_use(), m_stats()
+      , m_releases( 0 )
+      {}
 
-void
-sc_cor_qt::stack_protect( bool enable )
+    void* acquire( std::size_t stack_size );
+    void  release( void* stack, std::size_t stack_size );
+
+    void        set_limit( std::size_t bytes );
+    std::size_t limit() const { return m_limit; }
+
+    const sc_stack_pool_stats& sample();
+    void                       start_over();
+
+private:
+
+    void* map( std::size_t stack_size );
+    void  unmap( void* stack, std::size_t stack_size );
+
+    std::size_t resident( void* stack, std::size_t stack_size ) const;
+
+private:
+
+    typedef std::pair< std::size_t, std::vector<void*> > size_class;
+
+    std::size_t                             m_limit;
+    std::vector<size_class>                 m_free;   // pooled stacks.
+    std::unordered_map<void*, std::size_t>  m_in_use; // stack -> size.
+    sc_stack_pool_stats                     m_stats;
+    std::size_t                             m_releases; // since sample().
+};
+
+// the pool may be used during static destruction, so it is never deleted
+
+static sc_cor_qt_stack_pool& stack_pool()
 {
-    // Code needs to be tested on HP-UX and disabled if it doesn't work there
-    // Code still needs to be ported to WIN32
+    static auto* pool_p = new sc_cor_qt_stack_pool;
+    return *pool_p;
+}
 
+void*
+sc_cor_qt_stack_pool::map( std::size_t stack_size )
+{
     const std::size_t pagesize = sc_pagesize();
-    sc_assert( m_stack_size > ( 2 * pagesize ) );
 
-    auto sp_addr = reinterpret_cast<std::size_t>(m_stack);
-#ifndef SC_HAVE_POSIX_MEMALIGN
-    const std::size_t round_up_mask = pagesize - 1;
-    if( sp_addr & round_up_mask ) { // misaligned allocation
-        sp_addr = (sp_addr + round_up_mask) & ~round_up_mask;
+    int flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+#ifdef MAP_STACK
+    flags |= MAP_STACK;
+#endif
+    void* addr = mmap( nullptr, stack_size + pagesize,
+                       PROT_READ | PROT_WRITE, flags, -1, 0 );
+    if( addr == MAP_FAILED ) {
+        return nullptr;
     }
-#endif // SC_HAVE_POSIX_MEMALIGN
 
 #ifdef QUICKTHREADS_GROW_DOWN
     // Stacks grow from high address down to low address
-    auto redzone = caddr_t( sp_addr );
+    caddr_t redzone = caddr_t( addr );
+    void*   stack   = caddr_t( addr ) + pagesize;
 #else
     // Stacks grow from low address up to high address
-    caddr_t redzone = caddr_t( sp_addr + m_stack_size - pagesize );
+    caddr_t redzone = caddr_t( addr ) + stack_size;
+    void*   stack   = addr;
 #endif
 
-    int ret;
-
-    // Enable the red zone at the end of the stack so that references within
-    // it will cause an interrupt.
-
-    if( enable ) {
-        ret = mprotect( redzone, pagesize - 1, PROT_NONE );
-    }
+    // References within the red zone at the end of the stack cause an
+    // interrupt.
 
-    // Revert the red zone to normal memory usage.
-
-    else {
-        ret = mprotect( redzone, pagesize - 1, PROT_READ | PROT_WRITE );
-    }
-
-    if( ret != 0 ) // ignore mprotect error with warning
+    if( mprotect( redzone, pagesize, PROT_NONE ) != 0 ) // ignore with warning
     {
         static bool mprotect_fail_warned_once = false;
         if( !mprotect_fail_warned_once )
@@ -136,13 +171,201 @@ sc_cor_qt::stack_protect( bool enable )
             std::stringstream sstr;
             sstr << "unsuccessful stack protection ignored: "
                  << std::strerror(mprotect_errno)
-                 << ", address=0x" << std::hex << redzone
-                 << ", enable=" << std::boolalpha << enable;
+                 << ", address=0x" << std::hex << (void*)redzone;
 
             SC_REPORT_WARNING( SC_ID_STACK_SETUP_FAILED_
                              , sstr.str().c_str() );
         }
     }
+
+    ++m_stats.stacks_mapped;
+    return stack;
+}
+
+void
+sc_cor_qt_stack_pool::unmap( void* stack, std::size_t stack_size )
+{
+    const std::size_t pagesize = sc_pagesize();
+#ifdef QUICKTHREADS_GROW_DOWN
+    munmap( caddr_t( stack ) - pagesize, stack_size + pagesize );
+#else
+    munmap( stack, stack_size + pagesize );
+#endif
+}
+
+std::size_t
+sc_cor_qt_stack_pool::resident( void* stack, std::size_t stack_size ) const
+{
+    const std::size_t pagesize = sc_pagesize();
+#if defined(__APPLE__)
+    std::vector<char>          pages( stack_size / pagesize );
+#else
+    std::vector<unsigned char> pages( stack_size / pagesize );
+#endif
+    if( mincore( stack, stack_size, pages.data() ) != 0 ) {
+        return 0;
+    }
+
+    std::size_t n = 0;
+    for( std::size_t i = 0; i < pages.size(); ++i ) {
+        n += ( pages[i] & 1 );
+    }
+    return n * pagesize;
+}
+
+void*
+sc_cor_qt_stack_pool::acquire( std::size_t stack_size )
+{
+    void* stack = nullptr;
+    for( std::size_t i = 0; i < m_free.size(); ++i ) {
+        if( m_free[i].first == stack_size && !m_free[i].second.empty() ) {
+            stack = m_free[i].second.back();
+            m_free[i].second.pop_back();
+            --m_stats.stacks_pooled;
+            m_stats.pooled_bytes -= stack_size;
+            ++m_stats.stacks_reused;
+            break;
+        }
+    }
+
+    if( stack == nullptr ) {
+        stack = map( stack_size );
+        if( stack == nullptr ) {
+            return nullptr;
+        }
+        m_stats.mapped_bytes += stack_size;
+    }
+
+    m_in_use[stack] = stack_size;
+    if( ++m_stats.stacks_in_use > m_stats.peak_stacks_in_use ) {
+        m_stats.peak_stacks_in_use = m_stats.stacks_in_use;
+    }
+    return stack;
+}
+
+void
+sc_cor_qt_stack_pool::release( void* stack, std::size_t stack_size )
+{
+    // sample the resident memory before it is released, the cost of a
+    // sample is spread across eight times as many releases as there are
+    // stacks
+
+    if( ++m_releases > 8 * ( m_stats.stacks_in_use + m_stats.stacks_pooled ) )
+    {
+        sample();
+    }
+
+    m_in_use.erase( stack );
+    --m_stats.stacks_in_use;
+
+    if( m_stats.pooled_bytes + stack_size > m_limit ) {
+        unmap( stack, stack_size );
+        m_stats.mapped_bytes -= stack_size;
+        return;
+    }
+
+    std::size_t i = 0;
+    while( i < m_free.size() && m_free[i].first != stack_size ) {
+        ++i;
+    }
+    if( i == m_free.size() ) {
+        m_free.push_back( size_class( stack_size, std::vector<void*>() ) );
+    }
+    m_free[i].second.push_back( stack );
+    ++m_stats.stacks_pooled;
+    m_stats.pooled_bytes += stack_size;
+}
+
+void
+sc_cor_qt_stack_pool::set_limit( std::size_t bytes )
+{
+    m_limit = bytes;
+
+    // trim the pool, larger stacks first
+    for( std::size_t i = m_free.size(); m_stats.pooled_bytes > m_limit && i--; )
+    {
+        std::vector<void*>& stacks = m_free[i].second;
+        while( !stacks.empty() && m_stats.pooled_bytes > m_limit ) {
+            unmap( stacks.back(), m_free[i].first );
+            stacks.pop_back();
+            --m_stats.stacks_pooled;
+            m_stats.pooled_bytes -= m_free[i].first;
+            m_stats.mapped_bytes -= m_free[i].first;
+        }
+    }
+}
+
+const sc_stack_pool_stats&
+sc_cor_qt_stack_pool::sample()
+{
+    std::size_t bytes = 0;
+    for( const auto& s : m_in_use ) {
+        bytes += resident( s.first, s.second );
+    }
+    for( const auto& c : m_free ) {
+        for( void* stack : c.second ) {
+            bytes += resident( stack, c.first );
+        }
+    }
+
+    m_releases = 0;
+    m_stats.resident_bytes = bytes;
+    if( bytes > m_stats.peak_resident_bytes ) {
+        m_stats.peak_resident_bytes = bytes;
+    }
+    return m_stats;
+}
+
+void
+sc_cor_qt_stack_pool::start_over()
+{
+    m_stats.stacks_mapped = 0;
+    m_stats.stacks_reused = 0;
+    m_stats.peak_stacks_in_use = m_stats.stacks_in_use;
+    m_stats.resident_bytes = 0;
+    m_stats.peak_resident_bytes = 0;
+}
+
+
+SC_API void
+sc_set_stack_pool_limit( std::size_t bytes )
+{
+    stack_pool().set_limit( bytes );
+}
+
+SC_API std::size_t
+sc_get_stack_pool_limit()
+{
+    return stack_pool().limit();
+}
+
+SC_API sc_stack_pool_stats
+sc_get_stack_pool_stats()
+{
+    return stack_pool().sample();
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_qt
+//
+//  Coroutine class implemented with QuickThreads.
+// ----------------------------------------------------------------------------
+
+sc_cor_qt::~sc_cor_qt()
+{
+    if( m_stack != nullptr ) {
+        stack_pool().release( m_stack, m_stack_size );
+    }
+}
+
+// switch stack protection on/off
+
+void
+sc_cor_qt::stack_protect( bool /* enable */ )
+{
+    // The red zone of a pooled stack stays protected, see
+    // sc_cor_qt_stack_pool.
 }
 
 
@@ -156,7 +379,7 @@ int sc_cor_pkg_qt::instance_count = 0;
 
 // support functions
 
-// allocate aligned stack memory
+// allocate page aligned stack memory from the pool
 static inline void*
 stack_alloc( void** buf, std::size_t* stack_size )
 {
@@ -168,22 +391,8 @@ stack_alloc( void** buf, std::size_t* stack_size )
     // round up to multiple of alignment
     *stack_size = (*stack_size + round_up_mask) & ~round_up_mask;
 
-#ifdef SC_HAVE_POSIX_MEMALIGN
-    if( 0 != posix_memalign( buf, alignment, *stack_size ) ) {
-        *buf = nullptr; // allocation failed
-    }
+    *buf = stack_pool().acquire( *stack_size );
     return *buf;
-#else
-    *buf = std::malloc( *stack_size );
-    std::size_t sp_addr = reinterpret_cast<std::size_t>( *buf );
-    if( sp_addr & round_up_mask ) // misaligned allocation
-    {
-        sc_assert( *stack_size > (alignment * 2) );
-        sp_addr = (sp_addr + round_up_mask) & ~round_up_mask;
-        *stack_size -= alignment;
-    }
-    return reinterpret_cast<void*>( sp_addr );
-#endif
 }
 
 // constructor
@@ -196,6 +405,7 @@ sc_cor_pkg_qt::sc_cor_pkg_qt( sc_simcontext* simc )
         sc_assert( curr_cor == nullptr );
         curr_cor = &main_cor;
     }
+    stack_pool().start_over();
 }
 
 
@@ -203,6 +413,9 @@ sc_cor_pkg_qt::sc_cor_pkg_qt( sc_simcontext* simc )
 
 sc_cor_pkg_qt::~sc_cor_pkg_qt()
 {
+    // the coroutines of the simulation context still exist
+    stack_pool().sample();
+
     if( -- instance_count == 0 ) {
           // cleanup the current coroutine
           curr_cor = nullptr;
@@ -0,0 +1,201 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_coroutine.cpp -- Stackless coroutine processes (C++20).
+
+  CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_coroutine.h"
+
+#ifdef SC_HAS_COROUTINES_
+
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_wait.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coroutine_frame_pool
+//
+//  Frames are rounded up to a multiple of 64 bytes, frames of up to 2 KiB
+//  are kept on the free list of their size class, larger ones use the
+//  global operator new.
+// ----------------------------------------------------------------------------
+
+union sc_coroutine_frame_u
+{
+    sc_coroutine_frame_u* next;
+    char                  dummy[64];
+};
+
+static const std::size_t SC_COROUTINE_FRAME_CLASSES = 32;
+
+static
+sc_coroutine_frame_u* frame_free_list[SC_COROUTINE_FRAME_CLASSES] = {};
+
+void*
+sc_coroutine_frame_pool::allocate( std::size_t size )
+{
+    const int ALLOC_SIZE = 64;
+
+    std::size_t n = ( size + sizeof( sc_coroutine_frame_u ) - 1 ) /
+                    sizeof( sc_coroutine_frame_u );
+    if( n == 0 || n > SC_COROUTINE_FRAME_CLASSES ) {
+        return ::operator new( size );
+    }
+
+    sc_coroutine_frame_u*& free_list = frame_free_list[n - 1];
+    if( free_list == nullptr ) {
+        free_list = (sc_coroutine_frame_u*) malloc( ALLOC_SIZE * n *
+                                                sizeof( sc_coroutine_frame_u ) );
+        if( free_list == nullptr ) {
+            throw std::bad_alloc();
+        }
+        int i = 0;
+        for( ; i < ALLOC_SIZE - 1; ++ i ) {
+            free_list[i * n].next = &free_list[(i + 1) * n];
+        }
+        free_list[i * n].next = nullptr;
+    }
+
+    sc_coroutine_frame_u* q = free_list;
+    free_list = free_list->next;
+    return q;
+}
+
+void
+sc_coroutine_frame_pool::release( void* p, std::size_t size )
+{
+    if( p == nullptr ) {
+        return;
+    }
+
+    std::size_t n = ( size + sizeof( sc_coroutine_frame_u ) - 1 ) /
+                    sizeof( sc_coroutine_frame_u );
+    if( n == 0 || n > SC_COROUTINE_FRAME_CLASSES ) {
+        ::operator delete( p );
+        return;
+    }
+
+    auto* q = reinterpret_cast<sc_coroutine_frame_u*>( p );
+    q->next = frame_free_list[n - 1];
+    frame_free_list[n - 1] = q;
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_co_awaitable
+//
+//  Suspending a coroutine returns from the semantics of its method process,
+//  so waiting is done by setting the next trigger of that method.
+// ----------------------------------------------------------------------------
+
+void
+sc_co_awaitable::await_suspend( std::coroutine_handle<> ) const
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+
+    switch( m_kind ) {
+      case STATIC:
+        next_trigger( simc_p );
+        break;
+      case EVENT:
+        if( m_timeout )
+            next_trigger( m_time, *m_event_p, simc_p );
+        else
+            next_trigger( *m_event_p, simc_p );
+        break;
+      case OR_LIST:
+        if( m_timeout )
+            next_trigger( m_time, *m_or_list_p, simc_p );
+        else
+            next_trigger( *m_or_list_p, simc_p );
+        break;
+      case AND_LIST:
+        if( m_timeout )
+            next_trigger( m_time, *m_and_list_p, simc_p );
+        else
+            next_trigger( *m_and_list_p, simc_p );
+        break;
+      case TIME:
+        next_trigger( m_time, simc_p );
+        break;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coroutine_host
+//
+//  The coroutine is resumed until its next co_await. Once it has returned,
+//  its process is killed like a thread process that exits.
+// ----------------------------------------------------------------------------
+
+void
+sc_coroutine_host::semantics()
+{
+    sc_process_b* proc_p = sc_get_current_process_b();
+    sc_assert( proc_p != nullptr );
+
+    // start over after completion or while in reset
+
+    if( m_coroutine.m_handle.done() ||
+        proc_p->m_throw_status == sc_process_b::THROW_SYNC_RESET ||
+        proc_p->m_throw_status == sc_process_b::THROW_ASYNC_RESET ) {
+        m_coroutine = sc_coroutine(); // return the frame to the pool first
+        m_coroutine = m_body();
+    }
+
+    m_coroutine.m_handle.resume();
+
+    if( m_coroutine.m_handle.done() ) {
+        std::exception_ptr ex = m_coroutine.m_handle.promise().m_exception;
+        if( ex ) {
+            m_coroutine.m_handle.promise().m_exception = nullptr;
+            std::rethrow_exception( ex );
+        }
+        sc_process_handle( proc_p ).kill();
+    }
+}
+
+
+sc_process_handle
+sc_spawn_coroutine( const std::function<sc_coroutine()>& body,
+                    const char* name_p,
+                    const sc_spawn_options* opt_p )
+{
+    sc_coroutine_host* host_p = new sc_coroutine_host( body );
+    return sc_get_curr_simcontext()->create_method_process(
+        name_p ? name_p : sc_gen_unique_name( "coroutine_p" ), true,
+        SC_MAKE_FUNC_PTR( sc_coroutine_host, semantics ), host_p, opt_p );
+}
+
+} // namespace sc_core
+
+#endif // SC_HAS_COROUTINES_
+
+// Taf!
@@ -0,0 +1,328 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_coroutine.h -- Stackless coroutine processes (C++20).
+
+  A coroutine process is written as a member function (or a callable)
+  returning sc_coroutine. It suspends with co_await sc_co_wait(...) instead
+  of calling wait(...):
+
+      sc_coroutine run()
+      {
+          for(;;) {
+              co_await sc_co_wait( clk.posedge_event() );
+              ...
+          }
+      }
+
+      SC_CTOR(top) { SC_COROUTINE(run); }
+
+  The process is executed by a method process, which resumes the coroutine
+  frame directly from the scheduler. A co_await sets the next trigger of
+  the method and suspends the frame, so no stack and no context switch is
+  needed per process. Frames are taken from a pool of size classes.
+
+  The process terminates when the coroutine returns. While one of its
+  reset signals is active, it restarts from the beginning whenever it is
+  triggered.
+
+  CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_COROUTINE_H
+#define SC_COROUTINE_H
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#if SC_CPLUSPLUS >= 202002L && defined(__cpp_impl_coroutine)
+# define SC_HAS_COROUTINES_
+#endif
+
+#ifdef SC_HAS_COROUTINES_
+
+#include "sysc/kernel/sc_process_handle.h"
+#include "sysc/kernel/sc_spawn_options.h"
+#include "sysc/kernel/sc_time.h"
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::function
+#endif
+
+namespace sc_core {
+
+class sc_event;
+class sc_event_and_list;
+class sc_event_or_list;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coroutine_frame_pool
+//
+//  Pool for coroutine frames, with one free list per size class; not MT-Safe.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_coroutine_frame_pool
+{
+public:
+
+    static void* allocate( std::size_t size );
+    static void  release( void* p, std::size_t size );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coroutine
+//
+//  Return type of a coroutine process function.
+// ----------------------------------------------------------------------------
+
+class sc_coroutine
+{
+    friend class sc_coroutine_host;
+
+public:
+
+    struct promise_type
+    {
+        sc_coroutine get_return_object()
+            { return sc_coroutine( handle_type::from_promise( *this ) ); }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept   { return {}; }
+
+        void return_void() {}
+        void unhandled_exception() { m_exception = std::current_exception(); }
+
+        static void* operator new( std::size_t size )
+            { return sc_coroutine_frame_pool::allocate( size ); }
+        static void operator delete( void* p, std::size_t size )
+            { sc_coroutine_frame_pool::release( p, size ); }
+
+        std::exception_ptr m_exception;
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    sc_coroutine( sc_coroutine&& other ) noexcept
+        : m_handle( other.m_handle )
+        { other.m_handle = nullptr; }
+
+    sc_coroutine& operator = ( sc_coroutine&& other ) noexcept
+    {
+        if( this != &other ) {
+            if( m_handle )
+                m_handle.destroy();
+            m_handle = other.m_handle;
+            other.m_handle = nullptr;
+        }
+        return *this;
+    }
+
+    ~sc_coroutine()
+        { if( m_handle ) m_handle.destroy(); }
+
+private:
+
+    sc_coroutine() : m_handle() {}
+    explicit sc_coroutine( handle_type h ) : m_handle( h ) {}
+
+    // disabled
+    sc_coroutine( const sc_coroutine& ) /* = delete */;
+    sc_coroutine& operator = ( const sc_coroutine& ) /* = delete */;
+
+private:
+
+    handle_type m_handle;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_co_awaitable
+//
+//  Result of sc_co_wait(); co_await sets the next trigger of the current
+//  process and suspends the coroutine.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_co_awaitable
+{
+public:
+
+    enum trigger_kind { STATIC, EVENT, OR_LIST, AND_LIST, TIME };
+
+    sc_co_awaitable()
+        : m_kind( STATIC ), m_timeout( false ), m_event_p( nullptr )
+        , m_or_list_p( nullptr ), m_and_list_p( nullptr ), m_time()
+        {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend( std::coroutine_handle<> ) const;
+    void await_resume() const noexcept {}
+
+    trigger_kind             m_kind;
+    bool                     m_timeout;     // wait for m_time as well.
+    const sc_event*          m_event_p;
+    const sc_event_or_list*  m_or_list_p;
+    const sc_event_and_list* m_and_list_p;
+    sc_time                  m_time;
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coroutine_host
+//
+//  Process host, which owns the coroutine frame and resumes it each time its
+//  method process is executed.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_coroutine_host : public sc_process_host
+{
+public:
+
+    explicit sc_coroutine_host( const std::function<sc_coroutine()>& body )
+        : m_body( body ), m_coroutine( m_body() )
+        {}
+
+    void semantics();
+
+private:
+
+    std::function<sc_coroutine()> m_body;
+    sc_coroutine                  m_coroutine;
+};
+
+
+// co_await sc_co_wait(...) in coroutine processes, see next_trigger(...)
+
+inline sc_co_awaitable
+sc_co_wait()
+{
+    return sc_co_awaitable();
+}
+
+inline sc_co_awaitable
+sc_co_wait( const sc_event& e )
+{
+    sc_co_awaitable a;
+    a.m_kind = sc_co_awaitable::EVENT;
+    a.m_event_p = &e;
+    return a;
+}
+
+inline sc_co_awaitable
+sc_co_wait( const sc_event_or_list& el )
+{
+    sc_co_awaitable a;
+    a.m_kind = sc_co_awaitable::OR_LIST;
+    a.m_or_list_p = &el;
+    return a;
+}
+
+inline sc_co_awaitable
+sc_co_wait( const sc_event_and_list& el )
+{
+    sc_co_awaitable a;
+    a.m_kind = sc_co_awaitable::AND_LIST;
+    a.m_and_list_p = &el;
+    return a;
+}
+
+inline sc_co_awaitable
+sc_co_wait( const sc_time& t )
+{
+    sc_co_awaitable a;
+    a.m_kind = sc_co_awaitable::TIME;
+    a.m_time = t;
+    return a;
+}
+
+inline sc_co_awaitable
+sc_co_wait( double v, sc_time_unit tu )
+{
+    return sc_co_wait( sc_time( v, tu ) );
+}
+
+inline sc_co_awaitable
+sc_co_wait( const sc_time& t, const sc_event& e )
+{
+    sc_co_awaitable a = sc_co_wait( e );
+    a.m_timeout = true;
+    a.m_time = t;
+    return a;
+}
+
+inline sc_co_awaitable
+sc_co_wait( const sc_time& t, const sc_event_or_list& el )
+{
+    sc_co_awaitable a = sc_co_wait( el );
+    a.m_timeout = true;
+    a.m_time = t;
+    return a;
+}
+
+inline sc_co_awaitable
+sc_co_wait( const sc_time& t, const sc_event_and_list& el )
+{
+    sc_co_awaitable a = sc_co_wait( el );
+    a.m_timeout = true;
+    a.m_time = t;
+    return a;
+}
+
+
+// spawn a coroutine process; body() is called once to create the frame
+
+SC_API sc_process_handle
+sc_spawn_coroutine( const std::function<sc_coroutine()>& body,
+                    const char* name_p = 0,
+                    const sc_spawn_options* opt_p = 0 );
+
+} // namespace sc_core
+
+
+#define declare_coroutine_process(handle, name, host_tag, func)             \
+    {                                                                         \
+        ::sc_core::sc_process_handle handle =                                 \
+            ::sc_core::sc_spawn_coroutine(                                    \
+                [this]() { return this->host_tag::func(); }, name );          \
+        this->sensitive << handle;                                            \
+        this->sensitive_pos << handle;                                        \
+        this->sensitive_neg << handle;                                        \
+    }
+
+#define SC_COROUTINE(func)                                                    \
+    declare_coroutine_process( func ## _handle,                               \
+                               #func,                                         \
+                               SC_CURRENT_USER_MODULE,                        \
+                               func )
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+#endif // SC_HAS_COROUTINES_
+
+#endif // SC_COROUTINE_H
+
+// Taf!
@@ -36,6 +36,7 @@
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/kernel/sc_object_manager.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/utils/sc_utils_ids.h"
 
 #include <sstream>
@@ -64,6 +65,10 @@ sc_event::basename() const
 void
 sc_event::cancel()
 {
+    if( SC_UNLIKELY_( m_simc->m_in_parallel_batch ) ) {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::DEFER_CANCEL, this );
+        return;
+    }
     // cancel a delta or timed notification
     switch( m_notify_type ) {
     case DELTA: {
@@ -75,7 +80,7 @@ sc_event::cancel()
     case TIMED: {
         // remove this event from the timed events set
         sc_assert( m_timed != nullptr );
-        m_timed->m_event = nullptr;
+        m_simc->remove_timed_event( m_timed );
         m_timed = nullptr;
         m_notify_type = NONE;
         break;
@@ -89,6 +94,10 @@ sc_event::cancel()
 void
 sc_event::notify()
 {
+    if( SC_UNLIKELY_( m_simc->m_in_parallel_batch ) ) {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::DEFER_NOTIFY, this );
+        return;
+    }
     // immediate notification
     if( !m_simc->evaluation_phase() )
         // coming from
@@ -106,6 +115,10 @@ sc_event::notify()
 void
 sc_event::notify( const sc_time& t )
 {
+    if( SC_UNLIKELY_( m_simc->m_in_parallel_batch ) ) {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::DEFER_NOTIFY_TIMED, this, t );
+        return;
+    }
     if( m_notify_type == DELTA ) {
         return;
     }
@@ -126,7 +139,7 @@ sc_event::notify( const sc_time& t )
         if( m_notify_type == TIMED ) {
             // remove this event from the timed events set
             sc_assert( m_timed != nullptr );
-            m_timed->m_event = nullptr;
+            m_simc->remove_timed_event( m_timed );
             m_timed = nullptr;
         }
         // add this event to the delta events set
@@ -153,7 +166,7 @@ sc_event::notify( const sc_time& t )
             return;
         }
         // remove this event from the timed events set
-        m_timed->m_event = nullptr;
+        m_simc->remove_timed_event( m_timed );
         m_timed = nullptr;
     }
     // add this event to the timed events set
@@ -177,6 +190,10 @@ static void sc_warn_notify_delayed()
 void
 sc_event::notify_delayed()
 {
+    if( SC_UNLIKELY_( m_simc->m_in_parallel_batch ) ) {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::DEFER_NOTIFY_DELAYED, this );
+        return;
+    }
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, nullptr );
@@ -189,6 +206,10 @@ sc_event::notify_delayed()
 void
 sc_event::notify_delayed( const sc_time& t )
 {
+    if( SC_UNLIKELY_( m_simc->m_in_parallel_batch ) ) {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::DEFER_NOTIFY_DELAYED_TIMED, this, t );
+        return;
+    }
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, nullptr );
@@ -289,8 +310,8 @@ sc_event::sc_event( const char* name ) :
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
-    m_timed( nullptr )
-    
+    m_timed( nullptr ),
+    m_trigger_hook_p( nullptr )
 {
     register_event( name );
 }
@@ -308,8 +329,8 @@ sc_event::sc_event() :
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
-    m_timed( nullptr )
-    
+    m_timed( nullptr ),
+    m_trigger_hook_p( nullptr )
 {
     register_event( nullptr );
 }
@@ -327,8 +348,8 @@ sc_event::sc_event( kernel_tag, const char* name ) :
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
-    m_timed( nullptr )
-    
+    m_timed( nullptr ),
+    m_trigger_hook_p( nullptr )
 {
     register_event( name, /* is_kernel_event = */ true );
 }
@@ -348,6 +369,7 @@ sc_event::~sc_event()
 	sc_object_manager* object_manager_p = m_simc->get_object_manager();
 	object_manager_p->remove_event( m_name );
     }
+    SC_DO_PROFILE_( m_simc, remove_event( this ) );
 
     for(auto & i : m_threads_dynamic) {
         if( i->m_event_p == this )
@@ -359,12 +381,36 @@ sc_event::~sc_event()
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_event::prefetch_static"
+// |
+// | This method hints that the scheduling state of the supplied process, which
+// | is statically sensitive to an event being triggered, is accessed soon.
+// | The processes of events with a large fan-out, e.g., clocks and resets,
+// | are rarely in the cache.
+// |
+// | Arguments:
+// |     proc_p -> process to be checked by trigger_static() soon.
+// +----------------------------------------------------------------------------
+#define SC_TRIGGER_PREFETCH_DISTANCE 8
+
+inline void
+sc_event::prefetch_static( const sc_process_b* proc_p )
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch( &proc_p->m_runnable_p );
+    __builtin_prefetch( &proc_p->m_trigger_type );
+#else
+    (void)proc_p;
+#endif
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_event::trigger"
 // |
 // | This method "triggers" this object instance. This consists of scheduling
 // | for execution all the processes that are schedulable and waiting on this
-// | event.
+// | event. Finally the trigger hook of the event is called, if any.
 // +----------------------------------------------------------------------------
 void
 sc_event::trigger()
@@ -373,18 +419,23 @@ sc_event::trigger()
     m_notify_type = NONE;
     m_delta_event_index = -1;
     m_timed = nullptr;
+    SC_DO_PROFILE_( m_simc, trigger( this ) );
 
     int       last_i; // index of last element in vector now accessing.
     int       size;   // size of vector now accessing.
 
 
-    // trigger the static sensitive methods
+    // trigger the static sensitive methods, the state of the methods further
+    // down the list is prefetched
 
     if( ( size = m_methods_static.size() ) != 0 )
     {
         sc_method_handle* l_methods_static = &m_methods_static[0];
         int i = size - 1;
         do {
+            if( i >= SC_TRIGGER_PREFETCH_DISTANCE )
+                prefetch_static(
+                    l_methods_static[i - SC_TRIGGER_PREFETCH_DISTANCE] );
             sc_method_handle method_h = l_methods_static[i];
             method_h->trigger_static();
         } while( -- i >= 0 );
@@ -418,6 +469,9 @@ sc_event::trigger()
         sc_thread_handle* l_threads_static = &m_threads_static[0];
         int i = size - 1;
         do {
+            if( i >= SC_TRIGGER_PREFETCH_DISTANCE )
+                prefetch_static(
+                    l_threads_static[i - SC_TRIGGER_PREFETCH_DISTANCE] );
             sc_thread_handle thread_h = l_threads_static[i];
             thread_h->trigger_static();
         } while( -- i >= 0 );
@@ -441,8 +495,18 @@ sc_event::trigger()
 	}
         m_threads_dynamic.resize(last_i+1);
     }
+
+    // e.g. the default event of an sc_event_queue schedules its next
+    // notification
+
+    if( m_trigger_hook_p )
+        m_trigger_hook_p->triggered();
+
+    SC_DO_PROFILE_( m_simc, trigger( nullptr ) );
 }
 
+#undef SC_TRIGGER_PREFETCH_DISTANCE
+
 bool sc_event::triggered() const
 {
     return m_trigger_stamp == m_simc->change_stamp();
@@ -245,6 +245,25 @@ public:
 
 typedef sc_event_expr<sc_event_or_list> sc_event_or_expr;
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_event_trigger_hook
+//
+//  Called by sc_event::trigger() after the processes waiting on the event
+//  have been scheduled, e.g. to let sc_event_queue schedule its next
+//  notification.
+//
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+class SC_API sc_event_trigger_hook
+{
+public:
+    virtual void triggered() = 0;
+
+protected:
+    virtual ~sc_event_trigger_hook() {}
+};
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event
 //
@@ -268,6 +287,8 @@ class SC_API sc_event
     template<typename IF> friend class sc_fifo;
     friend class sc_semaphore;
     friend class sc_mutex;
+    friend class sc_waiter_queue;
+    friend class sc_shm_fifo_base;
     friend class sc_join;
     friend class sc_trace_file;
 
@@ -323,6 +344,8 @@ private:
 
     void trigger();
 
+    static void prefetch_static( const sc_process_b* );
+
 private:
 
     enum notify_t { NONE, DELTA, TIMED };
@@ -334,6 +357,7 @@ private:
     notify_t        m_notify_type;
     int             m_delta_event_index;
     sc_event_timed* m_timed;
+    sc_event_trigger_hook* m_trigger_hook_p; // called on a trigger
 
     mutable std::vector<sc_method_handle> m_methods_static;
     mutable std::vector<sc_method_handle> m_methods_dynamic;
@@ -359,13 +383,14 @@ class SC_API sc_event_timed
 {
     friend class sc_event;
     friend class sc_simcontext;
+    friend class sc_timed_event_queue;
 
     friend SC_API int sc_notify_time_compare( const void*, const void* );
 
 private:
 
     sc_event_timed( sc_event* e, const sc_time& t )
-        : m_event( e ), m_notify_time( t )
+        : m_event( e ), m_notify_time( t ), m_queue_index( 0 )
         {}
 
     ~sc_event_timed()
@@ -391,8 +416,9 @@ private:
 
 private:
 
-    sc_event* m_event;
-    sc_time   m_notify_time;
+    sc_event*   m_event;
+    sc_time     m_notify_time;
+    std::size_t m_queue_index; // position in the timed event queue.
 
 private:
 
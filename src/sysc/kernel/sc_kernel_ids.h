@@ -201,6 +201,25 @@ SC_DEFINE_MESSAGE(SC_ID_RESET_PROCESS_WHILE_NOT_RUNNING_  , 573,
         "a process may not be asynchronously reset while the simulation is not running" )
 SC_DEFINE_MESSAGE(SC_ID_THROW_IT_WHILE_NOT_RUNNING_  , 574,
         "throw_it not allowed unless simulation is running " )
+SC_DEFINE_MESSAGE(SC_ID_SET_ISOLATED_  , 575,
+        "set_isolated() is only allowed for SC_METHODs" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_EVALUATION_AFTER_START_  , 576,
+        "attempt to set parallel evaluation after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_EVALUATION_UNSUPPORTED_  , 577,
+        "parallel evaluation requires host thread support, "
+        "evaluation will be sequential" )
+SC_DEFINE_MESSAGE(SC_ID_TIMED_EVENT_QUEUE_AFTER_START_  , 578,
+        "attempt to replace the timed event queue after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_CLOCK_ENGINE_AFTER_ELABORATION_  , 579,
+        "attempt to change the clock engine after elaboration will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_PROFILING_UNSUPPORTED_  , 580,
+        "scheduler profiling is disabled in this build, "
+        "sc_set_profiling() will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_PROFILE_WRITE_FAILED_  , 581,
+        "unable to write scheduler profile" )
+SC_DEFINE_MESSAGE(SC_ID_PORT_RESOLUTION_AFTER_ELABORATION_  , 582,
+        "attempt to change the port resolution after elaboration will be "
+        "ignored" )
 
 
 /*****************************************************************************
@@ -31,6 +31,7 @@
 #include "sysc/kernel/sc_cmnhdr.h"
 #include "sysc/kernel/sc_externs.h"
 #include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_ver.h"
 #include "sysc/utils/sc_report.h"
 #include "sysc/utils/sc_report_handler.h"
@@ -90,6 +91,7 @@ sc_elab_and_sim( int argc, char* argv[] )
 
         // Perform cleanup here
         sc_in_action = false;
+        sc_get_curr_simcontext()->write_requested_profile();
     }
     catch( const sc_report& x )
     {
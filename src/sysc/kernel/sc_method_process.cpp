@@ -29,6 +29,7 @@
 #include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_spawn_options.h"
 
 // DEBUGGING MACROS:
@@ -88,6 +89,10 @@ void sc_method_process::check_for_throws()
 //------------------------------------------------------------------------------
 void sc_method_process::clear_trigger()
 {
+    if( SC_UNLIKELY_( simcontext()->m_in_parallel_batch ) ) {
+        defer_trigger( STATIC, nullptr );
+        return;
+    }
     switch( m_trigger_type ) {
       case STATIC:
         return;
@@ -135,6 +140,23 @@ void sc_method_process::clear_trigger()
     m_trigger_type = STATIC;
 }
 
+//------------------------------------------------------------------------------
+//"sc_method_process::defer_trigger"
+//
+// This method records a change of the dynamic sensitivity of this object
+// instance made while it is executed by the parallel evaluator. The change
+// is applied by the simulator thread after the batch completed, since it
+// modifies the events and the timed event queue.
+//     type     = trigger type, STATIC to clear the trigger.
+//     target_p = event or event list of the trigger, if any.
+//     t        = timeout of the trigger, if any.
+//------------------------------------------------------------------------------
+void sc_method_process::defer_trigger( trigger_t type, const void* target_p,
+                                       const sc_time& t )
+{
+    sc_parallel_evaluator::defer_trigger( type, target_p, t );
+}
+
 //------------------------------------------------------------------------------
 //"sc_method_process::disable_process"
 //
@@ -307,7 +329,7 @@ sc_method_process::sc_method_process( const char* name_p,
     sc_process_b(
         name_p ? name_p : sc_gen_unique_name("method_p"),
         false, free_host, method_p, host_p, opt_p),
-    m_cor(nullptr), m_stack_size(0)
+    m_cor(nullptr), m_isolated(false), m_stack_size(0)
 {
 
     // CHECK IF THIS IS AN sc_module-BASED PROCESS AND SIMUALTION HAS STARTED:
@@ -325,6 +347,7 @@ sc_method_process::sc_method_process( const char* name_p,
     m_process_kind = SC_METHOD_PROC_;
     if (opt_p) {
         m_dont_init = opt_p->m_dont_initialize;
+        m_isolated = opt_p->m_isolated;
 
         // traverse event sensitivity list
         for (auto m_sensitive_event : opt_p->m_sensitive_events) {
@@ -107,6 +107,7 @@ class sc_method_process : public sc_process_b {
     friend void sc_set_stack_size( sc_method_handle, std::size_t );
     friend class sc_event;
     friend class sc_module;
+    friend class sc_parallel_evaluator;
     friend class sc_process_table;
     friend class sc_process_handle;
     friend class sc_simcontext;
@@ -136,18 +137,23 @@ class sc_method_process : public sc_process_b {
     virtual const char* kind() const
         { return "sc_method_process"; }
 
+    bool isolated() const { return m_isolated; }
+
   protected:
     void check_for_throws();
     virtual void disable_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     virtual void enable_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
+    inline bool run_isolated() const;
     inline bool run_process();
     virtual void kill_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     sc_method_handle next_exist();
     sc_method_handle next_runnable();
     void clear_trigger();
+    void defer_trigger( trigger_t type, const void* target_p,
+                        const sc_time& t = SC_ZERO_TIME );
     void next_trigger( const sc_event& );
     void next_trigger( const sc_event_or_list& );
     void next_trigger( const sc_event_and_list& );
@@ -158,6 +164,7 @@ class sc_method_process : public sc_process_b {
     virtual void resume_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     void set_next_exist( sc_method_handle next_p );
+    void set_isolated( bool isolated ) { m_isolated = isolated; }
     void set_next_runnable( sc_method_handle next_p );
     void set_stack_size( std::size_t size );
     virtual void suspend_process( 
@@ -170,6 +177,7 @@ class sc_method_process : public sc_process_b {
 
   protected:
     sc_cor*                          m_cor;        // Thread's coroutine.
+    bool                             m_isolated;   // Parallel evaluation.
     std::size_t                      m_stack_size; // Thread stack size.
     std::vector<sc_process_monitor*> m_monitor_q;  // Thread monitors.
 
@@ -187,6 +195,10 @@ inline
 void
 sc_method_process::next_trigger( const sc_event& e )
 {
+    if( SC_UNLIKELY_( simcontext()->m_in_parallel_batch ) ) {
+        defer_trigger( EVENT, &e );
+        return;
+    }
     clear_trigger();
     e.add_dynamic( this );
     m_event_p = &e;
@@ -197,6 +209,10 @@ inline
 void
 sc_method_process::next_trigger( const sc_event_or_list& el )
 {
+    if( SC_UNLIKELY_( simcontext()->m_in_parallel_batch ) ) {
+        defer_trigger( OR_LIST, &el );
+        return;
+    }
     clear_trigger();
     el.add_dynamic( this );
     m_event_list_p = &el;
@@ -207,6 +223,10 @@ inline
 void
 sc_method_process::next_trigger( const sc_event_and_list& el )
 {
+    if( SC_UNLIKELY_( simcontext()->m_in_parallel_batch ) ) {
+        defer_trigger( AND_LIST, &el );
+        return;
+    }
     clear_trigger();
     el.add_dynamic( this );
     m_event_list_p = &el;
@@ -218,6 +238,10 @@ inline
 void
 sc_method_process::next_trigger( const sc_time& t )
 {
+    if( SC_UNLIKELY_( simcontext()->m_in_parallel_batch ) ) {
+        defer_trigger( TIMEOUT, nullptr, t );
+        return;
+    }
     clear_trigger();
     m_timeout_event_p->notify_internal( t );
     m_timeout_event_p->add_dynamic( this );
@@ -228,6 +252,10 @@ inline
 void
 sc_method_process::next_trigger( const sc_time& t, const sc_event& e )
 {
+    if( SC_UNLIKELY_( simcontext()->m_in_parallel_batch ) ) {
+        defer_trigger( EVENT_TIMEOUT, &e, t );
+        return;
+    }
     clear_trigger();
     m_timeout_event_p->notify_internal( t );
     m_timeout_event_p->add_dynamic( this );
@@ -240,6 +268,10 @@ inline
 void
 sc_method_process::next_trigger( const sc_time& t, const sc_event_or_list& el )
 {
+    if( SC_UNLIKELY_( simcontext()->m_in_parallel_batch ) ) {
+        defer_trigger( OR_LIST_TIMEOUT, &el, t );
+        return;
+    }
     clear_trigger();
     m_timeout_event_p->notify_internal( t );
     m_timeout_event_p->add_dynamic( this );
@@ -252,6 +284,10 @@ inline
 void
 sc_method_process::next_trigger( const sc_time& t, const sc_event_and_list& el )
 {
+    if( SC_UNLIKELY_( simcontext()->m_in_parallel_batch ) ) {
+        defer_trigger( AND_LIST_TIMEOUT, &el, t );
+        return;
+    }
     clear_trigger();
     m_timeout_event_p->notify_internal( t );
     m_timeout_event_p->add_dynamic( this );
@@ -320,6 +356,18 @@ inline bool sc_method_process::run_process()
     return true;
 }
 
+//------------------------------------------------------------------------------
+//"sc_method_process::run_isolated"
+//
+// This inline method returns true if this object instance may be executed
+// by the parallel evaluator, i.e., it was declared as isolated and there is
+// neither a reset nor another exception to be thrown to it.
+//------------------------------------------------------------------------------
+inline bool sc_method_process::run_isolated() const
+{
+    return m_isolated && m_resets.empty() && m_throw_status == THROW_NONE;
+}
+
 //------------------------------------------------------------------------------
 //"sc_method_process::trigger_static"
 //
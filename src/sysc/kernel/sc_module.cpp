@@ -182,7 +182,8 @@ sc_module::sc_module()
   m_port_vec(),
   m_port_index(0),
   m_name_gen(nullptr),
-  m_module_name_p(nullptr)
+  m_module_name_p(nullptr),
+  m_registry_index(-1)
 {
     /* When this form is used, we better have a fresh sc_module_name
        on the top of the stack */
@@ -209,7 +210,8 @@ sc_module::sc_module( const sc_module_name& )
   m_port_vec(),
   m_port_index(0),
   m_name_gen(nullptr),
-  m_module_name_p(nullptr)
+  m_module_name_p(nullptr),
+  m_registry_index(-1)
 {
     /* For those used to the old style of passing a name to sc_module,
        this constructor will reduce the chance of making a mistake */
@@ -242,7 +244,8 @@ sc_module::sc_module( const char* nm )
   m_port_vec(),
   m_port_index(0),
   m_name_gen(nullptr),
-  m_module_name_p(nullptr)
+  m_module_name_p(nullptr),
+  m_registry_index(-1)
 {
     SC_REPORT_WARNING( SC_ID_BAD_SC_MODULE_CONSTRUCTOR_, nm );
     sc_module_init();
@@ -257,7 +260,8 @@ sc_module::sc_module( const std::string& s )
   m_port_vec(),
   m_port_index(0),
   m_name_gen(nullptr),
-  m_module_name_p(nullptr)
+  m_module_name_p(nullptr),
+  m_registry_index(-1)
 {
     SC_REPORT_WARNING( SC_ID_BAD_SC_MODULE_CONSTRUCTOR_, s.c_str() );
     sc_module_init();
@@ -463,6 +467,21 @@ sc_module::set_stack_size( std::size_t size )
     }
 }
 
+void
+sc_module::set_isolated()
+{
+    sc_process_handle last_proc = sc_get_last_created_process_handle();
+    sc_method_handle  method_h = (sc_method_handle)last_proc;
+    if ( method_h )
+    {
+	method_h->set_isolated( true );
+    }
+    else
+    {
+	SC_REPORT_WARNING( SC_ID_SET_ISOLATED_, nullptr );
+    }
+}
+
 
 int
 sc_module::append_port( sc_port_base* port_ )
@@ -298,6 +298,10 @@ protected:
     // Function to set the stack size of the current (c)thread process.
     void set_stack_size( std::size_t );
 
+    // Function to declare the last created SC_METHOD as isolated, i.e.,
+    // eligible for parallel evaluation (see sc_set_parallel_evaluation).
+    void set_isolated();
+
     int append_port( sc_port_base* );
 
 private:
@@ -311,6 +315,7 @@ private:
     int                         m_port_index;
     sc_name_gen*                m_name_gen;
     sc_module_name*             m_module_name_p;
+    int                         m_registry_index; // in sc_module_registry
 
 public:
 
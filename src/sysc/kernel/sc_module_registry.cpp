@@ -66,26 +66,24 @@ sc_module_registry::insert( sc_module& module_ )
 #endif
 
     // insert
+    module_.m_registry_index = size();
     m_module_vec.push_back( &module_ );
 }
 
 void
 sc_module_registry::remove( sc_module& module_ )
 {
-    int i;
-    for( i = 0; i < size(); ++ i ) {
-	if( &module_ == m_module_vec[i] ) {
-	    break;
-	}
-    }
-    if( i == size() ) {
+    int i = module_.m_registry_index;
+    if( i < 0 || i >= size() || m_module_vec[i] != &module_ ) {
         SC_REPORT_ERROR( SC_ID_REMOVE_MODULE_, nullptr );
         return;
     }
 
     // remove
     m_module_vec[i] = m_module_vec.back();
+    m_module_vec[i]->m_registry_index = i;
     m_module_vec.pop_back();
+    module_.m_registry_index = -1;
 }
 
 
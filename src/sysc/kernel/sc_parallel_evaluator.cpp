@@ -0,0 +1,369 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel_evaluator.cpp -- Parallel execution of isolated method processes
+                               within the evaluation phase.
+
+  CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_parallel_evaluator.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/communication/sc_prim_channel.h"
+
+namespace sc_core {
+
+// The worker of the calling host thread while it executes a batch.
+
+thread_local sc_parallel_evaluator::worker*
+sc_parallel_evaluator::m_curr_worker_p = nullptr;
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::sc_parallel_evaluator"
+//
+// This is the object instance constructor for this class. The calling
+// (simulator) thread acts as worker 0, so threads-1 host threads are started.
+//------------------------------------------------------------------------------
+sc_parallel_evaluator::sc_parallel_evaluator( sc_simcontext* simc_p,
+                                              unsigned threads ) :
+    m_simc( simc_p ), m_threads( threads ? threads : 1 ), m_workers(),
+    m_batch_p( nullptr ), m_batch_n( 0 ), m_next( 0 ), m_slot_worker(),
+    m_slot_error(), m_mutex(), m_start_cond(), m_done_cond(),
+    m_generation( 0 ), m_pending( 0 ), m_stop( false )
+{
+    m_workers.resize( m_threads );
+#ifndef SC_DISABLE_ASYNC_UPDATES
+    for ( unsigned i = 1; i < m_threads; ++i )
+    {
+        m_workers[i].m_thread =
+            std::thread( &sc_parallel_evaluator::worker_loop, this, i );
+    }
+#endif
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::~sc_parallel_evaluator"
+//
+// This is the object instance destructor for this class. It stops and joins
+// the host threads of the pool.
+//------------------------------------------------------------------------------
+sc_parallel_evaluator::~sc_parallel_evaluator()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_stop = true;
+    }
+    m_start_cond.notify_all();
+    for ( auto& w : m_workers )
+    {
+        if ( w.m_thread.joinable() )
+            w.m_thread.join();
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::curr_proc_info"
+//
+// This static method returns the process information of the calling host
+// thread while a batch is executing.
+//------------------------------------------------------------------------------
+sc_curr_proc_handle
+sc_parallel_evaluator::curr_proc_info()
+{
+    sc_assert( m_curr_worker_p != nullptr );
+    return &m_curr_worker_p->m_proc_info;
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::current_writer"
+//
+// This static method returns the process to be used for writer policy checks
+// of the calling host thread while a batch is executing.
+//------------------------------------------------------------------------------
+sc_process_b*
+sc_parallel_evaluator::current_writer()
+{
+    sc_assert( m_curr_worker_p != nullptr );
+    return m_curr_worker_p->m_writer_p;
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::defer"
+//
+// This static method records a side effect of the process executing on the
+// calling host thread. The record is replayed after the batch completed.
+//------------------------------------------------------------------------------
+void
+sc_parallel_evaluator::defer( deferred_kind kind, void* target_p,
+                              const sc_time& t )
+{
+    sc_assert( m_curr_worker_p != nullptr );
+    deferred_action action = { m_curr_worker_p->m_slot, kind, target_p, t,
+                               sc_process_b::STATIC };
+    m_curr_worker_p->m_actions.push_back( action );
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::defer_trigger"
+//
+// This static method records a next_trigger() call, or a clear of the
+// trigger if type is STATIC, of the process executing on the calling host
+// thread. The record is replayed after the batch completed.
+//------------------------------------------------------------------------------
+void
+sc_parallel_evaluator::defer_trigger( sc_process_b::trigger_t type,
+                                      const void* target_p, const sc_time& t )
+{
+    sc_assert( m_curr_worker_p != nullptr );
+    deferred_action action = { m_curr_worker_p->m_slot, DEFER_TRIGGER,
+                               const_cast<void*>( target_p ), t, type };
+    m_curr_worker_p->m_actions.push_back( action );
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::execute"
+//
+// This method executes slots of the current batch until all slots have been
+// claimed. Exceptions are captured per slot and handled during the replay.
+//------------------------------------------------------------------------------
+void
+sc_parallel_evaluator::execute( worker& w )
+{
+    const bool write_check = m_simc->write_check();
+    const unsigned index = static_cast<unsigned>( &w - &m_workers[0] );
+
+    m_curr_worker_p = &w;
+    w.m_proc_info.kind = SC_METHOD_PROC_;
+    for ( ;; )
+    {
+        std::size_t slot = m_next.fetch_add( 1, std::memory_order_relaxed );
+        if ( slot >= m_batch_n )
+            break;
+
+        sc_method_handle method_h = m_batch_p[slot];
+        m_slot_worker[slot] = index;
+        w.m_slot = slot;
+        w.m_proc_info.process_handle = method_h;
+        w.m_writer_p = write_check ? method_h : nullptr;
+        try {
+            method_h->semantics();
+        }
+        catch( ... ) {
+            m_slot_error[slot] = std::current_exception();
+        }
+    }
+    w.m_proc_info.process_handle = nullptr;
+    w.m_writer_p = nullptr;
+    m_curr_worker_p = nullptr;
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::replay"
+//
+// This method performs a recorded side effect on the simulator thread.
+//------------------------------------------------------------------------------
+void
+sc_parallel_evaluator::replay( const deferred_action& action )
+{
+    switch ( action.kind )
+    {
+      case DEFER_UPDATE:
+        static_cast<sc_prim_channel*>( action.target_p )->request_update();
+        break;
+      case DEFER_NOTIFY:
+        static_cast<sc_event*>( action.target_p )->notify();
+        break;
+      case DEFER_NOTIFY_TIMED:
+        static_cast<sc_event*>( action.target_p )->notify( action.time );
+        break;
+      case DEFER_NOTIFY_DELAYED:
+        static_cast<sc_event*>( action.target_p )->notify_delayed();
+        break;
+      case DEFER_NOTIFY_DELAYED_TIMED:
+        static_cast<sc_event*>( action.target_p )->notify_delayed( action.time );
+        break;
+      case DEFER_CANCEL:
+        static_cast<sc_event*>( action.target_p )->cancel();
+        break;
+      case DEFER_TRIGGER:
+        replay_trigger( m_batch_p[action.slot], action );
+        break;
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::replay_trigger"
+//
+// This method performs a recorded next_trigger() call of the supplied method
+// process on the simulator thread.
+//------------------------------------------------------------------------------
+void
+sc_parallel_evaluator::replay_trigger( sc_method_handle method_h,
+                                       const deferred_action& action )
+{
+    const sc_event* event_p =
+        static_cast<const sc_event*>( action.target_p );
+    const sc_event_or_list* or_list_p =
+        static_cast<const sc_event_or_list*>( action.target_p );
+    const sc_event_and_list* and_list_p =
+        static_cast<const sc_event_and_list*>( action.target_p );
+
+    switch ( action.trigger )
+    {
+      case sc_process_b::STATIC:
+        method_h->clear_trigger();
+        break;
+      case sc_process_b::EVENT:
+        method_h->next_trigger( *event_p );
+        break;
+      case sc_process_b::OR_LIST:
+        method_h->next_trigger( *or_list_p );
+        break;
+      case sc_process_b::AND_LIST:
+        method_h->next_trigger( *and_list_p );
+        break;
+      case sc_process_b::TIMEOUT:
+        method_h->next_trigger( action.time );
+        break;
+      case sc_process_b::EVENT_TIMEOUT:
+        method_h->next_trigger( action.time, *event_p );
+        break;
+      case sc_process_b::OR_LIST_TIMEOUT:
+        method_h->next_trigger( action.time, *or_list_p );
+        break;
+      case sc_process_b::AND_LIST_TIMEOUT:
+        method_h->next_trigger( action.time, *and_list_p );
+        break;
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::run"
+//
+// This method executes the supplied batch of method processes on the worker
+// pool and replays their side effects in batch order. The batch is expected
+// to have been taken from the run queue in its entirety before.
+//
+// Result is false if an unfielded exception occurred, true if not. In that
+// case the error has been stored in the simulation context like it is done
+// by sc_method_process::run_process().
+//------------------------------------------------------------------------------
+bool
+sc_parallel_evaluator::run( std::vector<sc_method_handle>& batch )
+{
+    m_batch_p = batch.data();
+    m_batch_n = batch.size();
+    m_next.store( 0, std::memory_order_relaxed );
+    m_slot_worker.resize( m_batch_n );
+    m_slot_error.assign( m_batch_n, std::exception_ptr() );
+    for ( auto& w : m_workers )
+        w.m_actions.clear();
+
+    // EXECUTE THE BATCH, THE CALLING THREAD ACTS AS WORKER 0:
+
+    // the writers of signals are looked up on every write during the batch
+
+    const sc_dt::uint64 writer_stamp = m_simc->m_writer_stamp;
+    m_simc->m_writer_stamp = SC_WRITER_STAMP_NONE_;
+    m_simc->m_prim_channel_registry->m_deferred_updates = true;
+    m_simc->m_in_parallel_batch = true;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_pending = m_threads - 1;
+        ++m_generation;
+    }
+    m_start_cond.notify_all();
+    execute( m_workers[0] );
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_done_cond.wait( lock, [this]{ return m_pending == 0; } );
+    }
+    m_simc->m_in_parallel_batch = false;
+    m_simc->m_prim_channel_registry->m_deferred_updates = false;
+    m_simc->m_writer_stamp = writer_stamp + 1;
+
+    // REPLAY THE RECORDED SIDE EFFECTS IN BATCH ORDER:
+    //
+    // Each worker claimed its slots in increasing order, so the actions of a
+    // slot form a contiguous range within the actions of its worker.
+
+    std::vector<std::size_t> cursor( m_threads, 0 );
+    for ( std::size_t slot = 0; slot < m_batch_n; ++slot )
+    {
+        worker&      w = m_workers[ m_slot_worker[slot] ];
+        std::size_t& i = cursor[ m_slot_worker[slot] ];
+
+        m_simc->set_curr_proc( m_batch_p[slot] );
+        for ( ; i < w.m_actions.size() && w.m_actions[i].slot == slot; ++i )
+            replay( w.m_actions[i] );
+
+        if ( m_slot_error[slot] )
+        {
+            try {
+                std::rethrow_exception( m_slot_error[slot] );
+            }
+            catch( ... ) {
+                m_simc->set_error( sc_handle_exception() );
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//"sc_parallel_evaluator::worker_loop"
+//
+// This method is the body of the host threads of the pool. It waits for a
+// new batch, takes part in its execution and signals completion.
+//------------------------------------------------------------------------------
+void
+sc_parallel_evaluator::worker_loop( unsigned index )
+{
+    unsigned long generation = 0;
+    for ( ;; )
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_start_cond.wait( lock, [&]{
+                return m_stop || m_generation != generation;
+            } );
+            if ( m_stop )
+                return;
+            generation = m_generation;
+        }
+
+        execute( m_workers[index] );
+
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            if ( --m_pending == 0 )
+                m_done_cond.notify_one();
+        }
+    }
+}
+
+} // namespace sc_core
+
+// Taf!
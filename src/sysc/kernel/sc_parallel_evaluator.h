@@ -0,0 +1,151 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel_evaluator.h -- Parallel execution of isolated method processes
+                             within the evaluation phase.
+                             DO NOT EXPORT THIS INCLUDE FILE.
+
+  CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_PARALLEL_EVALUATOR_H
+#define SC_PARALLEL_EVALUATOR_H
+
+#include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_time.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sc_core {
+
+class sc_prim_channel;
+
+//=============================================================================
+//  CLASS : sc_parallel_evaluator
+//
+//  Worker pool executing a batch of isolated SC_METHOD processes at once.
+//
+//  A method process is isolated if its semantics only touch state private to
+//  the process and communicate through primitive channels and events.  The
+//  side effects visible to the kernel (request_update(), event notification
+//  and cancellation, next_trigger()) are recorded per process while the batch executes and
+//  are replayed afterwards on the simulator thread in the order the
+//  processes were taken from the run queue.  Therefore the update and
+//  notification phases see exactly the same sequence of requests as during
+//  a sequential evaluation and the simulation result stays deterministic.
+//
+//  FOR INTERNAL USE ONLY!
+//=============================================================================
+
+class sc_parallel_evaluator
+{
+    friend class sc_simcontext;
+
+  public:
+    enum deferred_kind {
+        DEFER_UPDATE,           // sc_prim_channel::request_update()
+        DEFER_NOTIFY,           // sc_event::notify()
+        DEFER_NOTIFY_TIMED,     // sc_event::notify( const sc_time& )
+        DEFER_NOTIFY_DELAYED,   // sc_event::notify_delayed()
+        DEFER_NOTIFY_DELAYED_TIMED, // sc_event::notify_delayed( const sc_time& )
+        DEFER_CANCEL,           // sc_event::cancel()
+        DEFER_TRIGGER           // next_trigger()
+    };
+
+    // called from within a batch on behalf of the executing process
+    static sc_curr_proc_handle curr_proc_info();
+    static sc_process_b*       current_writer();
+    static void defer( deferred_kind kind, void* target_p,
+                       const sc_time& t = SC_ZERO_TIME );
+    static void defer_trigger( sc_process_b::trigger_t type,
+                               const void* target_p, const sc_time& t );
+
+  private:
+    struct deferred_action
+    {
+        std::size_t   slot;     // batch slot of the recording process.
+        deferred_kind kind;     // kind of side effect.
+        void*         target_p; // channel or event.
+        sc_time       time;     // notification delay or timeout.
+        sc_process_b::trigger_t trigger; // next_trigger() variant.
+    };
+
+    struct worker
+    {
+        worker() : m_proc_info(), m_writer_p(nullptr), m_slot(0),
+                   m_actions(), m_thread() {}
+
+        sc_curr_proc_info            m_proc_info; // process being executed.
+        sc_process_b*                m_writer_p;  // writer for write checks.
+        std::size_t                  m_slot;      // batch slot being executed.
+        std::vector<deferred_action> m_actions;   // recorded side effects.
+        std::thread                  m_thread;    // host thread (not 0).
+    };
+
+  private:
+    sc_parallel_evaluator( sc_simcontext* simc_p, unsigned threads );
+    ~sc_parallel_evaluator();
+
+    unsigned threads() const { return m_threads; }
+
+    bool run( std::vector<sc_method_handle>& batch );
+
+    void execute( worker& w );
+    void replay( const deferred_action& action );
+    void replay_trigger( sc_method_handle method_h,
+                         const deferred_action& action );
+    void worker_loop( unsigned index );
+
+  private:
+    sc_simcontext*                   m_simc;       // owning simulator context.
+    unsigned                         m_threads;    // number of workers.
+    std::vector<worker>              m_workers;    // worker 0 is the caller.
+
+    sc_method_handle*                m_batch_p;    // current batch.
+    std::size_t                      m_batch_n;    // size of current batch.
+    std::atomic<std::size_t>         m_next;       // next slot to execute.
+    std::vector<unsigned>            m_slot_worker;// worker executing slot.
+    std::vector<std::exception_ptr>  m_slot_error; // exception of slot.
+
+    std::mutex                       m_mutex;      // protects the fields below.
+    std::condition_variable          m_start_cond; // signals a new batch.
+    std::condition_variable          m_done_cond;  // signals batch completion.
+    unsigned long                    m_generation; // batch counter.
+    unsigned                         m_pending;    // workers still busy.
+    bool                             m_stop;       // pool shutdown requested.
+
+    static thread_local worker*      m_curr_worker_p; // worker of this thread.
+
+  private: // disabled
+    sc_parallel_evaluator( const sc_parallel_evaluator& );
+    sc_parallel_evaluator& operator = ( const sc_parallel_evaluator& );
+};
+
+} // namespace sc_core
+
+#endif // SC_PARALLEL_EVALUATOR_H
+// Taf!
@@ -36,6 +36,7 @@
 #include "sysc/kernel/sc_sensitive.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_scheduler_profiler.h"
 #include <sstream>
 
 namespace sc_core {
@@ -624,6 +625,7 @@ sc_process_b::~sc_process_b()
     delete m_throw_helper_p;
     delete m_timeout_event_p;
 
+    SC_DO_PROFILE_( simcontext(), remove_process( this ) );
 }
 
 //------------------------------------------------------------------------------
@@ -278,8 +278,10 @@ class SC_API sc_process_b : public sc_object {
     friend class sc_process_table;   // Allow process_table to modify ref. count.
     friend class sc_thread_process;  // Child can access parent.
 
+    friend class sc_coroutine_host;
     friend class sc_event;
     friend class sc_object;
+    friend class sc_parallel_evaluator;
     friend class sc_port_base;
     friend class sc_runnable;
     friend class sc_sensitive;
@@ -289,6 +291,7 @@ class SC_API sc_process_b : public sc_object {
     friend class sc_report_handler;
     friend class sc_reset;
     friend class sc_reset_finder;
+    friend class sc_scheduler_profiler;
     friend class sc_unwind_exception;
 
     friend SC_API const char* sc_gen_unique_name( const char*, bool preserve_first );
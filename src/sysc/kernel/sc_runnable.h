@@ -33,12 +33,121 @@
 
 #include "sysc/kernel/sc_process.h"
 
+#include <utility>
+
 namespace sc_core {
 
+//=============================================================================
+//  CLASS : sc_runnable_queue
+//
+//  Double ended queue of runnable processes in a ring buffer, whose capacity
+//  is a power of two and grows as needed.
+//=============================================================================
+
+template< class T >
+class sc_runnable_queue
+{
+  public:
+    sc_runnable_queue() : m_buf( 0 ), m_mask( 0 ), m_head( 0 ), m_tail( 0 ) {}
+    ~sc_runnable_queue() { delete [] m_buf; }
+
+    bool empty() const { return m_head == m_tail; }
+    std::size_t size() const { return m_tail - m_head; }
+    T    operator [] ( std::size_t i ) const
+        { return m_buf[ ( m_head + i ) & m_mask ]; }
+
+    void clear() { m_head = m_tail = 0; }
+
+    void push_back( T p )
+    {
+        if ( m_tail - m_head == m_mask + ( m_buf != 0 ) ) grow();
+        m_buf[ m_tail++ & m_mask ] = p;
+    }
+
+    void push_front( T p )
+    {
+        if ( m_tail - m_head == m_mask + ( m_buf != 0 ) ) grow();
+        m_buf[ --m_head & m_mask ] = p;
+    }
+
+    T pop_front() { return m_buf[ m_head++ & m_mask ]; }
+
+    T front() const { return m_buf[ m_head & m_mask ]; }
+
+    bool remove( T p );
+
+    void swap( sc_runnable_queue& other );
+
+  private:
+    void grow();
+
+  private:
+    T*          m_buf;  // ring buffer, the capacity is m_mask + 1.
+    std::size_t m_mask; // capacity - 1.
+    std::size_t m_head; // index of first entry (modulo capacity).
+    std::size_t m_tail; // index behind last entry (modulo capacity).
+
+  private:
+    // disabled
+    sc_runnable_queue( const sc_runnable_queue& );
+    sc_runnable_queue& operator = ( const sc_runnable_queue& );
+};
+
+template< class T >
+bool
+sc_runnable_queue<T>::remove( T p )
+{
+    for ( std::size_t i = m_head; i != m_tail; ++i )
+    {
+        if ( m_buf[ i & m_mask ] == p )
+        {
+            for ( ; i + 1 != m_tail; ++i )
+                m_buf[ i & m_mask ] = m_buf[ ( i + 1 ) & m_mask ];
+            --m_tail;
+            return true;
+        }
+    }
+    return false;
+}
+
+template< class T >
+void
+sc_runnable_queue<T>::swap( sc_runnable_queue& other )
+{
+    std::swap( m_buf, other.m_buf );
+    std::swap( m_mask, other.m_mask );
+    std::swap( m_head, other.m_head );
+    std::swap( m_tail, other.m_tail );
+}
+
+template< class T >
+void
+sc_runnable_queue<T>::grow()
+{
+    std::size_t capacity = m_buf ? 2 * ( m_mask + 1 ) : 64;
+    T*          buf = new T[capacity];
+    std::size_t n = size();
+    for ( std::size_t i = 0; i < n; ++i )
+        buf[i] = (*this)[i];
+    delete [] m_buf;
+    m_buf  = buf;
+    m_mask = capacity - 1;
+    m_head = 0;
+    m_tail = n;
+}
+
 //=============================================================================
 //  CLASS : sc_runnable
 //
 //  Class that manages the ready-to-run queues.
+//
+//  For methods and threads there is a push queue, which collects the
+//  processes becoming runnable, and a pop queue, which holds the processes
+//  being executed. toggle_methods() and toggle_threads() turn the push queue
+//  into the pop queue once the latter is empty. The queues are contiguous
+//  ring buffers of process handles, so that popping a process doesn't need
+//  to chase the link stored in the previous process. A queued process has a
+//  non-null m_runnable_p field, see sc_process_b::is_runnable().
 //=============================================================================
 
 class SC_API sc_runnable
@@ -73,12 +182,11 @@ class SC_API sc_runnable
     void dump() const;
 
   private:
-    sc_method_handle m_methods_push_head;
-    sc_method_handle m_methods_push_tail;
-    sc_method_handle m_methods_pop;
-    sc_thread_handle m_threads_push_head;
-    sc_thread_handle m_threads_push_tail;
-    sc_thread_handle m_threads_pop;
+    bool                                m_initialized;
+    sc_runnable_queue<sc_method_handle> m_methods_push;
+    sc_runnable_queue<sc_method_handle> m_methods_pop;
+    sc_runnable_queue<sc_thread_handle> m_threads_push;
+    sc_runnable_queue<sc_thread_handle> m_threads_pop;
 
   private:
     // disabled
@@ -106,6 +214,11 @@ class SC_API sc_runnable
                                m_threads_push to maintain the same scheduler
                                ordering as 2.0.1
 
+      Name, Affiliation, Date:
+  Description of Modification: Replaced the linked lists by ring buffers
+                               (sc_runnable_queue), the scheduler ordering
+                               stays the same.
+
  *****************************************************************************/
 
 // $Log: sc_runnable.h,v $
@@ -61,17 +61,27 @@
 
 namespace sc_core {
 
-// The values below are used to indicate when a queue is empty. A non-zero     
-// non-legal pointer value is used for this so that a zero value in the
-// m_execute_p field of an sc_process_b instance can be used to indicate      
-// that is has not been queued for run. (If we did not use a non-zero
-// queue empty indicator then a sc_process_b instance that was queued
-// twice in a row might end up on the queue twice if it were the first
-// one that was queued!)
+// The values below are used to mark a process as queued. A non-zero
+// non-legal pointer value is stored in the m_runnable_p field of a queued
+// sc_process_b instance, so that a zero value indicates that it has not
+// been queued for run. (The queues themselves no longer use that field as
+// link, see sc_runnable_queue.)
 
 #define SC_NO_METHODS ((sc_method_handle)0xdb)
 #define SC_NO_THREADS ((sc_thread_handle)0xdb)
 
+// SC_PREFETCH_RUNNABLE(P) - hint that process P will be executed soon, so
+// that its state is in the cache once it is popped. When a process is
+// popped the one SC_PREFETCH_DISTANCE places behind it is prefetched.
+
+#define SC_PREFETCH_DISTANCE 4
+
+#if defined(__GNUC__) || defined(__clang__)
+#   define SC_PREFETCH_RUNNABLE(P) __builtin_prefetch( P )
+#else
+#   define SC_PREFETCH_RUNNABLE(P) ((void)0)
+#endif
+
 
 //------------------------------------------------------------------------------
 //"sc_runnable::dump"
@@ -83,17 +93,15 @@ inline void sc_runnable::dump() const
     // Dump the thread queues:
 
     std::cout << "thread pop queue: " << std::endl;
-    for ( sc_thread_handle p = m_threads_pop; p != SC_NO_THREADS; 
-          p = p->next_runnable() )
+    for ( std::size_t i = 0; i < m_threads_pop.size(); ++i )
     {
-        std::cout << "    " << p << std::endl;
+        std::cout << "    " << m_threads_pop[i] << std::endl;
     }
 
     std::cout << "thread push queue: " << std::endl;
-    for ( sc_thread_handle p = m_threads_push_head->next_runnable(); 
-          p != SC_NO_THREADS; p = p->next_runnable() )
+    for ( std::size_t i = 0; i < m_threads_push.size(); ++i )
     {
-        std::cout << "    " << p << std::endl;
+        std::cout << "    " << m_threads_push[i] << std::endl;
     }
 }
 
@@ -107,8 +115,8 @@ inline void sc_runnable::dump() const
 inline void sc_runnable::execute_method_next( sc_method_handle method_h )
 {
     DEBUG_MSG(DEBUG_NAME,method_h,"pushing this method to execute next");
-    method_h->set_next_runnable( m_methods_pop );
-    m_methods_pop = method_h;
+    method_h->set_next_runnable( SC_NO_METHODS );
+    m_methods_pop.push_front( method_h );
 }
 
 //------------------------------------------------------------------------------
@@ -121,40 +129,24 @@ inline void sc_runnable::execute_method_next( sc_method_handle method_h )
 inline void sc_runnable::execute_thread_next( sc_thread_handle thread_h )
 {
     DEBUG_MSG(DEBUG_NAME,thread_h,"pushing this thread to execute next");
-    thread_h->set_next_runnable( m_threads_pop );
-    m_threads_pop = thread_h;
+    thread_h->set_next_runnable( SC_NO_THREADS );
+    m_threads_pop.push_front( thread_h );
 }
 
 //------------------------------------------------------------------------------
 //"sc_runnable::init"
 //
-// This method initializes this object instance. Note we allocate the queue
-// heads if necessary. This is done here rather than in the constructor for
-// this class to eliminate CTOR processing errors with gcc.
+// This method initializes this object instance, i.e., empties the queues.
+// This is done here rather than in the constructor for this class to
+// eliminate CTOR processing errors with gcc.
 //------------------------------------------------------------------------------
 inline void sc_runnable::init()
 {
-    m_methods_pop = SC_NO_METHODS;
-    if ( !m_methods_push_head )
-    {
-        m_methods_push_head = new sc_method_process("methods_push_head", true, 
-	                                           (SC_ENTRY_FUNC)0, 0, 0);
-        m_methods_push_head->dont_initialize(true);
-	m_methods_push_head->detach();
-    }
-    m_methods_push_tail = m_methods_push_head;
-    m_methods_push_head->set_next_runnable(SC_NO_METHODS);
-
-    m_threads_pop = SC_NO_THREADS;
-    if ( !m_threads_push_head )
-    {
-        m_threads_push_head = new sc_thread_process("threads_push_head", true, 
-	                                            (SC_ENTRY_FUNC)0, 0, 0);
-        m_threads_push_head->dont_initialize(true);
-	m_threads_push_head->detach();
-    }
-    m_threads_push_head->set_next_runnable(SC_NO_THREADS);
-    m_threads_push_tail = m_threads_push_head;
+    m_methods_push.clear();
+    m_methods_pop.clear();
+    m_threads_push.clear();
+    m_threads_pop.clear();
+    m_initialized = true;
 }
 
 
@@ -165,10 +157,8 @@ inline void sc_runnable::init()
 //------------------------------------------------------------------------------
 inline bool sc_runnable::is_empty() const
 {
-    return m_methods_push_head->next_runnable() == SC_NO_METHODS && 
-           m_methods_pop == SC_NO_METHODS &&
-	   m_threads_push_head->next_runnable() == SC_NO_THREADS &&
-	   m_threads_pop == SC_NO_THREADS;
+    return m_methods_push.empty() && m_methods_pop.empty() &&
+           m_threads_push.empty() && m_threads_pop.empty();
 }
 
 
@@ -179,7 +169,7 @@ inline bool sc_runnable::is_empty() const
 //------------------------------------------------------------------------------
 inline bool sc_runnable::is_initialized() const
 {
-    return m_methods_push_head && m_threads_push_head;
+    return m_initialized;
 }
 
 
@@ -195,8 +185,7 @@ inline void sc_runnable::push_back_method( sc_method_handle method_h )
     // sc_assert( method_h->next_runnable() == 0 ); // Can't queue twice.
     DEBUG_MSG(DEBUG_NAME,method_h,"pushing back method");
     method_h->set_next_runnable(SC_NO_METHODS);
-    m_methods_push_tail->set_next_runnable(method_h);
-    m_methods_push_tail = method_h;
+    m_methods_push.push_back(method_h);
 }
 
 
@@ -212,8 +201,7 @@ inline void sc_runnable::push_back_thread( sc_thread_handle thread_h )
     // sc_assert( thread_h->next_runnable() == 0 ); // Can't queue twice.
     DEBUG_MSG(DEBUG_NAME,thread_h,"pushing back thread");
     thread_h->set_next_runnable(SC_NO_THREADS);
-    m_threads_push_tail->set_next_runnable(thread_h);
-    m_threads_push_tail = thread_h;
+    m_threads_push.push_back(thread_h);
 }
 
 
@@ -221,24 +209,15 @@ inline void sc_runnable::push_back_thread( sc_thread_handle thread_h )
 //"sc_runnable::push_front_method"
 //
 // This method pushes the supplied method process onto the front of the queue of
-// runnable method processes. If the queue is empty the process is the tail 
-// also.
+// runnable method processes.
 //     method_h -> method process to add to the queue.
 //------------------------------------------------------------------------------
 inline void sc_runnable::push_front_method( sc_method_handle method_h )
 {
     // sc_assert( method_h->next_runnable() == 0 ); // Can't queue twice.
     DEBUG_MSG(DEBUG_NAME,method_h,"pushing front method");
-    method_h->set_next_runnable(m_methods_push_head->next_runnable());
-    if ( m_methods_push_tail == m_methods_push_head ) // Empty queue.
-    {
-        m_methods_push_tail->set_next_runnable(method_h);
-	m_methods_push_tail = method_h;
-    }
-    else                                               // Non-empty queue.
-    {
-	m_methods_push_head->set_next_runnable(method_h);
-    }
+    method_h->set_next_runnable(SC_NO_METHODS);
+    m_methods_push.push_front(method_h);
 }
 
 
@@ -246,41 +225,34 @@ inline void sc_runnable::push_front_method( sc_method_handle method_h )
 //"sc_runnable::push_front_thread"
 //
 // This method pushes the supplied thread process onto the front of the queue of
-// runnable thread processes. If the queue is empty the process is the tail 
-// also.
+// runnable thread processes.
 //     thread_h -> thread process to add to the queue.
 //------------------------------------------------------------------------------
 inline void sc_runnable::push_front_thread( sc_thread_handle thread_h )
 {
     // sc_assert( thread_h->next_runnable() == 0 ); // Can't queue twice.
     DEBUG_MSG(DEBUG_NAME,thread_h,"pushing front thread");
-    thread_h->set_next_runnable(m_threads_push_head->next_runnable());
-    if ( m_threads_push_tail == m_threads_push_head ) // Empty queue.
-    {
-        m_threads_push_tail->set_next_runnable(thread_h);
-	m_threads_push_tail = thread_h;
-    }
-    else                                               // Non-empty queue.
-    {
-	m_threads_push_head->set_next_runnable(thread_h);
-    }
+    thread_h->set_next_runnable(SC_NO_THREADS);
+    m_threads_push.push_front(thread_h);
 }
 
 //------------------------------------------------------------------------------
 //"sc_runnable::pop_method"
 //
 // This method pops the next method process to be executed, or returns a null 
-// if no method processes are available for execution.
+// if no method processes are available for execution. A process further down
+// the queue is prefetched.
 //------------------------------------------------------------------------------
 inline sc_method_handle sc_runnable::pop_method()
 {
     sc_method_handle result_p;
 
-    result_p = m_methods_pop;
-    if ( result_p != SC_NO_METHODS ) 
+    if ( !m_methods_pop.empty() )
     {
-        m_methods_pop = result_p->next_runnable();
+        result_p = m_methods_pop.pop_front();
         result_p->set_next_runnable(0);
+        if ( m_methods_pop.size() > SC_PREFETCH_DISTANCE )
+            SC_PREFETCH_RUNNABLE( m_methods_pop[SC_PREFETCH_DISTANCE] );
     }
     else
     {
@@ -295,17 +267,19 @@ inline sc_method_handle sc_runnable::pop_method()
 //"sc_runnable::pop_thread"
 //
 // This method pops the next thread process to be executed, or returns a null 
-// if no thread processes are available for execution.
+// if no thread processes are available for execution. A process further down
+// the queue is prefetched.
 //------------------------------------------------------------------------------
 inline sc_thread_handle sc_runnable::pop_thread()
 {
     sc_thread_handle result_p;
 
-    result_p = m_threads_pop;
-    if ( result_p != SC_NO_THREADS ) 
+    if ( !m_threads_pop.empty() )
     {
-        m_threads_pop = result_p->next_runnable();
+        result_p = m_threads_pop.pop_front();
         result_p->set_next_runnable(0);
+        if ( m_threads_pop.size() > SC_PREFETCH_DISTANCE )
+            SC_PREFETCH_RUNNABLE( m_threads_pop[SC_PREFETCH_DISTANCE] );
     }
     else
     {
@@ -326,49 +300,21 @@ inline sc_thread_handle sc_runnable::pop_thread()
 //------------------------------------------------------------------------------
 inline void sc_runnable::remove_method( sc_method_handle remove_p )
 {
-    sc_method_handle now_p;     // Method now checking.
-    sc_method_handle prior_p;   // Method prior to now_p.
-
     // Don't try to remove things if we have not been initialized.
 
     if ( !is_initialized() ) return;
 
-    // Search the push queue:
+    // Search the push queue, then the pop queue:
 
-    prior_p = m_methods_push_head;
-    for ( now_p = m_methods_push_head; now_p!= SC_NO_METHODS; 
-	    now_p = now_p->next_runnable() )
+    if ( m_methods_push.remove( remove_p ) )
     {
-        if ( remove_p == now_p )
-        {
-            prior_p->set_next_runnable( now_p->next_runnable() );
-            if (now_p == m_methods_push_tail) {
-                m_methods_push_tail = prior_p;
-            }
-            now_p->set_next_runnable(0);
-	    DEBUG_MSG(DEBUG_NAME,now_p,"removing method from push queue");
-            return;
-        }
-        prior_p = now_p;
+        remove_p->set_next_runnable(0);
+        DEBUG_MSG(DEBUG_NAME,remove_p,"removing method from push queue");
     }
-
-    // Search the pop queue:
-
-    prior_p = NULL;
-    for ( now_p = m_methods_pop; now_p != SC_NO_METHODS; 
-	  now_p = now_p->next_runnable() )
+    else if ( m_methods_pop.remove( remove_p ) )
     {
-        if ( remove_p == now_p )
-        {
-	    if ( prior_p )
-		prior_p->set_next_runnable( now_p->next_runnable() );
-	    else
-	        m_methods_pop = now_p->next_runnable();
-            now_p->set_next_runnable(0);
-	    DEBUG_MSG(DEBUG_NAME,now_p,"removing method from pop queue");
-            return;
-        }
-        prior_p = now_p;
+        remove_p->set_next_runnable(0);
+        DEBUG_MSG(DEBUG_NAME,remove_p,"removing method from pop queue");
     }
 }
 
@@ -383,49 +329,21 @@ inline void sc_runnable::remove_method( sc_method_handle remove_p )
 //------------------------------------------------------------------------------
 inline void sc_runnable::remove_thread( sc_thread_handle remove_p )
 {
-    sc_thread_handle now_p;     // Thread now checking.
-    sc_thread_handle prior_p;   // Thread prior to now_p.
-
     // Don't try to remove things if we have not been initialized.
 
     if ( !is_initialized() ) return;
 
-    // Search the push queue:
+    // Search the push queue, then the pop queue:
 
-    prior_p = m_threads_push_head;
-    for ( now_p = m_threads_push_head; now_p != SC_NO_THREADS; 
-	  now_p = now_p->next_runnable() )
+    if ( m_threads_push.remove( remove_p ) )
     {
-        if ( remove_p == now_p )
-        {
-            prior_p->set_next_runnable( now_p->next_runnable() );
-            if (now_p == m_threads_push_tail) {
-                m_threads_push_tail = prior_p;
-            }
-            now_p->set_next_runnable(0);
-	    DEBUG_MSG(DEBUG_NAME,now_p,"removing thread from push queue");
-            return;
-        }
-        prior_p = now_p;
+        remove_p->set_next_runnable(0);
+        DEBUG_MSG(DEBUG_NAME,remove_p,"removing thread from push queue");
     }
-
-    // Search the pop queue:
-
-    prior_p = NULL;
-    for ( now_p = m_threads_pop; now_p != SC_NO_THREADS; 
-	  now_p = now_p->next_runnable() )
+    else if ( m_threads_pop.remove( remove_p ) )
     {
-        if ( remove_p == now_p )
-        {
-	    if ( prior_p )
-		prior_p->set_next_runnable( now_p->next_runnable() );
-	    else
-	        m_threads_pop = now_p->next_runnable();
-            now_p->set_next_runnable(0);
-	    DEBUG_MSG(DEBUG_NAME,now_p,"removing thread from pop queue");
-            return;
-        }
-        prior_p = now_p;
+        remove_p->set_next_runnable(0);
+        DEBUG_MSG(DEBUG_NAME,remove_p,"removing thread from pop queue");
     }
 }
 
@@ -435,8 +353,8 @@ inline void sc_runnable::remove_thread( sc_thread_handle remove_p )
 // This is the object instance constructor for this class.
 //------------------------------------------------------------------------------
 inline sc_runnable::sc_runnable() : 
-   m_methods_push_head(0), m_methods_push_tail(0), m_methods_pop(SC_NO_METHODS),
-   m_threads_push_head(0), m_threads_push_tail(0), m_threads_pop(SC_NO_THREADS)
+   m_initialized(false), m_methods_push(), m_methods_pop(), m_threads_push(),
+   m_threads_pop()
 {}
 
 //------------------------------------------------------------------------------
@@ -445,25 +363,22 @@ inline sc_runnable::sc_runnable() :
 // This is the object instance destructor for this class.
 //------------------------------------------------------------------------------
 inline sc_runnable::~sc_runnable()
-{
-    delete m_methods_push_head;
-    delete m_threads_push_head;
-}
+{}
 
 
 //------------------------------------------------------------------------------
 //"sc_runnable::toggle_methods"
 //
-// This method moves the methods push queue to the pop queue and zeros the push
-// queue. This will only be done if the pop queue is presently empty.
+// This method moves the methods push queue to the pop queue and empties the
+// push queue. This will only be done if the pop queue is presently empty.
+// The buffers are swapped, so no process is copied.
 //------------------------------------------------------------------------------
 inline void sc_runnable::toggle_methods()
 {
-    if ( m_methods_pop == SC_NO_METHODS )
+    if ( m_methods_pop.empty() )
     {
-	m_methods_pop = m_methods_push_head->next_runnable();
-	m_methods_push_head->set_next_runnable(SC_NO_METHODS);
-	m_methods_push_tail = m_methods_push_head;
+	m_methods_pop.swap( m_methods_push );
+	m_methods_push.clear();
     }
 }
 
@@ -471,21 +386,23 @@ inline void sc_runnable::toggle_methods()
 //------------------------------------------------------------------------------
 //"sc_runnable::toggle_threads"
 //
-// This method moves the threads push queue to the pop queue and zeros the push
-// queue. This will only be done if the pop queue is presently empty.
+// This method moves the threads push queue to the pop queue and empties the
+// push queue. This will only be done if the pop queue is presently empty.
+// The buffers are swapped, so no process is copied.
 //------------------------------------------------------------------------------
 inline void sc_runnable::toggle_threads()
 {
-    if ( m_threads_pop == SC_NO_THREADS )
+    if ( m_threads_pop.empty() )
     {
-	m_threads_pop = m_threads_push_head->next_runnable();
-	m_threads_push_head->set_next_runnable(SC_NO_THREADS);
-	m_threads_push_tail = m_threads_push_head;
+	m_threads_pop.swap( m_threads_push );
+	m_threads_push.clear();
     }
 }
 
 #undef SC_NO_METHODS
 #undef SC_NO_THREADS
+#undef SC_PREFETCH_DISTANCE
+#undef SC_PREFETCH_RUNNABLE
 #undef DEBUG_MSG
 
 } // namespace sc_core
@@ -498,6 +415,10 @@ inline void sc_runnable::toggle_threads()
       Andy Goodrich, Forte Design Systems, 2 September 2003
       Changed queue heads to instances to eliminate the checks for null heads.
 
+      Name, Affiliation, Date:
+      Replaced the linked lists by ring buffers of process handles, the queue
+      heads are no longer needed. The next process to run is prefetched.
+
  ******************************************************************************/
 
 // $Log: sc_runnable_int.h,v $
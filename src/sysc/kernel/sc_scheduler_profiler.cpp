@@ -0,0 +1,590 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_scheduler_profiler.cpp -- Activations and host time per process and per
+                               scheduler phase.
+
+  CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_scheduler_profiler.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_process.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+namespace sc_core {
+
+static const char* const sc_phase_names[] = { "evaluate", "update", "notify" };
+
+// Event names 0 and 1 stand for wakeups without an event and for timeouts.
+
+static const std::size_t SC_WAKEUP_NO_EVENT = 0;
+static const std::size_t SC_WAKEUP_TIMEOUT  = 1;
+
+//------------------------------------------------------------------------------
+//"sc_scheduler_profiler::sc_scheduler_profiler"
+//
+// This is the object instance constructor for this class.
+//
+// Arguments:
+//     simc_p   = simulator context to be profiled.
+//     timeline = true if the timeline of phases and activations is recorded.
+//------------------------------------------------------------------------------
+sc_scheduler_profiler::sc_scheduler_profiler( sc_simcontext* simc_p,
+                                              bool timeline ) :
+    m_simc( simc_p ), m_timeline( timeline ), m_truncated( false ),
+    m_origin_ns( 0 ), m_processes(), m_process_index(), m_events(),
+    m_event_index(), m_trigger_p( nullptr ), m_proc_i( std::size_t(-1) ),
+    m_proc_start_ns( 0 ), m_phase( PHASE_NONE ), m_phase_start_ns( 0 ),
+    m_phase_ns(), m_activations( 0 ), m_updates( 0 ), m_unchanged( 0 ),
+    m_delta_n( 0 ), m_in_delta( false ),
+    m_delta(), m_step(), m_deltas(), m_steps(), m_records()
+{
+    m_origin_ns = now_ns();
+    m_events.push_back( "(none)" );
+    m_events.push_back( "(timeout)" );
+    m_step.time = simc_p->time_stamp();
+}
+
+sc_dt::uint64
+sc_scheduler_profiler::now_ns() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+//------------------------------------------------------------------------------
+//"sc_scheduler_profiler::activate"
+//
+// This method is called when the scheduler switches from one process to
+// another one or back to itself. The host time since the last switch is
+// charged to the process that was active.
+//
+// Arguments:
+//     proc_p = process being activated, or null.
+//------------------------------------------------------------------------------
+void
+sc_scheduler_profiler::activate( sc_process_b* proc_p )
+{
+    if ( proc_p == nullptr && m_proc_i == std::size_t(-1) )
+        return;
+
+    sc_dt::uint64 now = now_ns();
+    if ( m_proc_i != std::size_t(-1) )
+    {
+        process_record& rec = m_processes[m_proc_i];
+        sc_dt::uint64   ns = now - m_proc_start_ns;
+        int             bucket = 0;
+        for ( sc_dt::uint64 v = ns; v > 1 && bucket < HISTOGRAM_N - 1;
+              v >>= 1 )
+            ++bucket;
+        rec.host_ns += ns;
+        rec.max_ns = std::max( rec.max_ns, ns );
+        rec.histogram[bucket]++;
+        if ( m_timeline )
+            add_timeline( m_proc_start_ns, now, PHASE_N + int(m_proc_i) );
+        m_proc_i = std::size_t(-1);
+    }
+
+    if ( proc_p == nullptr )
+        return;
+
+    m_proc_i = process_index( proc_p );
+    m_proc_start_ns = now;
+    process_record& rec = m_processes[m_proc_i];
+    rec.activations++;
+    if ( proc_p->proc_kind() != SC_METHOD_PROC_ )
+        rec.context_switches++;
+    m_activations++;
+    m_delta.activations++;
+    m_step.activations++;
+}
+
+//------------------------------------------------------------------------------
+//"sc_scheduler_profiler::wakeup"
+//
+// This method is called when a process is made runnable. The wakeup is
+// charged to the event being triggered, if any.
+//
+// Arguments:
+//     proc_p = process being made runnable.
+//------------------------------------------------------------------------------
+void
+sc_scheduler_profiler::wakeup( sc_process_b* proc_p )
+{
+    std::size_t event_i;
+    if ( m_trigger_p == nullptr )
+        event_i = SC_WAKEUP_NO_EVENT;
+    else if ( m_trigger_p == proc_p->m_timeout_event_p )
+        event_i = SC_WAKEUP_TIMEOUT;
+    else
+        event_i = event_index( m_trigger_p );
+
+    std::vector<std::pair<std::size_t, sc_dt::uint64> >& wakeups =
+        m_processes[process_index( proc_p )].wakeups;
+    for ( std::size_t i = 0; i < wakeups.size(); ++i )
+    {
+        if ( wakeups[i].first == event_i )
+        {
+            wakeups[i].second++;
+            return;
+        }
+    }
+    wakeups.push_back( std::make_pair( event_i, sc_dt::uint64(1) ) );
+}
+
+//------------------------------------------------------------------------------
+//"sc_scheduler_profiler::begin_phase"
+//
+// This method ends the current scheduler phase and starts the given one.
+// The start of an evaluation phase starts a new delta cycle.
+//
+// Arguments:
+//     phase = phase being entered, PHASE_NONE if the scheduler is left.
+//------------------------------------------------------------------------------
+void
+sc_scheduler_profiler::begin_phase( phase_kind phase )
+{
+    sc_dt::uint64 now = now_ns();
+    if ( m_phase != PHASE_NONE )
+    {
+        sc_dt::uint64 ns = now - m_phase_start_ns;
+        m_phase_ns[m_phase] += ns;
+        m_step.ns[m_phase] += ns;
+        if ( m_in_delta )
+            m_delta.ns[m_phase] += ns;
+        if ( m_timeline )
+            add_timeline( m_phase_start_ns, now, m_phase );
+    }
+
+    if ( m_in_delta && ( phase == PHASE_NONE || phase == PHASE_EVALUATE ) )
+    {
+        if ( m_deltas.size() < RECORD_LIMIT )
+            m_deltas.push_back( m_delta );
+        else
+            m_truncated = true;
+        m_in_delta = false;
+    }
+    if ( phase == PHASE_EVALUATE )
+    {
+        m_delta = step_record();
+        m_delta.time = m_simc->time_stamp();
+        m_delta.deltas = m_delta_n++;
+        m_step.deltas++;
+        m_in_delta = true;
+    }
+
+    m_phase = phase;
+    m_phase_start_ns = now;
+}
+
+//------------------------------------------------------------------------------
+//"sc_scheduler_profiler::timestep"
+//
+// This method closes the record of the current time step, it is called
+// before the simulation time advances.
+//
+// Arguments:
+//     t = new simulation time.
+//------------------------------------------------------------------------------
+void
+sc_scheduler_profiler::timestep( const sc_time& t )
+{
+    if ( m_steps.size() < RECORD_LIMIT )
+        m_steps.push_back( m_step );
+    else
+        m_truncated = true;
+    m_step = step_record();
+    m_step.time = t;
+}
+
+//------------------------------------------------------------------------------
+//"sc_scheduler_profiler::updated"
+//
+// This method records the channel updates of the update phase just done.
+//
+// Arguments:
+//     updates   = number of channels updated.
+//     unchanged = number of those updates that changed nothing.
+//------------------------------------------------------------------------------
+void
+sc_scheduler_profiler::updated( int updates, int unchanged )
+{
+    m_updates += updates;
+    m_unchanged += unchanged;
+    m_step.updates += updates;
+    m_step.unchanged += unchanged;
+    if ( m_in_delta )
+    {
+        m_delta.updates += updates;
+        m_delta.unchanged += unchanged;
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_scheduler_profiler::finish"
+//
+// This method charges the host time up to now to the active process and
+// phase, it is called when recording ends.
+//------------------------------------------------------------------------------
+void
+sc_scheduler_profiler::finish()
+{
+    activate( nullptr );
+    begin_phase( PHASE_NONE );
+    m_trigger_p = nullptr;
+}
+
+void
+sc_scheduler_profiler::remove_event( const sc_event* event_p )
+{
+    m_event_index.erase( event_p );
+}
+
+void
+sc_scheduler_profiler::remove_process( const sc_process_b* proc_p )
+{
+    m_process_index.erase( proc_p );
+}
+
+std::size_t
+sc_scheduler_profiler::event_index( const sc_event* event_p )
+{
+    std::unordered_map<const sc_event*, std::size_t>::iterator it =
+        m_event_index.find( event_p );
+    if ( it != m_event_index.end() )
+        return it->second;
+
+    std::size_t i = m_events.size();
+    m_events.push_back( *event_p->name() ? event_p->name() : "(unnamed)" );
+    m_event_index[event_p] = i;
+    return i;
+}
+
+std::size_t
+sc_scheduler_profiler::process_index( sc_process_b* proc_p )
+{
+    std::unordered_map<const sc_process_b*, std::size_t>::iterator it =
+        m_process_index.find( proc_p );
+    if ( it != m_process_index.end() )
+        return it->second;
+
+    process_record rec = process_record();
+    rec.name = proc_p->name();
+    switch ( proc_p->proc_kind() )
+    {
+      case SC_METHOD_PROC_:  rec.kind = "method";  break;
+      case SC_THREAD_PROC_:  rec.kind = "thread";  break;
+      case SC_CTHREAD_PROC_: rec.kind = "cthread"; break;
+      default:               rec.kind = "none";    break;
+    }
+    std::size_t i = m_processes.size();
+    m_processes.push_back( rec );
+    m_process_index[proc_p] = i;
+    return i;
+}
+
+void
+sc_scheduler_profiler::add_timeline( sc_dt::uint64 start_ns,
+                                     sc_dt::uint64 now, int what )
+{
+    if ( m_records.size() >= RECORD_LIMIT )
+    {
+        m_truncated = true;
+        return;
+    }
+    timeline_record rec;
+    rec.start_ns = start_ns - m_origin_ns;
+    rec.duration_ns = now - start_ns;
+    rec.what = what;
+    rec.delta = m_in_delta ? m_delta.deltas : m_delta_n;
+    m_records.push_back( rec );
+}
+
+// ----------------------------------------------------------------------------
+//  Output
+// ----------------------------------------------------------------------------
+
+static std::string
+sc_json_string( const std::string& s )
+{
+    std::string result = "\"";
+    for ( std::size_t i = 0; i < s.size(); ++i )
+    {
+        unsigned char c = static_cast<unsigned char>( s[i] );
+        if ( c == '"' || c == '\\' ) {
+            result += '\\';
+            result += char(c);
+        } else if ( c < 0x20 ) {
+            char buf[8];
+            std::snprintf( buf, sizeof(buf), "\\u%04x", c );
+            result += buf;
+        } else {
+            result += char(c);
+        }
+    }
+    return result + "\"";
+}
+
+static std::string
+sc_csv_string( const std::string& s )
+{
+    std::string result = "\"";
+    for ( std::size_t i = 0; i < s.size(); ++i )
+    {
+        if ( s[i] == '"' )
+            result += '"';
+        result += s[i];
+    }
+    return result + "\"";
+}
+
+//------------------------------------------------------------------------------
+//"sc_scheduler_profiler::write"
+//
+// This method writes the profile to the files <basename>.json (everything),
+// <basename>.csv (processes), <basename>.deltas.csv, <basename>.timesteps.csv
+// and, if the timeline is recorded, <basename>.trace.json in the Chrome
+// trace event format.
+//
+// Arguments:
+//     basename = path and base name of the files.
+// Result is true if all files could be written.
+//------------------------------------------------------------------------------
+bool
+sc_scheduler_profiler::write( const std::string& basename ) const
+{
+    bool ok = write_json( basename + ".json" );
+    ok = write_csv( basename + ".csv" ) && ok;
+    ok = write_steps_csv( basename + ".deltas.csv", m_deltas, "delta" ) && ok;
+
+    std::vector<step_record> steps( m_steps );
+    if ( m_step.deltas != 0 )
+        steps.push_back( m_step );
+    ok = write_steps_csv( basename + ".timesteps.csv", steps, "deltas" ) && ok;
+    if ( m_timeline )
+        ok = write_trace( basename + ".trace.json" ) && ok;
+    return ok;
+}
+
+static void
+sc_write_step_json( std::ostream& os, const char* count_name,
+                    const sc_time& time, sc_dt::uint64 count,
+                    sc_dt::uint64 activations, sc_dt::uint64 updates,
+                    sc_dt::uint64 unchanged, const sc_dt::uint64* ns )
+{
+    os << "{\"time\":" << sc_json_string( time.to_string() )
+       << ",\"" << count_name << "\":" << count
+       << ",\"activations\":" << activations
+       << ",\"updates\":" << updates
+       << ",\"unchanged_updates\":" << unchanged;
+    for ( int p = 0; p < sc_scheduler_profiler::PHASE_N; ++p )
+        os << ",\"" << sc_phase_names[p] << "_ns\":" << ns[p];
+    os << "}";
+}
+
+bool
+sc_scheduler_profiler::write_json( const std::string& file_name ) const
+{
+    std::ofstream os( file_name.c_str() );
+    if ( !os )
+        return false;
+
+    // processes in order of decreasing host time
+
+    std::vector<std::size_t> order( m_processes.size() );
+    for ( std::size_t i = 0; i < order.size(); ++i )
+        order[i] = i;
+    std::stable_sort( order.begin(), order.end(),
+        [this]( std::size_t a, std::size_t b )
+            { return m_processes[a].host_ns > m_processes[b].host_ns; } );
+
+    sc_dt::uint64 total_ns = 0;
+    for ( int p = 0; p < PHASE_N; ++p )
+        total_ns += m_phase_ns[p];
+
+    os << "{\n\"host_ns\":" << total_ns
+       << ",\n\"phases\":{";
+    for ( int p = 0; p < PHASE_N; ++p )
+        os << ( p ? "," : "" ) << "\"" << sc_phase_names[p] << "_ns\":"
+           << m_phase_ns[p];
+    os << "},\n\"delta_cycles\":" << m_delta_n
+       << ",\n\"activations\":" << m_activations
+       << ",\n\"updates\":" << m_updates
+       << ",\n\"unchanged_updates\":" << m_unchanged
+       << ",\n\"truncated\":" << ( m_truncated ? "true" : "false" )
+       << ",\n\"processes\":[";
+
+    for ( std::size_t n = 0; n < order.size(); ++n )
+    {
+        const process_record& rec = m_processes[order[n]];
+        int last = HISTOGRAM_N - 1;
+        while ( last > 0 && rec.histogram[last] == 0 )
+            --last;
+
+        os << ( n ? ",\n" : "\n" )
+           << "{\"name\":" << sc_json_string( rec.name )
+           << ",\"kind\":\"" << rec.kind << "\""
+           << ",\"activations\":" << rec.activations
+           << ",\"context_switches\":" << rec.context_switches
+           << ",\"host_ns\":" << rec.host_ns
+           << ",\"max_ns\":" << rec.max_ns
+           << ",\"histogram_log2_ns\":[";
+        for ( int b = 0; b <= last; ++b )
+            os << ( b ? "," : "" ) << rec.histogram[b];
+        os << "],\"wakeups\":{";
+        for ( std::size_t w = 0; w < rec.wakeups.size(); ++w )
+            os << ( w ? "," : "" )
+               << sc_json_string( m_events[rec.wakeups[w].first] ) << ":"
+               << rec.wakeups[w].second;
+        os << "}}";
+    }
+
+    os << "\n],\n\"timesteps\":[";
+    std::size_t n = 0;
+    for ( ; n < m_steps.size(); ++n )
+    {
+        os << ( n ? ",\n" : "\n" );
+        sc_write_step_json( os, "deltas", m_steps[n].time, m_steps[n].deltas,
+                            m_steps[n].activations, m_steps[n].updates,
+                            m_steps[n].unchanged, m_steps[n].ns );
+    }
+    if ( m_step.deltas != 0 )
+    {
+        os << ( n ? ",\n" : "\n" );
+        sc_write_step_json( os, "deltas", m_step.time, m_step.deltas,
+                            m_step.activations, m_step.updates,
+                            m_step.unchanged, m_step.ns );
+    }
+
+    os << "\n],\n\"deltas\":[";
+    for ( n = 0; n < m_deltas.size(); ++n )
+    {
+        os << ( n ? ",\n" : "\n" );
+        sc_write_step_json( os, "delta", m_deltas[n].time, m_deltas[n].deltas,
+                            m_deltas[n].activations, m_deltas[n].updates,
+                            m_deltas[n].unchanged, m_deltas[n].ns );
+    }
+    os << "\n]\n}\n";
+    return bool( os );
+}
+
+bool
+sc_scheduler_profiler::write_csv( const std::string& file_name ) const
+{
+    std::ofstream os( file_name.c_str() );
+    if ( !os )
+        return false;
+
+    os << "name,kind,activations,context_switches,host_ns,max_ns,wakeups";
+    for ( int b = 0; b < HISTOGRAM_N; ++b )
+        os << ",h" << b;
+    os << "\n";
+
+    for ( std::size_t i = 0; i < m_processes.size(); ++i )
+    {
+        const process_record& rec = m_processes[i];
+        std::string wakeups;
+        for ( std::size_t w = 0; w < rec.wakeups.size(); ++w )
+        {
+            char buf[24];
+            std::snprintf( buf, sizeof(buf), "=%llu",
+                           (unsigned long long) rec.wakeups[w].second );
+            wakeups += ( w ? " " : "" ) + m_events[rec.wakeups[w].first] + buf;
+        }
+        os << sc_csv_string( rec.name ) << "," << rec.kind
+           << "," << rec.activations << "," << rec.context_switches
+           << "," << rec.host_ns << "," << rec.max_ns
+           << "," << sc_csv_string( wakeups );
+        for ( int b = 0; b < HISTOGRAM_N; ++b )
+            os << "," << rec.histogram[b];
+        os << "\n";
+    }
+    return bool( os );
+}
+
+bool
+sc_scheduler_profiler::write_steps_csv( const std::string& file_name,
+                                        const std::vector<step_record>& steps,
+                                        const char* count_name ) const
+{
+    std::ofstream os( file_name.c_str() );
+    if ( !os )
+        return false;
+
+    os << "time," << count_name << ",activations,updates,unchanged_updates";
+    for ( int p = 0; p < PHASE_N; ++p )
+        os << "," << sc_phase_names[p] << "_ns";
+    os << "\n";
+
+    for ( std::size_t i = 0; i < steps.size(); ++i )
+    {
+        os << steps[i].time.value() << "," << steps[i].deltas
+           << "," << steps[i].activations << "," << steps[i].updates
+           << "," << steps[i].unchanged;
+        for ( int p = 0; p < PHASE_N; ++p )
+            os << "," << steps[i].ns[p];
+        os << "\n";
+    }
+    return bool( os );
+}
+
+bool
+sc_scheduler_profiler::write_trace( const std::string& file_name ) const
+{
+    std::ofstream os( file_name.c_str() );
+    if ( !os )
+        return false;
+
+    // timestamps and durations are given in microseconds
+
+    char buf[64];
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+       << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+          "\"args\":{\"name\":\"scheduler\"}},\n"
+       << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,"
+          "\"args\":{\"name\":\"processes\"}}";
+    for ( std::size_t i = 0; i < m_records.size(); ++i )
+    {
+        const timeline_record& rec = m_records[i];
+        bool phase = rec.what < PHASE_N;
+        std::snprintf( buf, sizeof(buf), "\"ts\":%.3f,\"dur\":%.3f",
+                       double(rec.start_ns) / 1e3,
+                       double(rec.duration_ns) / 1e3 );
+        os << ",\n{\"name\":"
+           << ( phase ? std::string("\"") + sc_phase_names[rec.what] + "\""
+                      : sc_json_string( m_processes[rec.what - PHASE_N].name ) )
+           << ",\"cat\":\"" << ( phase ? "phase" : "process" )
+           << "\",\"ph\":\"X\"," << buf
+           << ",\"pid\":1,\"tid\":" << ( phase ? 1 : 2 )
+           << ",\"args\":{\"delta\":" << rec.delta << "}}";
+    }
+    os << "\n]}\n";
+    return bool( os );
+}
+
+} // namespace sc_core
+
+// Taf!
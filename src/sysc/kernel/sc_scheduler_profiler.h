@@ -0,0 +1,194 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_scheduler_profiler.h -- Activations and host time per process and per
+                             scheduler phase.
+                             DO NOT EXPORT THIS INCLUDE FILE.
+
+  CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_SCHEDULER_PROFILER_H
+#define SC_SCHEDULER_PROFILER_H
+
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_time.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Calls a hook of the profiler of simulator context simc_p, if profiling is
+// enabled. Profiling support is removed by defining SC_DISABLE_PROFILING.
+
+#if !defined( SC_DISABLE_PROFILING )
+#  define SC_DO_PROFILE_( simc_p, Hook ) \
+    do { if( SC_UNLIKELY_( (simc_p)->m_profiler != nullptr ) ) \
+             (simc_p)->m_profiler->Hook; } while( false )
+#else
+#  define SC_DO_PROFILE_( simc_p, Hook ) \
+    ((void)0) /* do nothing */
+#endif
+
+namespace sc_core {
+
+class sc_event;
+
+//=============================================================================
+//  CLASS : sc_scheduler_profiler
+//
+//  Records the scheduler activity while profiling is enabled, see
+//  sc_set_profiling():
+//
+//    - per process: the activations, the host time spent between the
+//      activation and the return to the scheduler (or the switch to the next
+//      thread), the context switches onto its stack, a histogram of the host
+//      time per activation and the events that made it runnable,
+//    - per delta cycle and per time step: the host time of the evaluation,
+//      update and notification phases, the number of activations and the
+//      number of channel updates, of which how many changed nothing,
+//    - optionally a timeline of all phases and activations.
+//
+//  Timed notifications are counted as notification phase of the time step
+//  but not of a delta cycle. Batches of isolated methods executed on the
+//  worker pool are charged to the first method of the batch.
+//
+//  The per delta records and the timeline are limited to a fixed number of
+//  entries, later entries are dropped and the profile is marked truncated.
+//
+//  FOR INTERNAL USE ONLY!
+//=============================================================================
+
+class sc_scheduler_profiler
+{
+    friend class sc_simcontext;
+
+  public:
+    enum phase_kind {
+        PHASE_NONE = -1,
+        PHASE_EVALUATE,
+        PHASE_UPDATE,
+        PHASE_NOTIFY,
+        PHASE_N
+    };
+
+    enum { HISTOGRAM_N = 32 };      // bucket i: [2^i, 2^(i+1)) ns.
+    enum { RECORD_LIMIT = 1 << 20 }; // per delta records and timeline.
+
+    // kernel hooks
+    void activate( sc_process_b* proc_p );
+    void wakeup( sc_process_b* proc_p );
+    void begin_phase( phase_kind phase );
+    void timestep( const sc_time& t );
+    void updated( int updates, int unchanged );
+    void trigger( const sc_event* event_p ) { m_trigger_p = event_p; }
+    void remove_event( const sc_event* event_p );
+    void remove_process( const sc_process_b* proc_p );
+
+  private:
+    struct process_record
+    {
+        std::string   name;
+        const char*   kind;
+        sc_dt::uint64 activations;
+        sc_dt::uint64 context_switches;
+        sc_dt::uint64 host_ns;
+        sc_dt::uint64 max_ns;
+        sc_dt::uint64 histogram[HISTOGRAM_N];
+        std::vector<std::pair<std::size_t, sc_dt::uint64> > wakeups;
+    };
+
+    struct step_record           // delta cycle or time step.
+    {
+        sc_time       time;
+        sc_dt::uint64 deltas;      // index of delta or deltas of time step.
+        sc_dt::uint64 activations;
+        sc_dt::uint64 updates;
+        sc_dt::uint64 unchanged;   // updates without a change.
+        sc_dt::uint64 ns[PHASE_N];
+    };
+
+    struct timeline_record
+    {
+        sc_dt::uint64 start_ns;
+        sc_dt::uint64 duration_ns;
+        int           what;         // phase_kind or PHASE_N + process.
+        sc_dt::uint64 delta;
+    };
+
+  private:
+    sc_scheduler_profiler( sc_simcontext* simc_p, bool timeline );
+
+    void finish();
+    bool write( const std::string& basename ) const;
+
+    std::size_t    event_index( const sc_event* event_p );
+    std::size_t    process_index( sc_process_b* proc_p );
+    void           add_timeline( sc_dt::uint64 start_ns, sc_dt::uint64 now,
+                                 int what );
+    sc_dt::uint64  now_ns() const;
+
+    bool write_json( const std::string& file_name ) const;
+    bool write_csv( const std::string& file_name ) const;
+    bool write_steps_csv( const std::string& file_name,
+                          const std::vector<step_record>& steps,
+                          const char* count_name ) const;
+    bool write_trace( const std::string& file_name ) const;
+
+  private:
+    sc_simcontext*                   m_simc;          // owning context.
+    bool                             m_timeline;      // record the timeline.
+    bool                             m_truncated;     // records were dropped.
+    sc_dt::uint64                    m_origin_ns;     // host time of creation.
+
+    std::vector<process_record>      m_processes;
+    std::unordered_map<const sc_process_b*, std::size_t> m_process_index;
+    std::vector<std::string>         m_events;        // names of events.
+    std::unordered_map<const sc_event*, std::size_t> m_event_index;
+    const sc_event*                  m_trigger_p;     // event being triggered.
+
+    std::size_t                      m_proc_i;        // active process or -1.
+    sc_dt::uint64                    m_proc_start_ns; // start of activation.
+
+    phase_kind                       m_phase;         // current phase.
+    sc_dt::uint64                    m_phase_start_ns;// start of phase.
+    sc_dt::uint64                    m_phase_ns[PHASE_N]; // totals.
+    sc_dt::uint64                    m_activations;   // total activations.
+    sc_dt::uint64                    m_updates;       // total updates.
+    sc_dt::uint64                    m_unchanged;     // of which unchanged.
+    sc_dt::uint64                    m_delta_n;       // deltas seen.
+
+    bool                             m_in_delta;      // m_delta is open.
+    step_record                      m_delta;         // current delta cycle.
+    step_record                      m_step;          // current time step.
+    std::vector<step_record>         m_deltas;
+    std::vector<step_record>         m_steps;
+    std::vector<timeline_record>     m_records;       // timeline.
+
+  private: // disabled
+    sc_scheduler_profiler( const sc_scheduler_profiler& );
+    sc_scheduler_profiler& operator = ( const sc_scheduler_profiler& );
+};
+
+} // namespace sc_core
+
+#endif // SC_SCHEDULER_PROFILER_H
+// Taf!
@@ -40,14 +40,18 @@
 #include "sysc/kernel/sc_module_registry.h"
 #include "sysc/kernel/sc_name_gen.h"
 #include "sysc/kernel/sc_object_manager.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_cthread_process.h"
 #include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_thread_process.h"
+#include "sysc/kernel/sc_timed_event_queue.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_reset.h"
+#include "sysc/kernel/sc_scheduler_profiler.h"
 #include "sysc/kernel/sc_ver.h"
 #include "sysc/kernel/sc_dynamic_processes.h"
 #include "sysc/kernel/sc_phase_callback_registry.h"
+#include "sysc/communication/sc_clock.h"
 #include "sysc/communication/sc_port.h"
 #include "sysc/communication/sc_export.h"
 #include "sysc/communication/sc_prim_channel.h"
@@ -58,6 +62,8 @@
 #include "sysc/utils/sc_utils_ids.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <sstream>
 
@@ -103,6 +109,14 @@ namespace sc_core {
 
 sc_stop_mode stop_mode = SC_STOP_FINISH_DELTA;
 
+// host time in seconds, for the elaboration statistics
+static double
+sc_host_seconds()
+{
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_process_table
 //
@@ -334,14 +348,44 @@ sc_simcontext::init()
     else
         m_write_check = SC_SIGNAL_WRITE_CHECK_DEFAULT_;
 
+    const char* timed_queue = std::getenv("SC_TIMED_EVENT_QUEUE");
+    sc_string_view timed_queue_s = (timed_queue != nullptr) ? timed_queue : "";
+    if ( timed_queue_s == "WHEEL" )
+        m_timed_events = new sc_timed_event_wheel;
+    else
+        m_timed_events = new sc_timed_event_heap;
+
+    const char* parallel = std::getenv("SC_PARALLEL_EVALUATION");
+    m_parallel_threads = 1;
+    if ( parallel != nullptr && std::atoi(parallel) > 1 )
+        m_parallel_threads = static_cast<unsigned>( std::atoi(parallel) );
+
+    const char* clock_engine = std::getenv("SC_CLOCK_ENGINE");
+    m_clock_engine = clock_engine != nullptr && std::atoi(clock_engine) != 0;
+
+    const char* port_resolution = std::getenv("SC_PORT_RESOLUTION");
+    m_port_resolution = port_resolution != nullptr &&
+                        std::atoi(port_resolution) != 0;
+    m_elaboration_stats = sc_elaboration_stats();
+
+    const char* profile = std::getenv("SC_PROFILE");
+    const char* profile_timeline = std::getenv("SC_PROFILE_TIMELINE");
+    m_profile_name = (profile != nullptr) ? profile : "";
+
     // FINISH INITIALIZATIONS:
 
     reset_curr_proc();
     m_next_proc_id = -1;
-    m_timed_events = new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare );
     m_something_to_trace = false;
     m_runnable = new sc_runnable;
     m_collectable = new sc_process_list;
+    m_parallel_evaluator = nullptr;
+    m_in_parallel_batch = false;
+    m_parallel_batch.clear();
+    m_clock_edge_pending = false;
+    m_clock_edges.clear();
+    m_profiler = nullptr;
+    m_profile = nullptr;
     m_time_params = new sc_time_params;
     m_curr_time = SC_ZERO_TIME;
     m_max_time = SC_ZERO_TIME;
@@ -362,6 +406,10 @@ sc_simcontext::init()
     m_start_of_simulation_called = false;
     m_end_of_simulation_called = false;
     m_simulation_status = SC_ELABORATION;
+
+    if ( !m_profile_name.empty() )
+        set_profiling( true, profile_timeline != nullptr &&
+                             std::atoi(profile_timeline) != 0 );
 }
 
 void
@@ -370,7 +418,13 @@ sc_simcontext::clean()
     // remove remaining zombie processes
     do_collect_processes();
 
+    write_requested_profile();
+    m_profiler = nullptr;
+    delete m_profile;
+    m_profile = nullptr;
+
     delete m_method_invoker_p;
+    delete m_parallel_evaluator;
     delete m_error;
     delete m_cor_pkg;
     delete m_time_params;
@@ -402,10 +456,15 @@ sc_simcontext::sc_simcontext() :
     m_object_manager(nullptr), m_module_registry(nullptr), m_port_registry(nullptr),
     m_export_registry(nullptr), m_prim_channel_registry(nullptr),
     m_phase_cb_registry(nullptr), m_name_gen(nullptr),
-    m_process_table(nullptr), m_current_writer(nullptr),
+    m_process_table(nullptr), m_current_writer(nullptr), m_writer_stamp(1),
     m_write_check(SC_SIGNAL_WRITE_CHECK_DEFAULT_), m_next_proc_id(-1),
-    m_timed_events(nullptr),
+    m_delta_batch_size(0), m_timed_events(nullptr),
     m_something_to_trace(false), m_runnable(nullptr), m_collectable(nullptr),
+    m_parallel_evaluator(nullptr), m_parallel_threads(1),
+    m_in_parallel_batch(false), m_parallel_batch(),
+    m_clock_engine(false), m_clock_edge_pending(false), m_clock_edges(),
+    m_port_resolution(false), m_elaboration_stats(),
+    m_profiler(nullptr), m_profile(nullptr), m_profile_name(),
     m_time_params(), m_curr_time(SC_ZERO_TIME), m_max_time(SC_ZERO_TIME),
     m_change_stamp(0), m_delta_count(0), m_initial_delta_count_at_current_time(0),
     m_forced_stop(false), m_paused(false),
@@ -473,7 +532,10 @@ sc_simcontext::crunch( bool once )
 	// EVALUATE PHASE
 
 	m_execution_phase = phase_evaluate;
-	bool empty_eval_phase = true;
+	SC_DO_PROFILE_( this,
+	    begin_phase( sc_scheduler_profiler::PHASE_EVALUATE ) );
+	bool empty_eval_phase = !m_clock_edge_pending; // edge counts as activity
+	m_clock_edge_pending = false;
 	while( true )
 	{
 
@@ -483,7 +545,14 @@ sc_simcontext::crunch( bool once )
 	    sc_method_handle method_h = pop_runnable_method();
 	    while( method_h != nullptr ) {
 		empty_eval_phase = false;
-		if ( !method_h->run_process() )
+		if ( m_parallel_evaluator && method_h->run_isolated() )
+		{
+		    if ( !run_isolated_methods( method_h ) )
+		    {
+			goto out;
+		    }
+		}
+		else if ( !method_h->run_process() )
 		{
 		    goto out;
 		}
@@ -529,12 +598,16 @@ sc_simcontext::crunch( bool once )
 	// will work.
 
 	m_execution_phase = phase_update;
+	SC_DO_PROFILE_( this, begin_phase( sc_scheduler_profiler::PHASE_UPDATE ) );
 	if ( !empty_eval_phase )
 	{
 //	    SC_DO_PHASE_CALLBACK_(evaluation_done);
 	    m_change_stamp++;
 	}
 	m_prim_channel_registry->perform_update();
+	SC_DO_PROFILE_( this,
+	    updated( m_prim_channel_registry->updates(),
+	             m_prim_channel_registry->unchanged_updates() ) );
 	SC_DO_PHASE_CALLBACK_(update_done);
 	m_execution_phase = phase_notify;
 
@@ -567,21 +640,13 @@ sc_simcontext::crunch( bool once )
 	// Process delta notifications which will queue processes for
 	// subsequent execution.
 
-        int size = m_delta_events.size();
-	if ( size != 0 )
-	{
-	    sc_event** l_events = &m_delta_events[0];
-	    int i = size - 1;
-	    do {
-		l_events[i]->trigger();
-	    } while( -- i >= 0 );
-	    m_delta_events.clear();
-	}
+	SC_DO_PROFILE_( this, begin_phase( sc_scheduler_profiler::PHASE_NOTIFY ) );
+	trigger_delta_events();
 
 	if ( !empty_eval_phase )
 		m_delta_count ++;
 
-	if( m_runnable->is_empty() ) {
+	if( m_runnable->is_empty() && m_delta_events.empty() ) {
 	    // no more runnable processes
 	    break;
 	}
@@ -601,9 +666,370 @@ sc_simcontext::crunch( bool once )
 out:
     this->reset_curr_proc();
     do_collect_processes();
+    SC_DO_PROFILE_( this, begin_phase( sc_scheduler_profiler::PHASE_NONE ) );
     if( m_error ) throw *m_error; // re-throw propagated error
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::run_isolated_methods"
+// |
+// | This method executes a batch of isolated method processes on the worker
+// | pool. The batch consists of the supplied method and all isolated methods
+// | directly following it on the run queue. The first method that cannot be
+// | executed in isolation is put back to the front of the run queue.
+// |
+// | Arguments:
+// |     method_h = first isolated method process, already popped.
+// | Result is false if an unfielded exception occurred, true if not.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::run_isolated_methods( sc_method_handle method_h )
+{
+    m_parallel_batch.clear();
+    m_parallel_batch.push_back( method_h );
+    for ( ;; )
+    {
+        method_h = m_runnable->pop_method();
+        if ( method_h == nullptr )
+            break;
+        if ( !method_h->run_isolated() )
+        {
+            m_runnable->execute_method_next( method_h );
+            break;
+        }
+        m_parallel_batch.push_back( method_h );
+    }
+
+    // A single method is not worth waking up the pool.
+
+    if ( m_parallel_batch.size() == 1 )
+    {
+        set_curr_proc( m_parallel_batch[0] );
+        return m_parallel_batch[0]->run_process();
+    }
+    return m_parallel_evaluator->run( m_parallel_batch );
+}
+
+sc_curr_proc_handle
+sc_simcontext::parallel_curr_proc_info() const
+{
+    return sc_parallel_evaluator::curr_proc_info();
+}
+
+sc_process_b*
+sc_simcontext::parallel_current_writer() const
+{
+    return sc_parallel_evaluator::current_writer();
+}
+
+void
+sc_simcontext::add_timed_event( sc_event_timed* et )
+{
+    m_timed_events->insert( et );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::remove_timed_event"
+// |
+// | This method cancels a pending timed notification. The entry is deleted
+// | right away, if the timed event queue is able to remove it. Otherwise it
+// | stays in the queue without an event until it reaches the top.
+// |
+// | Arguments:
+// |     et = entry of the cancelled notification.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::remove_timed_event( sc_event_timed* et )
+{
+    et->m_event = nullptr;
+    if ( m_timed_events->cancel( et ) )
+        delete et;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::add_clock / remove_clock"
+// |
+// | These methods register and unregister a clock whose edges are scheduled
+// | by the kernel (see sc_set_clock_engine()).
+// |
+// | Arguments:
+// |     clock_p    = clock to be (un)registered.
+// |     first_edge = absolute time of the first edge of the clock.
+// +----------------------------------------------------------------------------
+static bool
+sc_clock_edge_later( const std::pair<sc_time, sc_clock*>& a,
+                     const std::pair<sc_time, sc_clock*>& b )
+{
+    return b.first < a.first;
+}
+
+void
+sc_simcontext::add_clock( sc_clock* clock_p, const sc_time& first_edge )
+{
+    m_clock_edges.push_back( clock_edge( first_edge, clock_p ) );
+    std::push_heap( m_clock_edges.begin(), m_clock_edges.end(),
+                    sc_clock_edge_later );
+}
+
+void
+sc_simcontext::remove_clock( sc_clock* clock_p )
+{
+    std::vector<clock_edge>::iterator it = m_clock_edges.begin();
+    while ( it != m_clock_edges.end() && it->second != clock_p )
+        ++it;
+    if ( it == m_clock_edges.end() )
+        return;
+
+    m_clock_edges.erase( it );
+    std::make_heap( m_clock_edges.begin(), m_clock_edges.end(),
+                    sc_clock_edge_later );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::trigger_delta_events"
+// |
+// | This method triggers the events notified for the next delta cycle as one
+// | batch, in the reverse order of their notification. The static fan-out of
+// | each event is a flat array resolved during elaboration, the events further
+// | down the batch are prefetched while the current one is triggered. A
+// | process woken by several events of the batch is queued only once, since
+// | trigger_static() skips processes that are already runnable.
+// |
+// | A triggered event may notify the next delta cycle (see sc_event_queue),
+// | such events are appended behind the batch and kept for the next delta
+// | cycle. It may also cancel an event of the batch not triggered yet (e.g.
+// | the timeout of a process), which clears its entry in the batch (see
+// | remove_delta_event).
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::trigger_delta_events()
+{
+    int size = m_delta_events.size();
+    if ( size == 0 )
+        return;
+
+    m_delta_batch_size = size;
+    int i = size - 1;
+    do {
+        // the vector may grow while the batch is triggered
+        sc_event** l_events = &m_delta_events[0];
+#if defined(__GNUC__) || defined(__clang__)
+        if ( i > 0 )
+            __builtin_prefetch( l_events[i - 1] );
+#endif
+        if ( l_events[i] )
+            l_events[i]->trigger();
+    } while( -- i >= 0 );
+    m_delta_batch_size = 0;
+
+    // keep the events notified for the next delta cycle
+    int next = m_delta_events.size() - size;
+    if ( next > 0 ) {
+        sc_event** l_events = &m_delta_events[0];
+        for ( i = 0; i < next; ++i ) {
+            l_events[i] = l_events[size + i];
+            l_events[i]->m_delta_event_index = i;
+        }
+    }
+    m_delta_events.resize( next );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::trigger_clock_edges"
+// |
+// | This method performs all clock edges due at the current time. Each clock
+// | requests the update of its value, which takes place in the update phase
+// | of the next delta cycle just as if the edge process had been executed.
+// | The clock is then rescheduled for its following edge.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::trigger_clock_edges()
+{
+    while ( !m_clock_edges.empty() && m_clock_edges.front().first == m_curr_time )
+    {
+        std::pop_heap( m_clock_edges.begin(), m_clock_edges.end(),
+                       sc_clock_edge_later );
+        clock_edge& edge = m_clock_edges.back();
+        edge.first += edge.second->edge_action();
+        std::push_heap( m_clock_edges.begin(), m_clock_edges.end(),
+                        sc_clock_edge_later );
+        m_clock_edge_pending = true;
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::set_clock_engine"
+// |
+// | This method selects whether the edges of sc_clock instances are scheduled
+// | by the kernel or by edge processes. It may only be called before the
+// | end of elaboration, since clocks make their choice at that point.
+// |
+// | Arguments:
+// |     enable = true if the kernel shall schedule the clock edges.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::set_clock_engine( bool enable )
+{
+    if ( m_simulation_status != SC_ELABORATION )
+    {
+        SC_REPORT_ERROR( SC_ID_CLOCK_ENGINE_AFTER_ELABORATION_, "" );
+        return;
+    }
+    m_clock_engine = enable;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::set_port_resolution"
+// |
+// | This method selects whether signal ports access plain sc_signal channels
+// | directly rather than through the virtual interface methods. It may only
+// | be called before the end of elaboration, since the ports resolve their
+// | channels at that point.
+// |
+// | Arguments:
+// |     enable = true if the ports shall resolve their channels.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::set_port_resolution( bool enable )
+{
+    if ( m_simulation_status != SC_ELABORATION )
+    {
+        SC_REPORT_ERROR( SC_ID_PORT_RESOLUTION_AFTER_ELABORATION_, "" );
+        return;
+    }
+    m_port_resolution = enable;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::set_timed_event_queue"
+// |
+// | This method replaces the queue of pending timed notifications. Entries
+// | already present in the current queue are moved to the new one. It may
+// | only be called before the simulation has been started.
+// |
+// | Arguments:
+// |     queue_p = new queue, the simulation context takes ownership.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::set_timed_event_queue( sc_timed_event_queue* queue_p )
+{
+    if ( m_ready_to_simulate )
+    {
+        SC_REPORT_ERROR( SC_ID_TIMED_EVENT_QUEUE_AFTER_START_, "" );
+        delete queue_p;
+        return;
+    }
+    if ( queue_p == nullptr || queue_p == m_timed_events )
+        return;
+
+    while ( !m_timed_events->empty() )
+        queue_p->insert( m_timed_events->extract_top() );
+    delete m_timed_events;
+    m_timed_events = queue_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::set_parallel_evaluation"
+// |
+// | This method sets the number of host threads used for the execution of
+// | isolated method processes. It may only be called before the simulation
+// | has been started.
+// |
+// | Arguments:
+// |     threads = number of host threads, 0 and 1 disable the worker pool.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::set_parallel_evaluation( unsigned threads )
+{
+    if ( m_ready_to_simulate )
+    {
+        SC_REPORT_ERROR( SC_ID_PARALLEL_EVALUATION_AFTER_START_, "" );
+        return;
+    }
+#ifdef SC_DISABLE_ASYNC_UPDATES
+    if ( threads > 1 )
+    {
+        SC_REPORT_WARNING( SC_ID_PARALLEL_EVALUATION_UNSUPPORTED_, "" );
+        threads = 1;
+    }
+#endif
+    m_parallel_threads = threads ? threads : 1;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::set_profiling"
+// |
+// | This method starts or stops the recording of the scheduler profile.
+// | Recording may be started and stopped repeatedly, the recorded data is
+// | accumulated until the simulation context is reset.
+// |
+// | Arguments:
+// |     enable   = true if the profile shall be recorded.
+// |     timeline = true if the timeline of phases and activations shall be
+// |                recorded as well.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::set_profiling( bool enable, bool timeline )
+{
+#ifdef SC_DISABLE_PROFILING
+    if ( enable )
+        SC_REPORT_WARNING( SC_ID_PROFILING_UNSUPPORTED_, "" );
+#else
+    if ( enable )
+    {
+        if ( m_profile == nullptr )
+            m_profile = new sc_scheduler_profiler( this, timeline );
+        m_profile->m_timeline = timeline;
+        m_profiler = m_profile;
+    }
+    else if ( m_profiler != nullptr )
+    {
+        m_profiler->finish();
+        m_profiler = nullptr;
+    }
+#endif
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::write_profile"
+// |
+// | This method writes the scheduler profile recorded so far, see
+// | sc_scheduler_profiler::write() for the files being written.
+// |
+// | Arguments:
+// |     basename = path and base name of the files.
+// | Result is true if the profile was written.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::write_profile( const char* basename )
+{
+    if ( m_profile == nullptr || basename == nullptr )
+        return false;
+    if ( !m_profile->write( basename ) )
+    {
+        SC_REPORT_WARNING( SC_ID_PROFILE_WRITE_FAILED_, basename );
+        return false;
+    }
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::write_requested_profile"
+// |
+// | This method writes the profile requested by the environment variable
+// | SC_PROFILE. It is called at the end of the simulation, i.e., by sc_stop()
+// | or after sc_main() has returned, whichever comes first.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::write_requested_profile()
+{
+    if ( m_profile == nullptr || m_profile_name.empty() )
+        return;
+    m_profile->finish();
+    write_profile( m_profile_name.c_str() );
+    m_profile_name.clear();
+}
+
 inline
 void
 sc_simcontext::cycle( const sc_time& t)
@@ -634,6 +1060,7 @@ sc_simcontext::elaborate()
       new sc_invoke_method("$$$$kernel_module$$$$_invoke_method" );
 
     m_simulation_status = SC_BEFORE_END_OF_ELABORATION;
+    double start = sc_host_seconds();
     for( int cd = 0; cd != 4; /* empty */ )
     {
         cd  = m_port_registry->construction_done();
@@ -649,6 +1076,7 @@ sc_simcontext::elaborate()
 
     }
     SC_DO_PHASE_CALLBACK_(construction_done);
+    m_elaboration_stats.before_end_of_elaboration = sc_host_seconds() - start;
 
     // SIGNAL THAT ELABORATION IS DONE
     //
@@ -659,11 +1087,19 @@ sc_simcontext::elaborate()
     m_elaboration_done = true;
     m_simulation_status = SC_END_OF_ELABORATION;
 
+    start = sc_host_seconds();
+    m_elaboration_stats.ports = m_port_registry->size();
+    m_elaboration_stats.exports = m_export_registry->size();
+    m_elaboration_stats.bound_interfaces = m_port_registry->complete_binding();
+    m_elaboration_stats.port_binding = sc_host_seconds() - start;
+
+    start = sc_host_seconds();
     m_port_registry->elaboration_done();
     m_export_registry->elaboration_done();
     m_prim_channel_registry->elaboration_done();
     m_module_registry->elaboration_done();
     SC_DO_PHASE_CALLBACK_(elaboration_done);
+    m_elaboration_stats.end_of_elaboration = sc_host_seconds() - start;
     sc_reset::reconcile_resets(m_reset_finder_q);
 
     // check for call(s) to sc_stop
@@ -687,14 +1123,23 @@ sc_simcontext::prepare_to_simulate()
     m_cor_pkg = new sc_cor_pkg_t( this );
     m_cor = m_cor_pkg->get_main();
 
+    // start the worker pool for isolated method processes, if requested
+#ifndef SC_DISABLE_ASYNC_UPDATES
+    if ( m_parallel_threads > 1 )
+        m_parallel_evaluator =
+            new sc_parallel_evaluator( this, m_parallel_threads );
+#endif
+
     // NOTIFY ALL OBJECTS THAT SIMULATION IS ABOUT TO START:
 
     m_simulation_status = SC_START_OF_SIMULATION;
+    double start = sc_host_seconds();
     m_port_registry->start_simulation();
     m_export_registry->start_simulation();
     m_prim_channel_registry->start_simulation();
     m_module_registry->start_simulation();
     SC_DO_PHASE_CALLBACK_(start_simulation);
+    m_elaboration_stats.start_of_simulation = sc_host_seconds() - start;
     m_start_of_simulation_called = true;
 
     // CHECK FOR CALL(S) TO sc_stop
@@ -722,8 +1167,6 @@ sc_simcontext::prepare_to_simulate()
     m_prim_channel_registry->perform_update();
     m_execution_phase = phase_notify;
 
-    int size;
-
     // make all method processes runnable
 
     for ( method_p = m_process_table->method_q_head();
@@ -776,16 +1219,13 @@ sc_simcontext::prepare_to_simulate()
     }
 
 
+    // perform clock edges at the start time
+
+    trigger_clock_edges();
+
     // process delta notifications
 
-    if( ( size = m_delta_events.size() ) != 0 ) {
-        sc_event** l_delta_events = &m_delta_events[0];
-        int i = size - 1;
-        do {
-            l_delta_events[i]->trigger();
-        } while( -- i >= 0 );
-        m_delta_events.clear();
-    }
+    trigger_delta_events();
 
     SC_DO_PHASE_CALLBACK_(initialization_done);
 }
@@ -793,7 +1233,8 @@ sc_simcontext::prepare_to_simulate()
 void
 sc_simcontext::initial_crunch( bool no_crunch )
 {
-    if( no_crunch || m_runnable->is_empty() ) {
+    if( no_crunch || ( m_runnable->is_empty() && !m_clock_edge_pending &&
+                       m_delta_events.empty() ) ) {
         return;
     }
 
@@ -915,17 +1356,23 @@ sc_simcontext::simulate( const sc_time& duration )
 
 	    // PROCESS TIMED NOTIFICATIONS AT THE CURRENT TIME
 
-	    do {
+	    SC_DO_PROFILE_( this,
+	        begin_phase( sc_scheduler_profiler::PHASE_NOTIFY ) );
+	    while( !m_timed_events->empty() &&
+		   m_timed_events->top()->notify_time() == t ) {
 		sc_event_timed* et = m_timed_events->extract_top();
 		sc_event* e = et->event();
 		delete et;
 		if( e != nullptr ) {
 		    e->trigger();
 		}
-	    } while( !m_timed_events->empty() &&
-		     m_timed_events->top()->notify_time() == t );
+	    }
+	    trigger_clock_edges();
+	    SC_DO_PROFILE_( this,
+	        begin_phase( sc_scheduler_profiler::PHASE_NONE ) );
 
-	} while( m_runnable->is_empty() );
+	} while( m_runnable->is_empty() && !m_clock_edge_pending &&
+	         m_delta_events.empty() );
     } while ( t < until_t ); // hold off on the delta for the until_t time.
 
 exit_time:  // final simulation time update, if needed
@@ -950,6 +1397,7 @@ sc_simcontext::do_timestep(const sc_time& t)
     }
 #endif
 
+    SC_DO_PROFILE_( this, timestep( t ) );
     m_curr_time = t;
     m_change_stamp++;
     m_initial_delta_count_at_current_time = m_delta_count;
@@ -1038,6 +1486,7 @@ sc_simcontext::end()
     m_module_registry->simulation_done();
     SC_DO_PHASE_CALLBACK_(simulation_done);
     m_end_of_simulation_called = true;
+    write_requested_profile();
 }
 
 void
@@ -1371,15 +1820,22 @@ sc_simcontext::is_running() const
 bool
 sc_simcontext::next_time( sc_time& result ) const
 {
+    bool found = false;
     while( !m_timed_events->empty() ) {
 	sc_event_timed* et = m_timed_events->top();
 	if( et->event() != nullptr ) {
 	    result = et->notify_time();
-	    return true;
+	    found = true;
+	    break;
 	}
 	delete m_timed_events->extract_top();
     }
-    return false;
+    if( !m_clock_edges.empty() &&
+        ( !found || m_clock_edges.front().first < result ) ) {
+	result = m_clock_edges.front().first;
+	found = true;
+    }
+    return found;
 }
 
 void
@@ -1388,6 +1844,14 @@ sc_simcontext::remove_delta_event( sc_event* e )
     int i = e->m_delta_event_index;
     int j = m_delta_events.size() - 1;
     sc_assert( i >= 0 && i <= j );
+
+    // an event of the batch being triggered is skipped (see
+    // trigger_delta_events), the events behind it are removed as usual
+    if( i < m_delta_batch_size ) {
+        m_delta_events[i] = nullptr;
+        e->m_delta_event_index = -1;
+        return;
+    }
     if( i != j ) {
 	sc_event** l_delta_events = &m_delta_events[0];
 	l_delta_events[i] = l_delta_events[j];
@@ -1479,6 +1943,7 @@ sc_simcontext::preempt_with( sc_method_handle method_h )
 	sc_get_curr_simcontext()->set_curr_proc( (sc_process_b*)method_h );
 	method_h->run_process();
 	m_curr_proc_info = caller_info;
+	++m_writer_stamp;
     }
 }
 
@@ -1839,6 +2304,143 @@ sc_defunct_process_function( sc_module* )
     sc_assert( false );
 }
 
+//------------------------------------------------------------------------------
+//"sc_set_parallel_evaluation"
+//
+// This function sets the number of host threads used to execute isolated
+// method processes during the evaluation phase. A value of 1 (the default)
+// results in a purely sequential evaluation. The environment variable
+// SC_PARALLEL_EVALUATION provides the initial value.
+//------------------------------------------------------------------------------
+SC_API void sc_set_parallel_evaluation( unsigned threads )
+{
+    sc_get_curr_simcontext()->set_parallel_evaluation( threads );
+}
+
+SC_API unsigned
+sc_get_parallel_evaluation()
+{
+    return sc_get_curr_simcontext()->parallel_evaluation();
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_timed_event_queue"
+//
+// These functions select the implementation of the queue holding pending
+// timed notifications. They may be called until the simulation is started.
+// The environment variable SC_TIMED_EVENT_QUEUE=WHEEL selects the timing
+// wheel as initial queue.
+//------------------------------------------------------------------------------
+SC_API void sc_set_timed_event_queue( sc_timed_event_queue_kind kind )
+{
+    sc_timed_event_queue* queue_p = nullptr;
+    switch( kind )
+    {
+      case SC_TIMED_EVENT_HEAP:
+          queue_p = new sc_timed_event_heap;
+          break;
+      case SC_TIMED_EVENT_WHEEL:
+          queue_p = new sc_timed_event_wheel;
+          break;
+      default:
+          return;
+    }
+    sc_get_curr_simcontext()->set_timed_event_queue( queue_p );
+}
+
+SC_API void sc_set_timed_event_queue( sc_timed_event_queue* queue_p )
+{
+    sc_get_curr_simcontext()->set_timed_event_queue( queue_p );
+}
+
+SC_API const sc_timed_event_queue*
+sc_get_timed_event_queue()
+{
+    return sc_get_curr_simcontext()->timed_event_queue();
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_clock_engine"
+//
+// This function selects whether the edges of sc_clock instances are
+// scheduled directly by the kernel rather than by an edge process per clock
+// edge. The observable behaviour of the clocks is the same in both cases.
+// It may be called until the end of elaboration. The environment variable
+// SC_CLOCK_ENGINE=1 provides the initial value.
+//------------------------------------------------------------------------------
+SC_API void sc_set_clock_engine( bool enable )
+{
+    sc_get_curr_simcontext()->set_clock_engine( enable );
+}
+
+SC_API bool
+sc_get_clock_engine()
+{
+    return sc_get_curr_simcontext()->clock_engine();
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_port_resolution"
+//
+// This function selects whether the signal ports (sc_in, sc_inout, sc_out)
+// resolve their channel at the end of elaboration: if it is a plain
+// sc_signal, read() and write() access it directly instead of calling the
+// virtual interface methods. The observable behaviour is the same in both
+// cases. It may be called until the end of elaboration. The environment
+// variable SC_PORT_RESOLUTION=1 provides the initial value.
+//------------------------------------------------------------------------------
+SC_API void sc_set_port_resolution( bool enable )
+{
+    sc_get_curr_simcontext()->set_port_resolution( enable );
+}
+
+SC_API bool
+sc_get_port_resolution()
+{
+    return sc_get_curr_simcontext()->port_resolution();
+}
+
+//------------------------------------------------------------------------------
+//"sc_get_elaboration_stats"
+//
+// This function returns the host time spent in the elaboration stages of the
+// current simulation context and the number of ports, exports and interfaces
+// bound to ports. A stage that has not been completed yet reports zero.
+//------------------------------------------------------------------------------
+SC_API sc_elaboration_stats
+sc_get_elaboration_stats()
+{
+    return sc_get_curr_simcontext()->elaboration_stats();
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_profiling"
+//
+// This function starts or stops the recording of the scheduler profile:
+// activations, host time, context switches and wakeup events per process
+// and the host time of the scheduler phases per delta cycle and time step.
+// The profile is written with sc_write_profile(). The environment variable
+// SC_PROFILE=<basename> starts the recording at the beginning and writes
+// the profile at sc_stop() or at the end of the program,
+// SC_PROFILE_TIMELINE=1 adds the timeline.
+//------------------------------------------------------------------------------
+SC_API void sc_set_profiling( bool enable, bool timeline )
+{
+    sc_get_curr_simcontext()->set_profiling( enable, timeline );
+}
+
+SC_API bool
+sc_get_profiling()
+{
+    return sc_get_curr_simcontext()->profiling();
+}
+
+SC_API bool
+sc_write_profile( const char* basename )
+{
+    return sc_get_curr_simcontext()->write_profile( basename );
+}
+
 //------------------------------------------------------------------------------
 //"sc_set_stop_mode"
 //
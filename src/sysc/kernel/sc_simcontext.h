@@ -46,6 +46,7 @@ namespace sc_core {
 
 // forward declarations
 
+class sc_clock;
 class sc_cor;
 class sc_cor_pkg;
 class sc_event;
@@ -57,6 +58,7 @@ class sc_module_registry;
 class sc_name_gen;
 class sc_object;
 class sc_object_manager;
+class sc_parallel_evaluator;
 class sc_phase_callback_registry;
 class sc_process_handle;
 class sc_port_registry;
@@ -66,9 +68,11 @@ class sc_signal_bool_deval;
 class sc_trace_file;
 class sc_runnable;
 class sc_process_host;
+class sc_scheduler_profiler;
 class sc_method_process;
 class sc_cthread_process;
 class sc_thread_process;
+class sc_timed_event_queue;
 class sc_reset_finder;
 
 
@@ -91,6 +95,61 @@ enum sc_stop_mode {          // sc_stop modes:
 extern SC_API void sc_set_stop_mode( sc_stop_mode mode );
 extern SC_API sc_stop_mode sc_get_stop_mode();
 
+// number of host threads executing isolated method processes (1: sequential)
+extern SC_API void sc_set_parallel_evaluation( unsigned threads );
+extern SC_API unsigned sc_get_parallel_evaluation();
+
+enum sc_timed_event_queue_kind { // implementations of the timed event queue:
+    SC_TIMED_EVENT_HEAP,         // binary heap (default)
+    SC_TIMED_EVENT_WHEEL         // timing wheel (calendar queue)
+};
+extern SC_API void sc_set_timed_event_queue( sc_timed_event_queue_kind kind );
+extern SC_API void sc_set_timed_event_queue( sc_timed_event_queue* queue_p );
+extern SC_API const sc_timed_event_queue* sc_get_timed_event_queue();
+
+// clock edges scheduled by the kernel instead of edge processes
+extern SC_API void sc_set_clock_engine( bool enable );
+extern SC_API bool sc_get_clock_engine();
+
+// signal ports bound to plain sc_signal channels access them directly
+extern SC_API void sc_set_port_resolution( bool enable );
+extern SC_API bool sc_get_port_resolution();
+
+// host time of the elaboration stages in seconds, filled in as they complete
+struct SC_API sc_elaboration_stats
+{
+    double      before_end_of_elaboration; // incl. repeated callbacks
+    double      port_binding;              // port binding resolution
+    double      end_of_elaboration;
+    double      start_of_simulation;
+    std::size_t ports;                     // registered ports
+    std::size_t exports;                   // registered exports
+    std::size_t bound_interfaces;          // sum over all ports
+};
+extern SC_API sc_elaboration_stats sc_get_elaboration_stats();
+
+// pool of thread stacks, only the QuickThreads package pools its stacks
+struct SC_API sc_stack_pool_stats
+{
+    std::size_t stacks_mapped;       // stacks allocated from the system
+    std::size_t stacks_reused;       // stacks taken from the pool
+    std::size_t stacks_in_use;       // stacks of existing coroutines
+    std::size_t stacks_pooled;       // stacks kept for reuse
+    std::size_t peak_stacks_in_use;
+    std::size_t mapped_bytes;        // in use and pooled, w/o red zones
+    std::size_t pooled_bytes;
+    std::size_t resident_bytes;      // stack pages backed by memory
+    std::size_t peak_resident_bytes; // maximum of the sampled resident_bytes
+};
+extern SC_API void sc_set_stack_pool_limit( std::size_t bytes );
+extern SC_API std::size_t sc_get_stack_pool_limit();
+extern SC_API sc_stack_pool_stats sc_get_stack_pool_stats();
+
+// scheduler profiler: activations and host time per process and phase
+extern SC_API void sc_set_profiling( bool enable, bool timeline = false );
+extern SC_API bool sc_get_profiling();
+extern SC_API bool sc_write_profile( const char* basename );
+
 enum sc_starvation_policy 
 {
     SC_EXIT_ON_STARVATION,
@@ -152,6 +211,7 @@ class SC_API sc_simcontext
     friend class sc_time_tuple;
     friend class sc_clock;
     friend class sc_method_process;
+    friend class sc_parallel_evaluator;
     friend class sc_phase_callback_registry;
     friend class sc_process_b;
     friend class sc_process_handle;
@@ -252,9 +312,30 @@ public:
     sc_process_b* get_current_writer() const;
     bool write_check() const;
     bool write_check_conflicts_only() const;
+    sc_dt::uint64 writer_stamp() const;
     void set_curr_proc( sc_process_b* );
     void reset_curr_proc();
 
+    void set_parallel_evaluation( unsigned threads );
+    unsigned parallel_evaluation() const;
+    bool in_parallel_batch() const;
+
+    void set_timed_event_queue( sc_timed_event_queue* queue_p );
+    const sc_timed_event_queue* timed_event_queue() const;
+
+    void set_clock_engine( bool enable );
+    bool clock_engine() const;
+
+    void set_port_resolution( bool enable );
+    bool port_resolution() const;
+    const sc_elaboration_stats& elaboration_stats() const
+        { return m_elaboration_stats; }
+
+    void set_profiling( bool enable, bool timeline );
+    bool profiling() const;
+    bool write_profile( const char* basename );
+    void write_requested_profile();
+
     int next_proc_id();
 
     void add_trace_file( sc_trace_file* );
@@ -301,10 +382,20 @@ private:
     void remove_child_object( sc_object* );
 
     void crunch( bool once=false );
+    bool run_isolated_methods( sc_method_handle );
+
+    sc_curr_proc_handle parallel_curr_proc_info() const;
+    sc_process_b* parallel_current_writer() const;
 
     int add_delta_event( sc_event* );
     void remove_delta_event( sc_event* );
+    void trigger_delta_events();
     void add_timed_event( sc_event_timed* );
+    void remove_timed_event( sc_event_timed* );
+
+    void add_clock( sc_clock*, const sc_time& first_edge );
+    void remove_clock( sc_clock* );
+    void trigger_clock_edges();
 
     void trace_cycle( bool delta_cycle );
 
@@ -358,6 +449,7 @@ private:
     sc_process_table*           m_process_table;
     sc_curr_proc_info           m_curr_proc_info;
     sc_process_b*               m_current_writer;
+    sc_dt::uint64               m_writer_stamp;       // see writer_stamp().
     sc_signal_write_check       m_write_check;
     int                         m_next_proc_id;
 
@@ -367,7 +459,8 @@ private:
     std::vector<sc_object*>     m_child_objects;
 
     std::vector<sc_event*>      m_delta_events;
-    sc_ppq<sc_event_timed*>*    m_timed_events;
+    int                         m_delta_batch_size; // being triggered.
+    sc_timed_event_queue*       m_timed_events;
 
     std::vector<sc_trace_file*> m_trace_files;
     bool                        m_something_to_trace;
@@ -375,6 +468,23 @@ private:
     sc_runnable*                m_runnable;
     sc_process_list*            m_collectable;
 
+    sc_parallel_evaluator*      m_parallel_evaluator; // worker pool or null.
+    unsigned                    m_parallel_threads;   // requested host threads.
+    bool                        m_in_parallel_batch;  // batch is executing.
+    std::vector<sc_method_handle> m_parallel_batch;   // isolated methods.
+
+    typedef std::pair<sc_time, sc_clock*> clock_edge;
+    bool                        m_clock_engine;       // kernel driven clocks.
+    bool                        m_clock_edge_pending; // edge update requested.
+    std::vector<clock_edge>     m_clock_edges;        // next edges, min heap.
+
+    bool                        m_port_resolution;    // direct signal access.
+    sc_elaboration_stats        m_elaboration_stats;  // elaboration timing.
+
+    sc_scheduler_profiler*      m_profiler;       // profile being recorded.
+    sc_scheduler_profiler*      m_profile;        // recorded profile or null.
+    std::string                 m_profile_name;   // written at end, if set.
+
     sc_time_params*             m_time_params;
     sc_time                     m_curr_time;
     mutable sc_time             m_max_time;
@@ -426,6 +536,7 @@ sc_get_curr_simcontext()
 #else
     extern SC_API sc_simcontext* sc_get_curr_simcontext();
 #endif // 0
+
 inline sc_status sc_get_status()
 {
     return sc_get_curr_simcontext()->get_status();
@@ -503,6 +614,9 @@ inline
 sc_curr_proc_handle
 sc_simcontext::get_curr_proc_info()
 {
+    if( SC_UNLIKELY_( m_in_parallel_batch ) ) {
+        return parallel_curr_proc_info();
+    }
     return &m_curr_proc_info;
 }
 
@@ -601,10 +715,45 @@ sc_simcontext::add_delta_event( sc_event* e )
 }
 
 inline
-void
-sc_simcontext::add_timed_event( sc_event_timed* et )
+unsigned
+sc_simcontext::parallel_evaluation() const
+{
+    return m_parallel_threads;
+}
+
+inline
+bool
+sc_simcontext::in_parallel_batch() const
+{
+    return m_in_parallel_batch;
+}
+
+inline
+const sc_timed_event_queue*
+sc_simcontext::timed_event_queue() const
+{
+    return m_timed_events;
+}
+
+inline
+bool
+sc_simcontext::clock_engine() const
+{
+    return m_clock_engine;
+}
+
+inline
+bool
+sc_simcontext::port_resolution() const
+{
+    return m_port_resolution;
+}
+
+inline
+bool
+sc_simcontext::profiling() const
 {
-    m_timed_events->insert( et );
+    return m_profiler != nullptr;
 }
 
 // ----------------------------------------------------------------------------
@@ -612,6 +761,9 @@ sc_simcontext::add_timed_event( sc_event_timed* et )
 inline sc_process_b*
 sc_simcontext::get_current_writer() const
 {
+    if( SC_UNLIKELY_( m_in_parallel_batch ) ) {
+        return parallel_current_writer();
+    }
     return m_current_writer;
 }
 
@@ -621,6 +773,16 @@ sc_simcontext::write_check() const
     return m_write_check != SC_SIGNAL_WRITE_CHECK_DISABLE_;
 }
 
+// Stamp of the current writer of signals (see sc_writer_policy_check_write).
+// It changes whenever the current process changes, and is
+// SC_WRITER_STAMP_NONE_ while a batch of isolated methods is executing.
+
+inline sc_dt::uint64
+sc_simcontext::writer_stamp() const
+{
+    return m_writer_stamp;
+}
+
 // ----------------------------------------------------------------------------
 
 class sc_process_handle;
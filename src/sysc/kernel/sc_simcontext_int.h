@@ -35,6 +35,7 @@
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_runnable.h"
 #include "sysc/kernel/sc_runnable_int.h"
+#include "sysc/kernel/sc_scheduler_profiler.h"
 
 // DEBUGGING MACROS:
 //
@@ -76,6 +77,11 @@ sc_get_current_process_name( const char * if_empty = NULL )
     return result;
 }
 
+// sc_simcontext::writer_stamp() while a batch of isolated methods is
+// executing, the writers of signals are looked up on every write.
+
+const sc_dt::uint64 SC_WRITER_STAMP_NONE_ = ~sc_dt::uint64( 0 );
+
 // We use m_current_writer rather than m_curr_proc_info.process_handle to
 // return the active process for sc_signal<T>::check_write since that lets
 // us turn it off a library compile time, and only incur the overhead at
@@ -90,6 +96,7 @@ sc_simcontext::set_curr_proc( sc_process_b* process_h )
     m_curr_proc_info.kind           = process_h->proc_kind();
     m_current_writer =
       (m_write_check != SC_SIGNAL_WRITE_CHECK_DISABLE_) ? process_h : 0;
+    ++m_writer_stamp;
 }
 
 inline
@@ -99,7 +106,9 @@ sc_simcontext::reset_curr_proc()
     m_curr_proc_info.process_handle = 0;
     m_curr_proc_info.kind           = SC_NO_PROC_;
     m_current_writer                = 0;
+    ++m_writer_stamp;
     sc_process_b::m_last_created_process_p = 0;
+    SC_DO_PROFILE_( this, activate( nullptr ) );
 }
 
 inline
@@ -177,6 +186,7 @@ sc_simcontext::preempt_with( sc_thread_handle thread_h )
 	set_curr_proc( (sc_process_b*)thread_h );
 	m_cor_pkg->yield( thread_h->m_cor_p );
 	m_curr_proc_info = caller_info;
+	++m_writer_stamp;
         DEBUG_MSG(DEBUG_NAME, thread_h, "back from preempting method w/thread");
 	method_p->check_for_throws();
     }
@@ -218,6 +228,7 @@ void
 sc_simcontext::push_runnable_method( sc_method_handle method_h )
 {
     m_runnable->push_back_method( method_h );
+    SC_DO_PROFILE_( this, wakeup( method_h ) );
 }
 
 inline
@@ -225,6 +236,7 @@ void
 sc_simcontext::push_runnable_method_front( sc_method_handle method_h )
 {
     m_runnable->push_front_method( method_h );
+    SC_DO_PROFILE_( this, wakeup( method_h ) );
 }
 
 inline
@@ -232,6 +244,7 @@ void
 sc_simcontext::push_runnable_thread( sc_thread_handle thread_h )
 {
     m_runnable->push_back_thread( thread_h );
+    SC_DO_PROFILE_( this, wakeup( thread_h ) );
 }
 
 inline
@@ -239,6 +252,7 @@ void
 sc_simcontext::push_runnable_thread_front( sc_thread_handle thread_h )
 {
     m_runnable->push_front_thread( thread_h );
+    SC_DO_PROFILE_( this, wakeup( thread_h ) );
 }
 
 
@@ -252,6 +266,7 @@ sc_simcontext::pop_runnable_method()
 	return 0;
     }
     set_curr_proc( (sc_process_b*)method_h );
+    SC_DO_PROFILE_( this, activate( method_h ) );
     return method_h;
 }
 
@@ -265,6 +280,7 @@ sc_simcontext::pop_runnable_thread()
 	return 0;
     }
     set_curr_proc( (sc_process_b*)thread_h );
+    SC_DO_PROFILE_( this, activate( thread_h ) );
     return thread_h;
 }
 
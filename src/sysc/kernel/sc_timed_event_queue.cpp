@@ -0,0 +1,458 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timed_event_queue.cpp -- Queues of pending timed event notifications.
+
+  CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_timed_event_queue.h"
+
+#include <algorithm>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_event_heap
+//
+//  Binary heap of timed notifications.
+// ----------------------------------------------------------------------------
+
+sc_timed_event_heap::sc_timed_event_heap()
+  : m_heap()
+{
+    m_heap.reserve( 129 );
+    m_heap.push_back( nullptr ); // index 0 is not used
+}
+
+void
+sc_timed_event_heap::insert( sc_event_timed* et )
+{
+    m_heap.push_back( et );
+    sift_up( m_heap.size() - 1, et );
+}
+
+sc_event_timed*
+sc_timed_event_heap::extract_top()
+{
+    sc_event_timed* top_p = m_heap[1];
+    sc_event_timed* last_p = m_heap.back();
+    m_heap.pop_back();
+    if( m_heap.size() > 1 ) {
+        set( 1, last_p );
+        heapify( 1 );
+    }
+    return top_p;
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_heap::remove"
+//
+// This method removes an arbitrary entry. The last entry takes its place and
+// is moved up or down as needed.
+//------------------------------------------------------------------------------
+bool
+sc_timed_event_heap::remove( sc_event_timed* et )
+{
+    std::size_t i = queue_index( et );
+    sc_assert( i < m_heap.size() && m_heap[i] == et );
+
+    sc_event_timed* last_p = m_heap.back();
+    m_heap.pop_back();
+    if( i < m_heap.size() ) {
+        if( i > 1 && notify_time( last_p ) < notify_time( m_heap[i >> 1] ) ) {
+            sift_up( i, last_p );
+        } else {
+            set( i, last_p );
+            heapify( i );
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_heap::sift_up / heapify"
+//
+// These methods restore the heap property upwards from a free position i
+// for entry et, and downwards from position i. They follow sc_ppq_base.
+//------------------------------------------------------------------------------
+void
+sc_timed_event_heap::sift_up( std::size_t i, sc_event_timed* et )
+{
+    while( i > 1 && notify_time( et ) < notify_time( m_heap[i >> 1] ) ) {
+        set( i, m_heap[i >> 1] );
+        i >>= 1;
+    }
+    set( i, et );
+}
+
+void
+sc_timed_event_heap::heapify( std::size_t i )
+{
+    std::size_t size = m_heap.size() - 1;
+    std::size_t l;
+    while( l = i << 1, l <= size ) {
+        std::size_t earliest =
+            notify_time( m_heap[l] ) < notify_time( m_heap[i] ) ? l : i;
+
+        std::size_t r = l + 1;
+        if( r <= size &&
+            notify_time( m_heap[r] ) < notify_time( m_heap[earliest] ) ) {
+            earliest = r;
+        }
+
+        if( earliest == i ) {
+            break;
+        }
+        sc_event_timed* tmp = m_heap[i];
+        set( i, m_heap[earliest] );
+        set( earliest, tmp );
+        i = earliest;
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_event_wheel
+//
+//  Timing wheel (calendar queue) of timed notifications.
+// ----------------------------------------------------------------------------
+
+// Number of insertions after which the slot width is reconsidered.
+
+static const std::size_t SC_WHEEL_EPOCH = 1024;
+
+// The ring shall span this multiple of the average notification delay.
+
+static const double SC_WHEEL_SPAN = 16.0;
+
+// Position of entries outside of the ring.
+
+static const std::size_t SC_WHEEL_NPOS = ~std::size_t(0);
+
+// Ordering of the ready list and the overflow heap, latest entry first.
+
+struct sc_wheel_later
+{
+    template< typename Entry >
+    bool operator()( const Entry& a, const Entry& b ) const
+        { return b < a; }
+};
+
+static inline unsigned
+sc_wheel_ctz( sc_dt::uint64 w )
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>( __builtin_ctzll( w ) );
+#else
+    unsigned n = 0;
+    while( !( w & 1 ) ) { w >>= 1; ++n; }
+    return n;
+#endif
+}
+
+sc_timed_event_wheel::sc_timed_event_wheel( unsigned buckets_log2 )
+  : m_buckets()
+  , m_bits()
+  , m_summary( 0 )
+  , m_mask( 0 )
+  , m_shift( 0 )
+  , m_cur( 0 )
+  , m_ready()
+  , m_overflow()
+  , m_near( 0 )
+  , m_size( 0 )
+  , m_seq( 0 )
+  , m_now( 0 )
+  , m_delay_sum( 0.0 )
+  , m_epoch_n( 0 )
+{
+    // the two level bitmap supports up to 64 * 64 slots
+    if( buckets_log2 < 6 )  buckets_log2 = 6;
+    if( buckets_log2 > 12 ) buckets_log2 = 12;
+
+    m_buckets.resize( std::size_t(1) << buckets_log2 );
+    m_bits.resize( m_buckets.size() / 64, 0 );
+    m_mask = m_buckets.size() - 1;
+}
+
+sc_timed_event_wheel::~sc_timed_event_wheel()
+{}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_wheel::mark_bucket / clear_bucket"
+//
+// These methods maintain the bitmap of non-empty slots of the ring.
+//------------------------------------------------------------------------------
+inline void
+sc_timed_event_wheel::mark_bucket( std::size_t i )
+{
+    m_bits[i >> 6] |= sc_dt::uint64(1) << ( i & 63 );
+    m_summary |= sc_dt::uint64(1) << ( i >> 6 );
+}
+
+inline void
+sc_timed_event_wheel::clear_bucket( std::size_t i )
+{
+    sc_dt::uint64& w = m_bits[i >> 6];
+    w &= ~( sc_dt::uint64(1) << ( i & 63 ) );
+    if( w == 0 ) {
+        m_summary &= ~( sc_dt::uint64(1) << ( i >> 6 ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_wheel::next_bucket"
+//
+// This method returns the index of the first non-empty slot at or after
+// index i, wrapping around the end of the ring. There must be at least one
+// non-empty slot.
+//------------------------------------------------------------------------------
+std::size_t
+sc_timed_event_wheel::next_bucket( std::size_t i ) const
+{
+    std::size_t   word = i >> 6;
+    sc_dt::uint64 w    = m_bits[word] & ( ~sc_dt::uint64(0) << ( i & 63 ) );
+    if( w != 0 ) {
+        return ( word << 6 ) + sc_wheel_ctz( w );
+    }
+
+    sc_dt::uint64 s = ( word + 1 < 64 )
+                    ? m_summary & ( ~sc_dt::uint64(0) << ( word + 1 ) )
+                    : 0;
+    if( s == 0 ) {
+        s = m_summary; // wrap around
+    }
+    word = sc_wheel_ctz( s );
+    return ( word << 6 ) + sc_wheel_ctz( m_bits[word] );
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_wheel::place"
+//
+// This method stores an entry in the ready list, the ring or the overflow
+// heap depending on its slot.
+//------------------------------------------------------------------------------
+void
+sc_timed_event_wheel::place( const entry& e )
+{
+    value_type slot = e.time >> m_shift;
+
+    if( slot <= m_cur ) {
+        // keep the ready list in descending order, the next entry at the end
+        queue_index( e.et ) = SC_WHEEL_NPOS;
+        m_ready.insert( std::upper_bound( m_ready.begin(), m_ready.end(), e,
+                                          sc_wheel_later() ), e );
+    }
+    else if( slot - m_cur <= m_mask ) {
+        std::size_t i = static_cast<std::size_t>( slot & m_mask );
+        queue_index( e.et ) = m_buckets[i].size();
+        m_buckets[i].push_back( e );
+        mark_bucket( i );
+        ++m_near;
+    }
+    else {
+        queue_index( e.et ) = SC_WHEEL_NPOS;
+        m_overflow.push_back( e );
+        std::push_heap( m_overflow.begin(), m_overflow.end(),
+                        sc_wheel_later() );
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_wheel::advance"
+//
+// This method moves the ring forward to the next non-empty slot, if the
+// ready list is empty. Entries of the overflow heap that fall into the ring
+// afterwards are moved into their slots.
+//------------------------------------------------------------------------------
+void
+sc_timed_event_wheel::advance()
+{
+    if( !m_ready.empty() || m_size == 0 ) {
+        return;
+    }
+
+    if( m_near != 0 ) {
+        std::size_t cur = static_cast<std::size_t>( m_cur & m_mask );
+        std::size_t i = next_bucket( ( cur + 1 ) & m_mask );
+        m_cur += ( i - cur ) & m_mask;
+    } else {
+        // the ring is empty, jump to the first overflow entry
+        m_cur = m_overflow.front().time >> m_shift;
+    }
+
+    std::size_t i = static_cast<std::size_t>( m_cur & m_mask );
+    m_ready.swap( m_buckets[i] );
+    if( !m_ready.empty() ) {
+        m_near -= m_ready.size();
+        clear_bucket( i );
+        for( std::size_t j = 0; j < m_ready.size(); ++j ) {
+            queue_index( m_ready[j].et ) = SC_WHEEL_NPOS;
+        }
+    }
+
+    while( !m_overflow.empty() &&
+           ( m_overflow.front().time >> m_shift ) - m_cur <= m_mask )
+    {
+        std::pop_heap( m_overflow.begin(), m_overflow.end(),
+                       sc_wheel_later() );
+        entry e = m_overflow.back();
+        m_overflow.pop_back();
+        if( ( e.time >> m_shift ) == m_cur ) {
+            m_ready.push_back( e );
+        } else {
+            place( e );
+        }
+    }
+
+    std::sort( m_ready.begin(), m_ready.end(), sc_wheel_later() );
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_wheel::adapt"
+//
+// This method adjusts the slot width to the average notification delay of
+// the last epoch. The queue is only rebuilt if the width is off by more than
+// a factor of two to avoid oscillation.
+//------------------------------------------------------------------------------
+void
+sc_timed_event_wheel::adapt()
+{
+    double span = SC_WHEEL_SPAN * m_delay_sum / double( m_epoch_n );
+    m_delay_sum = 0.0;
+    m_epoch_n = 0;
+
+    unsigned shift = 0;
+    while( shift < 63 && double( m_mask + 1 ) * double( value_type(1) << shift )
+                         < span )
+    {
+        ++shift;
+    }
+
+    if( shift > m_shift + 1 || shift + 1 < m_shift ) {
+        rebuild( shift );
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_wheel::rebuild"
+//
+// This method redistributes all entries for a new slot width.
+//------------------------------------------------------------------------------
+void
+sc_timed_event_wheel::rebuild( unsigned shift )
+{
+    std::vector<entry> all;
+    all.reserve( m_size );
+    all.insert( all.end(), m_ready.begin(), m_ready.end() );
+    all.insert( all.end(), m_overflow.begin(), m_overflow.end() );
+    for( std::size_t i = 0; i <= m_mask; ++i ) {
+        all.insert( all.end(), m_buckets[i].begin(), m_buckets[i].end() );
+        m_buckets[i].clear();
+    }
+    std::fill( m_bits.begin(), m_bits.end(), 0 );
+    m_summary = 0;
+    m_ready.clear();
+    m_overflow.clear();
+    m_near = 0;
+
+    m_shift = shift;
+    m_cur = m_now >> m_shift;
+    for( std::size_t i = 0; i < all.size(); ++i ) {
+        if( ( all[i].time >> m_shift ) <= m_cur ) {
+            queue_index( all[i].et ) = SC_WHEEL_NPOS;
+            m_ready.push_back( all[i] );
+        } else {
+            place( all[i] );
+        }
+    }
+    std::sort( m_ready.begin(), m_ready.end(), sc_wheel_later() );
+}
+
+void
+sc_timed_event_wheel::insert( sc_event_timed* et )
+{
+    entry e = { notify_time( et ).value(), m_seq++, et };
+
+    if( e.time > m_now ) {
+        m_delay_sum += double( e.time - m_now );
+    }
+    place( e );
+    ++m_size;
+
+    if( ++m_epoch_n == SC_WHEEL_EPOCH ) {
+        adapt();
+    }
+}
+
+//------------------------------------------------------------------------------
+//"sc_timed_event_wheel::remove"
+//
+// This method removes an entry from its slot of the ring, the last entry of
+// the slot takes its place. Entries in the ready list or the overflow heap
+// are not removed.
+//------------------------------------------------------------------------------
+bool
+sc_timed_event_wheel::remove( sc_event_timed* et )
+{
+    std::size_t pos = queue_index( et );
+    if( pos == SC_WHEEL_NPOS ) {
+        return false;
+    }
+
+    std::size_t i = static_cast<std::size_t>(
+        ( notify_time( et ).value() >> m_shift ) & m_mask );
+    std::vector<entry>& bucket = m_buckets[i];
+    sc_assert( pos < bucket.size() && bucket[pos].et == et );
+
+    bucket[pos] = bucket.back();
+    queue_index( bucket[pos].et ) = pos;
+    bucket.pop_back();
+    if( bucket.empty() ) {
+        clear_bucket( i );
+    }
+    --m_near;
+    --m_size;
+    return true;
+}
+
+sc_event_timed*
+sc_timed_event_wheel::top()
+{
+    advance();
+    return m_ready.back().et;
+}
+
+sc_event_timed*
+sc_timed_event_wheel::extract_top()
+{
+    advance();
+    const entry& e = m_ready.back();
+    sc_event_timed* et = e.et;
+    m_now = e.time;
+    m_ready.pop_back();
+    --m_size;
+    return et;
+}
+
+} // namespace sc_core
+
+// Taf!
@@ -0,0 +1,260 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timed_event_queue.h -- Queues of pending timed event notifications.
+
+  CHANGE LOG AT THE END OF THE FILE
+ *****************************************************************************/
+
+#ifndef SC_TIMED_EVENT_QUEUE_H
+#define SC_TIMED_EVENT_QUEUE_H
+
+#include "sysc/kernel/sc_event.h"
+
+#include <cstddef>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_event_queue
+//
+//  Interface of the queue holding the pending timed notifications of the
+//  simulation context, ordered by their notification time.
+//
+//  Entries are owned by the simulation context. Cancelled notifications are
+//  taken out of the queue, if the implementation supports the removal of
+//  the entry. Otherwise they stay in the queue with a null event and are
+//  dropped when they reach the top.
+//  Implementations may be installed with sc_set_timed_event_queue() until
+//  the simulation is started.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_timed_event_queue
+{
+public:
+
+    sc_timed_event_queue()
+        : m_removed( 0 ), m_tombstones( 0 )
+        {}
+
+    virtual ~sc_timed_event_queue() {}
+
+    virtual const char* kind() const = 0;
+
+    virtual void insert( sc_event_timed* et ) = 0;
+
+    // the entry with the earliest notification time (queue not empty)
+    virtual sc_event_timed* top() = 0;
+    virtual sc_event_timed* extract_top() = 0;
+
+    virtual std::size_t size() const = 0;
+    virtual bool empty() const = 0;
+
+    // cancel a pending entry, true if it has been removed from the queue
+    bool cancel( sc_event_timed* et )
+    {
+        if( remove( et ) ) {
+            ++m_removed;
+            return true;
+        }
+        ++m_tombstones;
+        return false;
+    }
+
+    // number of cancelled entries removed, or left in the queue
+    sc_dt::uint64 removed_count() const
+        { return m_removed; }
+    sc_dt::uint64 tombstone_count() const
+        { return m_tombstones; }
+
+protected:
+
+    // take a pending entry out of the queue (not supported by default)
+    virtual bool remove( sc_event_timed* )
+        { return false; }
+
+    static const sc_time& notify_time( const sc_event_timed* et )
+        { return et->notify_time(); }
+
+    // position of an entry, for the use of the implementation
+    static std::size_t& queue_index( sc_event_timed* et )
+        { return et->m_queue_index; }
+
+private:
+
+    sc_dt::uint64 m_removed;    // cancelled entries removed.
+    sc_dt::uint64 m_tombstones; // cancelled entries left in the queue.
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_event_heap
+//
+//  Binary heap of timed notifications.
+//
+//  The heap operations are those of sc_ppq, so entries with equal times are
+//  delivered in the same order as before. In addition each entry knows its
+//  position, which allows cancelled entries to be removed in O(log n).
+// ----------------------------------------------------------------------------
+
+class SC_API sc_timed_event_heap : public sc_timed_event_queue
+{
+public:
+
+    sc_timed_event_heap();
+
+    virtual const char* kind() const
+        { return "sc_timed_event_heap"; }
+
+    virtual void insert( sc_event_timed* et );
+
+    virtual sc_event_timed* top()
+        { return m_heap[1]; }
+
+    virtual sc_event_timed* extract_top();
+
+    virtual std::size_t size() const
+        { return m_heap.size() - 1; }
+
+    virtual bool empty() const
+        { return m_heap.size() == 1; }
+
+protected:
+
+    virtual bool remove( sc_event_timed* et );
+
+private:
+
+    void sift_up( std::size_t i, sc_event_timed* et );
+    void heapify( std::size_t i );
+
+    void set( std::size_t i, sc_event_timed* et )
+        { m_heap[i] = et; queue_index( et ) = i; }
+
+private:
+
+    std::vector<sc_event_timed*> m_heap; // entries from index 1 on.
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_event_wheel
+//
+//  Timing wheel (calendar queue) of timed notifications.
+//
+//  The near future is covered by a ring of buckets, each holding the entries
+//  of a time slot of 2^granularity time resolution units in arrival order.
+//  Entries beyond the ring go to an overflow heap and are moved into the
+//  ring as the ring advances. The slot currently at the head is sorted once
+//  when it is reached. Insertion into the ring is O(1), which pays off when
+//  most notifications land a few clock periods ahead of the current time.
+//
+//  The slot width adapts to the observed notification delays, so that the
+//  ring typically spans a multiple of the average delay. Entries with equal
+//  notification times are delivered in insertion order. Cancelled entries
+//  are removed from the ring in O(1); those in the head slot or beyond the
+//  ring are left in the queue.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_timed_event_wheel : public sc_timed_event_queue
+{
+public:
+
+    // number of slots is 2^buckets_log2, with 6 <= buckets_log2 <= 12
+    explicit sc_timed_event_wheel( unsigned buckets_log2 = 12 );
+    virtual ~sc_timed_event_wheel();
+
+    virtual const char* kind() const
+        { return "sc_timed_event_wheel"; }
+
+    virtual void insert( sc_event_timed* et );
+    virtual sc_event_timed* top();
+    virtual sc_event_timed* extract_top();
+
+    virtual std::size_t size() const
+        { return m_size; }
+
+    virtual bool empty() const
+        { return m_size == 0; }
+
+    // log2 of the slot width in time resolution units
+    unsigned granularity() const
+        { return m_shift; }
+
+protected:
+
+    virtual bool remove( sc_event_timed* et );
+
+private:
+
+    typedef sc_time::value_type value_type;
+
+    struct entry
+    {
+        value_type      time;  // notification time.
+        value_type      seq;   // insertion sequence number.
+        sc_event_timed* et;    // the queue entry.
+
+        // order of extraction, earliest time and insertion first
+        bool operator < ( const entry& other ) const
+            { return time != other.time ? time < other.time
+                                        : seq < other.seq; }
+    };
+
+    void place( const entry& e );
+    void advance();
+    void adapt();
+    void rebuild( unsigned shift );
+
+    std::size_t next_bucket( std::size_t i ) const;
+    void mark_bucket( std::size_t i );
+    void clear_bucket( std::size_t i );
+
+private:
+
+    std::vector< std::vector<entry> > m_buckets;  // ring of slots.
+    std::vector<sc_dt::uint64> m_bits; // non-empty slots, one bit each.
+    sc_dt::uint64      m_summary;      // non-zero words of m_bits.
+    std::size_t        m_mask;         // number of slots - 1.
+    unsigned           m_shift;        // log2 of slot width.
+    value_type         m_cur;          // slot of the ready entries.
+    std::vector<entry> m_ready;        // slots <= m_cur, descending order.
+    std::vector<entry> m_overflow;     // slots beyond the ring, min heap.
+    std::size_t        m_near;         // number of entries in the ring.
+    std::size_t        m_size;         // total number of entries.
+    value_type         m_seq;          // next insertion sequence number.
+    value_type         m_now;          // time of the last extracted entry.
+    double             m_delay_sum;    // delays inserted in this epoch.
+    std::size_t        m_epoch_n;      // inserts in this epoch.
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+#endif // SC_TIMED_EVENT_QUEUE_H
+// Taf!
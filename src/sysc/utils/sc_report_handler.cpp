@@ -31,6 +31,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
@@ -44,6 +45,20 @@ namespace sc_core {
 
 int sc_report_handler::verbosity_level = SC_MEDIUM;
 
+// Reports may be issued concurrently by the isolated method processes of a
+// parallel evaluation batch (see sc_set_parallel_evaluation()), so they are
+// processed one at a time while a batch is executing. The handler may issue
+// a report itself.
+
+static std::unique_lock<std::recursive_mutex> report_lock()
+{
+    static std::recursive_mutex mutex;
+    std::unique_lock<std::recursive_mutex> lock( mutex, std::defer_lock );
+    if( sc_curr_simcontext && sc_curr_simcontext->in_parallel_batch() )
+        lock.lock();
+    return lock;
+}
+
 // not documented, but available
 std::string sc_report_compose_message(const sc_report& rep)
 {
@@ -331,6 +346,8 @@ void sc_report_handler::report( sc_severity severity_,
 				const char* file_, 
 				int line_ )
 {
+    std::unique_lock<std::recursive_mutex> lock( report_lock() );
+
     sc_msg_def * md = mdlookup(msg_type_);
 
     // If the severity of the report is SC_INFO and the specified verbosity 
@@ -359,6 +376,8 @@ void sc_report_handler::report(sc_severity severity_,
 			       const char * file_,
 			       int line_)
 {
+    std::unique_lock<std::recursive_mutex> lock( report_lock() );
+
     sc_msg_def * md = mdlookup(msg_type_);
 
     // If the severity of the report is SC_INFO and the maximum verbosity
@@ -279,6 +279,9 @@ using sc_dt::sc_logic_X;
     using sc_dt::sc_fixed_fast;
     using sc_dt::sc_ufixed;
     using sc_dt::sc_ufixed_fast;
+    using sc_dt::sc_fixed_native;
+    using sc_dt::sc_ufixed_native;
+    using sc_dt::sc_fxnative;
     using sc_dt::sc_fxval;
     using sc_dt::sc_fxval_fast;
     using sc_dt::sc_fxcast_switch;